@@ -0,0 +1,143 @@
+/* API includes. */
+#include "annexb_scanner.h"
+
+/* SIMD includes. */
+#if !defined( ANNEXB_SCANNER_DISABLE_SIMD ) && defined( __GNUC__ ) && defined( __AVX2__ )
+    #include <immintrin.h>
+    #define ANNEXB_SCANNER_AVX2
+#elif !defined( ANNEXB_SCANNER_DISABLE_SIMD ) && defined( __GNUC__ ) && defined( __SSE2__ )
+    #include <emmintrin.h>
+    #define ANNEXB_SCANNER_SSE2
+#endif
+
+/*-----------------------------------------------------------*/
+
+#define START_CODE_PATTERN_LENGTH    3
+
+/*-----------------------------------------------------------*/
+
+static size_t FindStartCodePattern( const uint8_t * pBuffer,
+                                    size_t bufferLength );
+
+/*-----------------------------------------------------------*/
+
+/* Returns the index of the first 00 00 01, or bufferLength. */
+static size_t FindStartCodePattern( const uint8_t * pBuffer,
+                                    size_t bufferLength )
+{
+    size_t index = 0, patternIndex = bufferLength;
+
+    #if defined( ANNEXB_SCANNER_AVX2 )
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi8( 1 );
+        __m256i matches;
+        uint32_t matchMask;
+
+        /* Compare 32 candidate positions at a time. Bit i of the mask is set
+         * when the bytes at index + i, index + i + 1 and index + i + 2 are
+         * 00 00 01. */
+        while( ( patternIndex == bufferLength ) &&
+               ( bufferLength - index >= 32 + START_CODE_PATTERN_LENGTH - 1 ) )
+        {
+            matches = _mm256_and_si256( _mm256_cmpeq_epi8( _mm256_loadu_si256( ( const __m256i * ) &( pBuffer[ index ] ) ), zero ),
+                                        _mm256_cmpeq_epi8( _mm256_loadu_si256( ( const __m256i * ) &( pBuffer[ index + 1 ] ) ), zero ) );
+            matches = _mm256_and_si256( matches,
+                                        _mm256_cmpeq_epi8( _mm256_loadu_si256( ( const __m256i * ) &( pBuffer[ index + 2 ] ) ), one ) );
+            matchMask = ( uint32_t ) _mm256_movemask_epi8( matches );
+
+            if( matchMask != 0U )
+            {
+                patternIndex = index + ( size_t ) __builtin_ctz( matchMask );
+            }
+            else
+            {
+                index += 32;
+            }
+        }
+    #elif defined( ANNEXB_SCANNER_SSE2 )
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi8( 1 );
+        __m128i matches;
+        uint32_t matchMask;
+
+        /* Compare 16 candidate positions at a time. */
+        while( ( patternIndex == bufferLength ) &&
+               ( bufferLength - index >= 16 + START_CODE_PATTERN_LENGTH - 1 ) )
+        {
+            matches = _mm_and_si128( _mm_cmpeq_epi8( _mm_loadu_si128( ( const __m128i * ) &( pBuffer[ index ] ) ), zero ),
+                                     _mm_cmpeq_epi8( _mm_loadu_si128( ( const __m128i * ) &( pBuffer[ index + 1 ] ) ), zero ) );
+            matches = _mm_and_si128( matches,
+                                     _mm_cmpeq_epi8( _mm_loadu_si128( ( const __m128i * ) &( pBuffer[ index + 2 ] ) ), one ) );
+            matchMask = ( uint32_t ) _mm_movemask_epi8( matches );
+
+            if( matchMask != 0U )
+            {
+                patternIndex = index + ( size_t ) __builtin_ctz( matchMask );
+            }
+            else
+            {
+                index += 16;
+            }
+        }
+    #endif /* if defined( ANNEXB_SCANNER_AVX2 ) */
+
+    /* Scalar scan of the tail, or of the whole buffer without SIMD. A byte
+     * greater than 1 at index + 2 cannot be part of a pattern starting at
+     * index, index + 1 or index + 2. */
+    while( ( patternIndex == bufferLength ) &&
+           ( bufferLength - index >= START_CODE_PATTERN_LENGTH ) )
+    {
+        if( pBuffer[ index + 2 ] > 1U )
+        {
+            index += 3;
+        }
+        else if( ( pBuffer[ index + 2 ] == 1U ) &&
+                 ( pBuffer[ index + 1 ] == 0U ) &&
+                 ( pBuffer[ index ] == 0U ) )
+        {
+            patternIndex = index;
+        }
+        else
+        {
+            index += 1;
+        }
+    }
+
+    return patternIndex;
+}
+
+/*-----------------------------------------------------------*/
+
+size_t AnnexB_FindStartCode( const uint8_t * pBuffer,
+                             size_t bufferLength,
+                             size_t * pStartCodeLength )
+{
+    size_t startCodeIndex = bufferLength, startCodeLength = 0;
+
+    if( pBuffer != NULL )
+    {
+        startCodeIndex = FindStartCodePattern( pBuffer,
+                                               bufferLength );
+    }
+
+    if( startCodeIndex < bufferLength )
+    {
+        startCodeLength = START_CODE_PATTERN_LENGTH;
+
+        if( ( startCodeIndex > 0 ) &&
+            ( pBuffer[ startCodeIndex - 1 ] == 0U ) )
+        {
+            startCodeIndex -= 1;
+            startCodeLength += 1;
+        }
+    }
+
+    if( pStartCodeLength != NULL )
+    {
+        *pStartCodeLength = startCodeLength;
+    }
+
+    return startCodeIndex;
+}
+
+/*-----------------------------------------------------------*/
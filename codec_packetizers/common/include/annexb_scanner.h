@@ -0,0 +1,21 @@
+#ifndef ANNEXB_SCANNER_H
+#define ANNEXB_SCANNER_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* Returns the index of the first Annex-B start code in the buffer and writes
+ * its length, 4 for 00 00 00 01 and 3 for 00 00 01, to pStartCodeLength. A
+ * zero byte before 00 00 01 is part of the start code unless it is the first
+ * byte of the buffer, which matches a byte by byte scan for the 4-byte start
+ * code first. Returns bufferLength and a length of 0 if there is no start
+ * code.
+ *
+ * The scan uses AVX2 or SSE2 when the compiler targets them, and a scalar
+ * scan otherwise or when ANNEXB_SCANNER_DISABLE_SIMD is defined. */
+size_t AnnexB_FindStartCode( const uint8_t * pBuffer,
+                             size_t bufferLength,
+                             size_t * pStartCodeLength );
+
+#endif /* ANNEXB_SCANNER_H */
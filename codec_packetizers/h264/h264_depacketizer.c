@@ -3,6 +3,7 @@
 
 /* API includes. */
 #include "h264_depacketizer.h"
+#include "rtp_endianness.h"
 
 /*-----------------------------------------------------------*/
 
@@ -134,9 +135,7 @@ static H264Result_t DepacketizeAggregationPacket( H264DepacketizerContext_t * pC
     if( ( pCtx->curPacketIndex + STAP_A_NALU_SIZE ) <= curPacketLength )
     {
         /* Read NALU length. */
-        naluLength = pCurPacketData[ pCtx->curPacketIndex ];
-        naluLength = ( naluLength << 8 ) |
-                     ( pCurPacketData[ pCtx->curPacketIndex + 1 ] );
+        naluLength = Rtp_ReadUint16( &( pCurPacketData[ pCtx->curPacketIndex ] ) );
 
         pCtx->curPacketIndex += STAP_A_NALU_SIZE;
 
@@ -367,6 +366,99 @@ H264Result_t H264Depacketizer_GetFrame( H264DepacketizerContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+H264Result_t H264Depacketizer_GetFrameLengthPrefixed( H264DepacketizerContext_t * pCtx,
+                                                      Frame_t * pFrame,
+                                                      size_t naluLengthSize )
+{
+    H264Result_t result = H264_RESULT_OK;
+    Nalu_t nalu;
+    size_t currentFrameDataIndex = 0, naluDataIndex = 0, lengthIndex = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) ||
+        ( ( naluLengthSize != 1 ) &&
+          ( naluLengthSize != 2 ) &&
+          ( naluLengthSize != 4 ) ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        if( pCtx->packetCount == 0 )
+        {
+            result = H264_RESULT_NO_MORE_FRAMES;
+        }
+    }
+
+    while( result == H264_RESULT_OK )
+    {
+        if( ( pFrame->frameDataLength - currentFrameDataIndex ) > naluLengthSize )
+        {
+            /* NALU data starts after the length field. */
+            lengthIndex = currentFrameDataIndex;
+            naluDataIndex = currentFrameDataIndex + naluLengthSize;
+
+            nalu.pNaluData = &( pFrame->pFrameData[ naluDataIndex ] );
+            nalu.naluDataLength = pFrame->frameDataLength - naluDataIndex;
+
+            result = H264Depacketizer_GetNalu( pCtx,
+                                               &( nalu ) );
+
+            if( result == H264_RESULT_OK )
+            {
+                if( naluLengthSize == 1 )
+                {
+                    if( nalu.naluDataLength > UINT8_MAX )
+                    {
+                        result = H264_RESULT_UNSUPPORTED_PACKET;
+                    }
+                    else
+                    {
+                        pFrame->pFrameData[ lengthIndex ] = ( uint8_t ) nalu.naluDataLength;
+                    }
+                }
+                else if( naluLengthSize == 2 )
+                {
+                    if( nalu.naluDataLength > UINT16_MAX )
+                    {
+                        result = H264_RESULT_UNSUPPORTED_PACKET;
+                    }
+                    else
+                    {
+                        Rtp_WriteUint16( &( pFrame->pFrameData[ lengthIndex ] ),
+                                         ( uint16_t ) nalu.naluDataLength );
+                    }
+                }
+                else
+                {
+                    Rtp_WriteUint32( &( pFrame->pFrameData[ lengthIndex ] ),
+                                     ( uint32_t ) nalu.naluDataLength );
+                }
+
+                currentFrameDataIndex += naluLengthSize;
+                currentFrameDataIndex += nalu.naluDataLength;
+            }
+        }
+        else
+        {
+            result = H264_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == H264_RESULT_NO_MORE_NALUS )
+    {
+        result = H264_RESULT_OK;
+        pFrame->frameDataLength = currentFrameDataIndex;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
 H264Result_t H264Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
                                                    const size_t packetDataLength,
                                                    uint32_t * pProperties )
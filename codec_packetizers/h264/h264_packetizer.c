@@ -3,6 +3,14 @@
 
 /* API includes. */
 #include "h264_packetizer.h"
+#include "annexb_scanner.h"
+#include "rtp_endianness.h"
+
+/*-----------------------------------------------------------*/
+
+/* The NALU array is used as a ring. */
+#define WRAP_NALU_INDEX( pCtx, index ) \
+    ( ( index ) % ( pCtx )->naluArrayLength )
 
 /*-----------------------------------------------------------*/
 
@@ -12,6 +20,33 @@ static void PacketizeSingleNaluPacket( H264PacketizerContext_t * pCtx,
 static void PacketizeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
                                               H264Packet_t * pPacket );
 
+static void PacketizeAggregationPacket( H264PacketizerContext_t * pCtx,
+                                        size_t nalusToAggregate,
+                                        H264Packet_t * pPacket );
+
+static void GetNextFragment( H264PacketizerContext_t * pCtx,
+                             size_t maxNaluDataLengthToSend,
+                             uint8_t * pFuHeaders,
+                             uint8_t ** ppNaluData,
+                             size_t * pNaluDataLength );
+
+static size_t CountNalusToAggregate( H264PacketizerContext_t * pCtx,
+                                     size_t maxPacketLength,
+                                     size_t maxNalus );
+
+static uint8_t GetAggregationHeader( H264PacketizerContext_t * pCtx,
+                                     size_t nalusToAggregate );
+
+static void DescribeSingleNaluPacket( H264PacketizerContext_t * pCtx,
+                                      H264PacketDescriptor_t * pDescriptor );
+
+static H264Result_t DescribeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
+                                                     H264PacketDescriptor_t * pDescriptor );
+
+static void DescribeAggregationPacket( H264PacketizerContext_t * pCtx,
+                                       size_t nalusToAggregate,
+                                       H264PacketDescriptor_t * pDescriptor );
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -40,7 +75,7 @@ static void PacketizeSingleNaluPacket( H264PacketizerContext_t * pCtx,
     pPacket->packetDataLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
 
     /* Move to the next NALU in the next call to H264Packetizer_GetPacket. */
-    pCtx->tailIndex += 1;
+    pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + 1 );
     pCtx->naluCount -= 1;
 }
 
@@ -48,9 +83,72 @@ static void PacketizeSingleNaluPacket( H264PacketizerContext_t * pCtx,
 
 static void PacketizeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
                                               H264Packet_t * pPacket )
+{
+    uint8_t * pNaluData;
+    size_t naluDataLengthToSend;
+
+    /* Write FU indicator and header. */
+    GetNextFragment( pCtx,
+                     pPacket->packetDataLength - FU_A_HEADER_SIZE,
+                     &( pPacket->pPacketData[ FU_A_INDICATOR_OFFSET ] ),
+                     &( pNaluData ),
+                     &( naluDataLengthToSend ) );
+
+    /* Write FU payload. */
+    memcpy( ( void * ) &( pPacket->pPacketData[ FU_A_PAYLOAD_OFFSET ] ),
+            ( const void * ) pNaluData,
+            naluDataLengthToSend );
+    pPacket->packetDataLength = naluDataLengthToSend + FU_A_HEADER_SIZE;
+}
+
+/*-----------------------------------------------------------*/
+
+static void PacketizeAggregationPacket( H264PacketizerContext_t * pCtx,
+                                        size_t nalusToAggregate,
+                                        H264Packet_t * pPacket )
+{
+    size_t i, packetWriteIndex = 0, naluSize;
+    uint8_t * pNaluData;
+
+    /* Write STAP-A header. */
+    pPacket->pPacketData[ 0 ] = GetAggregationHeader( pCtx,
+                                                      nalusToAggregate );
+    packetWriteIndex += STAP_A_HEADER_SIZE;
+
+    /* Aggregate all the NAL units in the packet. */
+    for( i = 0; i < nalusToAggregate; i++ )
+    {
+        pNaluData = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].pNaluData;
+        naluSize = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].naluDataLength;
+
+        /* Write NAL unit size. */
+        Rtp_WriteUint16( &( pPacket->pPacketData[ packetWriteIndex ] ),
+                         ( uint16_t ) naluSize );
+        packetWriteIndex += STAP_A_NALU_SIZE;
+
+        /* Write NAL unit data. */
+        memcpy( ( void * ) &( pPacket->pPacketData[ packetWriteIndex ] ),
+                ( const void * ) pNaluData,
+                naluSize );
+        packetWriteIndex += naluSize;
+    }
+
+    pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + nalusToAggregate );
+    pCtx->naluCount -= nalusToAggregate;
+
+    pPacket->packetDataLength = packetWriteIndex;
+}
+
+/*-----------------------------------------------------------*/
+
+static void GetNextFragment( H264PacketizerContext_t * pCtx,
+                             size_t maxNaluDataLengthToSend,
+                             uint8_t * pFuHeaders,
+                             uint8_t ** ppNaluData,
+                             size_t * pNaluDataLength )
 {
     uint8_t fuHeader = 0;
-    size_t maxNaluDataLengthToSend, naluDataLengthToSend;
+    size_t naluDataLengthToSend;
     uint8_t * pNaluData = pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData;
 
     /* Is this the first fragment? */
@@ -69,8 +167,6 @@ static void PacketizeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
         fuHeader |= FU_A_HEADER_S_BIT_MASK;
     }
 
-    /* Maximum NALU data that we can send in this packet. */
-    maxNaluDataLengthToSend = pPacket->packetDataLength - FU_A_HEADER_SIZE;
     /* Actual NALU data what we will send in this packet. */
     naluDataLengthToSend = H264_MIN( maxNaluDataLengthToSend,
                                      pCtx->fuAPacketizationState.remainingNaluLength );
@@ -82,18 +178,15 @@ static void PacketizeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
     }
 
     /* Write FU indicator and header. */
-    pPacket->pPacketData[ FU_A_INDICATOR_OFFSET ] = ( FU_A_PACKET_TYPE |
-                                                      ( pCtx->fuAPacketizationState.naluHeader &
-                                                        NALU_HEADER_NRI_MASK ) );
-    pPacket->pPacketData[ FU_A_HEADER_OFFSET ] = ( fuHeader |
-                                                   ( pCtx->fuAPacketizationState.naluHeader &
-                                                     NALU_HEADER_TYPE_MASK ) );
+    pFuHeaders[ FU_A_INDICATOR_OFFSET ] = ( FU_A_PACKET_TYPE |
+                                            ( pCtx->fuAPacketizationState.naluHeader &
+                                              NALU_HEADER_NRI_MASK ) );
+    pFuHeaders[ FU_A_HEADER_OFFSET ] = ( fuHeader |
+                                         ( pCtx->fuAPacketizationState.naluHeader &
+                                           NALU_HEADER_TYPE_MASK ) );
 
-    /* Write FU payload. */
-    memcpy( ( void * ) &( pPacket->pPacketData[ FU_A_PAYLOAD_OFFSET ] ),
-            ( const void * ) &( pNaluData[ pCtx->fuAPacketizationState.naluDataIndex ] ),
-            naluDataLengthToSend );
-    pPacket->packetDataLength = naluDataLengthToSend + FU_A_HEADER_SIZE;
+    *ppNaluData = &( pNaluData[ pCtx->fuAPacketizationState.naluDataIndex ] );
+    *pNaluDataLength = naluDataLengthToSend;
 
     pCtx->fuAPacketizationState.naluDataIndex += naluDataLengthToSend;
     pCtx->fuAPacketizationState.remainingNaluLength -= naluDataLengthToSend;
@@ -107,13 +200,150 @@ static void PacketizeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
         pCtx->currentlyProcessingPacket = H264_PACKET_NONE;
 
         /* Move to the next NALU in the next call to H264Packetizer_GetPacket. */
-        pCtx->tailIndex += 1;
+        pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + 1 );
         pCtx->naluCount -= 1;
     }
 }
 
 /*-----------------------------------------------------------*/
 
+static size_t CountNalusToAggregate( H264PacketizerContext_t * pCtx,
+                                     size_t maxPacketLength,
+                                     size_t maxNalus )
+{
+    size_t i, naluSize, aggregatePacketSize = STAP_A_HEADER_SIZE, nalusToAggregate = 0;
+
+    for( i = 0; i < H264_MIN( pCtx->naluCount, maxNalus ); i++ )
+    {
+        naluSize = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].naluDataLength;
+
+        /* Can we fit in this NAL unit? */
+        if( ( aggregatePacketSize + STAP_A_NALU_SIZE + naluSize ) <= maxPacketLength )
+        {
+            aggregatePacketSize += ( STAP_A_NALU_SIZE + naluSize );
+            nalusToAggregate += 1;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return nalusToAggregate;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t GetAggregationHeader( H264PacketizerContext_t * pCtx,
+                                     size_t nalusToAggregate )
+{
+    size_t i;
+    uint8_t naluHeader, header = STAP_A_PACKET_TYPE, maxNri = 0;
+
+    for( i = 0; i < nalusToAggregate; i++ )
+    {
+        naluHeader = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].pNaluData[ 0 ];
+
+        /* F bit is set if any of the aggregated NAL units has it set. */
+        header |= ( naluHeader & NALU_HEADER_F_MASK );
+
+        /* NRI is the maximum NRI of the aggregated NAL units. */
+        maxNri = H264_MAX( maxNri, ( naluHeader & NALU_HEADER_NRI_MASK ) );
+    }
+
+    return ( uint8_t ) ( header | maxNri );
+}
+
+/*-----------------------------------------------------------*/
+
+static void DescribeSingleNaluPacket( H264PacketizerContext_t * pCtx,
+                                      H264PacketDescriptor_t * pDescriptor )
+{
+    pDescriptor->pSlices[ 0 ].pBase = pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData;
+    pDescriptor->pSlices[ 0 ].length = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
+    pDescriptor->slicesLength = 1;
+    pDescriptor->packetDataLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
+
+    /* Move to the next NALU in the next call to H264Packetizer_GetPacketDescriptor. */
+    pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + 1 );
+    pCtx->naluCount -= 1;
+}
+
+/*-----------------------------------------------------------*/
+
+static H264Result_t DescribeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
+                                                     H264PacketDescriptor_t * pDescriptor )
+{
+    H264Result_t result = H264_RESULT_OK;
+    uint8_t * pNaluData;
+    size_t naluDataLengthToSend;
+
+    /* FU indicator and header in the prefix, FU payload in the NALU. */
+    if( ( pDescriptor->slicesLength < 2 ) ||
+        ( pDescriptor->packetDataLength <= FU_A_HEADER_SIZE ) )
+    {
+        result = H264_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        GetNextFragment( pCtx,
+                         pDescriptor->packetDataLength - FU_A_HEADER_SIZE,
+                         &( pDescriptor->prefix[ 0 ] ),
+                         &( pNaluData ),
+                         &( naluDataLengthToSend ) );
+
+        pDescriptor->pSlices[ 0 ].pBase = &( pDescriptor->prefix[ 0 ] );
+        pDescriptor->pSlices[ 0 ].length = FU_A_HEADER_SIZE;
+        pDescriptor->pSlices[ 1 ].pBase = pNaluData;
+        pDescriptor->pSlices[ 1 ].length = naluDataLengthToSend;
+        pDescriptor->slicesLength = 2;
+        pDescriptor->packetDataLength = naluDataLengthToSend + FU_A_HEADER_SIZE;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void DescribeAggregationPacket( H264PacketizerContext_t * pCtx,
+                                       size_t nalusToAggregate,
+                                       H264PacketDescriptor_t * pDescriptor )
+{
+    size_t i, prefixIndex = STAP_A_HEADER_SIZE, naluSize, packetLength = STAP_A_HEADER_SIZE;
+
+    pDescriptor->prefix[ 0 ] = GetAggregationHeader( pCtx,
+                                                     nalusToAggregate );
+
+    /* Each NAL unit takes two slices - its size in the prefix and its data.
+     * The first size slice also carries the STAP-A header. */
+    for( i = 0; i < nalusToAggregate; i++ )
+    {
+        naluSize = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].naluDataLength;
+
+        Rtp_WriteUint16( &( pDescriptor->prefix[ prefixIndex ] ),
+                         ( uint16_t ) naluSize );
+
+        pDescriptor->pSlices[ 2 * i ].pBase = ( i == 0 ) ? &( pDescriptor->prefix[ 0 ] ) :
+                                              &( pDescriptor->prefix[ prefixIndex ] );
+        pDescriptor->pSlices[ 2 * i ].length = ( i == 0 ) ? ( STAP_A_HEADER_SIZE + STAP_A_NALU_SIZE ) :
+                                               STAP_A_NALU_SIZE;
+        pDescriptor->pSlices[ ( 2 * i ) + 1 ].pBase = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].pNaluData;
+        pDescriptor->pSlices[ ( 2 * i ) + 1 ].length = naluSize;
+
+        prefixIndex += STAP_A_NALU_SIZE;
+        packetLength += STAP_A_NALU_SIZE + naluSize;
+    }
+
+    pDescriptor->slicesLength = 2 * nalusToAggregate;
+    pDescriptor->packetDataLength = packetLength;
+
+    pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + nalusToAggregate );
+    pCtx->naluCount -= nalusToAggregate;
+}
+
+/*-----------------------------------------------------------*/
+
 H264Result_t H264Packetizer_Init( H264PacketizerContext_t * pCtx,
                                   Nalu_t * pNaluArray,
                                   size_t naluArrayLength )
@@ -141,6 +371,11 @@ H264Result_t H264Packetizer_Init( H264PacketizerContext_t * pCtx,
         memset( &( pCtx->fuAPacketizationState ),
                 0,
                 sizeof( FuAPacketizationState_t ) );
+
+        pCtx->pChunkData = NULL;
+        pCtx->chunkDataLength = 0;
+        pCtx->chunkScanIndex = 0;
+        pCtx->chunkStartCodeFound = 0;
     }
 
     return result;
@@ -153,9 +388,7 @@ H264Result_t H264Packetizer_AddFrame( H264PacketizerContext_t * pCtx,
 {
     H264Result_t result = H264_RESULT_OK;
     Nalu_t nalu;
-    size_t currentIndex = 0, naluStartIndex = 0, remainingFrameLength;
-    const uint8_t startCode1[] = { 0x00, 0x00, 0x00, 0x01 }; /* 4-byte start code. */
-    const uint8_t startCode2[] = { 0x00, 0x00, 0x01 }; /* 3-byte start code. */
+    size_t currentIndex = 0, naluStartIndex = 0, startCodeIndex, startCodeLength;
     uint8_t firstStartCode = 1;
 
     if( ( pCtx == NULL ) ||
@@ -169,63 +402,34 @@ H264Result_t H264Packetizer_AddFrame( H264PacketizerContext_t * pCtx,
     while( ( result == H264_RESULT_OK ) &&
            ( currentIndex < pFrame->frameDataLength ) )
     {
-        remainingFrameLength = pFrame->frameDataLength - currentIndex;
+        startCodeIndex = currentIndex + AnnexB_FindStartCode( &( pFrame->pFrameData[ currentIndex ] ),
+                                                              pFrame->frameDataLength - currentIndex,
+                                                              &( startCodeLength ) );
 
-        /* Check the presence of 4 byte start code. */
-        if( remainingFrameLength >= sizeof( startCode1 ) )
+        if( startCodeLength == 0 )
         {
-            if( memcmp( &( pFrame->pFrameData[ currentIndex ] ),
-                        &( startCode1[ 0 ] ),
-                        sizeof( startCode1 ) ) == 0 )
-            {
-                if( firstStartCode == 1 )
-                {
-                    firstStartCode = 0;
-                }
-                else
-                {
-                    /* Create NAL unit from data between start codes. */
-                    nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
-                    nalu.naluDataLength = currentIndex - naluStartIndex;
-
-                    result = H264Packetizer_AddNalu( pCtx,
-                                                     &( nalu ) );
-                }
-
-                naluStartIndex = currentIndex + sizeof( startCode1 );
-                currentIndex = naluStartIndex;
-                continue;
-            }
+            /* No more start codes. */
+            currentIndex = pFrame->frameDataLength;
         }
-
-        /* Check the presence of 3 byte start code. */
-        if( remainingFrameLength >= sizeof( startCode2 ) )
+        else
         {
-            if( memcmp( &( pFrame->pFrameData[ currentIndex ] ),
-                        &( startCode2[ 0 ] ),
-                        sizeof( startCode2 ) ) == 0 )
+            if( firstStartCode == 1 )
             {
-                if( firstStartCode == 1 )
-                {
-                    firstStartCode = 0;
-                }
-                else
-                {
-                    /* Create NAL unit from data between start codes. */
-                    nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
-                    nalu.naluDataLength = currentIndex - naluStartIndex;
-
-                    result = H264Packetizer_AddNalu( pCtx,
-                                                     &( nalu ) );
-                }
+                firstStartCode = 0;
+            }
+            else
+            {
+                /* Create NAL unit from data between start codes. */
+                nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
+                nalu.naluDataLength = startCodeIndex - naluStartIndex;
 
-                naluStartIndex = currentIndex + sizeof( startCode2 );
-                currentIndex = naluStartIndex;
-                continue;
+                result = H264Packetizer_AddNalu( pCtx,
+                                                 &( nalu ) );
             }
-        }
 
-        currentIndex += 1;
+            naluStartIndex = startCodeIndex + startCodeLength;
+            currentIndex = naluStartIndex;
+        }
     }
 
     /* Handle last NAL unit in frame. */
@@ -250,6 +454,190 @@ H264Result_t H264Packetizer_AddFrame( H264PacketizerContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+H264Result_t H264Packetizer_AddChunk( H264PacketizerContext_t * pCtx,
+                                      Frame_t * pChunk,
+                                      uint8_t isLastChunk )
+{
+    H264Result_t result = H264_RESULT_OK;
+    Nalu_t nalu;
+    size_t startCodeIndex = 0, startCodeLength = 0;
+    uint8_t scanComplete = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pChunk == NULL ) ||
+        ( ( pChunk->pFrameData == NULL ) && ( pChunk->frameDataLength > 0 ) ) ||
+        ( ( pChunk->frameDataLength == 0 ) && ( isLastChunk == 0 ) ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        if( pChunk->frameDataLength == 0 )
+        {
+            /* An empty last chunk only ends the frame. */
+            scanComplete = 1;
+        }
+        else if( pCtx->pChunkData == NULL )
+        {
+            pCtx->pChunkData = pChunk->pFrameData;
+            pCtx->chunkDataLength = 0;
+            pCtx->chunkScanIndex = 0;
+            pCtx->chunkStartCodeFound = 0;
+        }
+        else if( pChunk->pFrameData != &( pCtx->pChunkData[ pCtx->chunkDataLength ] ) )
+        {
+            /* Chunks must be consecutive parts of one buffer. */
+            result = H264_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        pCtx->chunkDataLength += pChunk->frameDataLength;
+    }
+
+    while( ( result == H264_RESULT_OK ) &&
+           ( scanComplete == 0 ) )
+    {
+        startCodeIndex = pCtx->chunkScanIndex +
+                         AnnexB_FindStartCode( &( pCtx->pChunkData[ pCtx->chunkScanIndex ] ),
+                                               pCtx->chunkDataLength - pCtx->chunkScanIndex,
+                                               &( startCodeLength ) );
+
+        if( startCodeLength == 0 )
+        {
+            /* A start code may be split across chunks. Rescan the last 3
+             * bytes, which also keeps the zero byte of a 4-byte start code,
+             * with the next chunk. */
+            if( ( pCtx->chunkDataLength - pCtx->chunkScanIndex ) > 3 )
+            {
+                pCtx->chunkScanIndex = pCtx->chunkDataLength - 3;
+            }
+
+            scanComplete = 1;
+        }
+        else
+        {
+            if( pCtx->chunkStartCodeFound == 0 )
+            {
+                pCtx->chunkStartCodeFound = 1;
+            }
+            else
+            {
+                /* The NAL unit ends at this start code. */
+                nalu.pNaluData = pCtx->pChunkData;
+                nalu.naluDataLength = startCodeIndex;
+
+                result = H264Packetizer_AddNalu( pCtx,
+                                                 &( nalu ) );
+            }
+
+            pCtx->pChunkData = &( pCtx->pChunkData[ startCodeIndex + startCodeLength ] );
+            pCtx->chunkDataLength -= startCodeIndex + startCodeLength;
+            pCtx->chunkScanIndex = 0;
+        }
+    }
+
+    /* The last NAL unit ends with the last chunk. */
+    if( ( result == H264_RESULT_OK ) &&
+        ( isLastChunk != 0 ) )
+    {
+        if( pCtx->chunkStartCodeFound != 0 )
+        {
+            nalu.pNaluData = pCtx->pChunkData;
+            nalu.naluDataLength = pCtx->chunkDataLength;
+
+            result = H264Packetizer_AddNalu( pCtx,
+                                             &( nalu ) );
+        }
+        else
+        {
+            result = H264_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    /* Start afresh with the next chunk after the frame ends or fails. */
+    if( ( pCtx != NULL ) &&
+        ( ( result != H264_RESULT_OK ) || ( isLastChunk != 0 ) ) )
+    {
+        pCtx->pChunkData = NULL;
+        pCtx->chunkDataLength = 0;
+        pCtx->chunkScanIndex = 0;
+        pCtx->chunkStartCodeFound = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Packetizer_AddFrameLengthPrefixed( H264PacketizerContext_t * pCtx,
+                                                    Frame_t * pFrame,
+                                                    size_t naluLengthSize )
+{
+    H264Result_t result = H264_RESULT_OK;
+    Nalu_t nalu;
+    size_t currentIndex = 0, naluLength = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) ||
+        ( ( naluLengthSize != 1 ) &&
+          ( naluLengthSize != 2 ) &&
+          ( naluLengthSize != 4 ) ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    while( ( result == H264_RESULT_OK ) &&
+           ( currentIndex < pFrame->frameDataLength ) )
+    {
+        if( ( pFrame->frameDataLength - currentIndex ) < naluLengthSize )
+        {
+            result = H264_RESULT_MALFORMED_PACKET;
+        }
+        else
+        {
+            if( naluLengthSize == 1 )
+            {
+                naluLength = pFrame->pFrameData[ currentIndex ];
+            }
+            else if( naluLengthSize == 2 )
+            {
+                naluLength = Rtp_ReadUint16( &( pFrame->pFrameData[ currentIndex ] ) );
+            }
+            else
+            {
+                naluLength = Rtp_ReadUint32( &( pFrame->pFrameData[ currentIndex ] ) );
+            }
+
+            currentIndex += naluLengthSize;
+
+            if( ( naluLength == 0 ) ||
+                ( naluLength > ( pFrame->frameDataLength - currentIndex ) ) )
+            {
+                result = H264_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                nalu.pNaluData = &( pFrame->pFrameData[ currentIndex ] );
+                nalu.naluDataLength = naluLength;
+
+                result = H264Packetizer_AddNalu( pCtx,
+                                                 &( nalu ) );
+
+                currentIndex += naluLength;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
 H264Result_t H264Packetizer_AddNalu( H264PacketizerContext_t * pCtx,
                                      Nalu_t * pNalu )
 {
@@ -282,7 +670,7 @@ H264Result_t H264Packetizer_AddNalu( H264PacketizerContext_t * pCtx,
     {
         pCtx->pNaluArray[ pCtx->headIndex ].pNaluData = pNalu->pNaluData;
         pCtx->pNaluArray[ pCtx->headIndex ].naluDataLength = pNalu->naluDataLength;
-        pCtx->headIndex += 1;
+        pCtx->headIndex = WRAP_NALU_INDEX( pCtx, pCtx->headIndex + 1 );
         pCtx->naluCount += 1;
     }
 
@@ -295,6 +683,7 @@ H264Result_t H264Packetizer_GetPacket( H264PacketizerContext_t * pCtx,
                                        H264Packet_t * pPacket )
 {
     H264Result_t result = H264_RESULT_OK;
+    size_t nalusToAggregate = 0;
 
     if( ( pCtx == NULL ) ||
         ( pPacket == NULL ) ||
@@ -323,11 +712,29 @@ H264Result_t H264Packetizer_GetPacket( H264PacketizerContext_t * pCtx,
         }
         else
         {
-            /* If a NAL Unit can fit in one packet, use Single NAL Unit packet. */
+            /* If a NAL Unit can fit in one packet, use Single NAL Unit packet
+             * or STAP-A packet if more than one NAL units can fit in the same
+             * packet. */
             if( pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength <= pPacket->packetDataLength )
             {
-                PacketizeSingleNaluPacket( pCtx,
-                                           pPacket );
+                /* Can we aggregate more than one NAL units? */
+                nalusToAggregate = CountNalusToAggregate( pCtx,
+                                                          pPacket->packetDataLength,
+                                                          pCtx->naluCount );
+
+                /* If we can aggregate more than one NAL units, use STAP-A packet. */
+                if( nalusToAggregate > 1 )
+                {
+                    PacketizeAggregationPacket( pCtx,
+                                                nalusToAggregate,
+                                                pPacket );
+                }
+                else
+                {
+                    /* Otherwise, use Single NAL Unit Packet. */
+                    PacketizeSingleNaluPacket( pCtx,
+                                               pPacket );
+                }
             }
             else
             {
@@ -342,3 +749,66 @@ H264Result_t H264Packetizer_GetPacket( H264PacketizerContext_t * pCtx,
 }
 
 /*-----------------------------------------------------------*/
+
+H264Result_t H264Packetizer_GetPacketDescriptor( H264PacketizerContext_t * pCtx,
+                                                 H264PacketDescriptor_t * pDescriptor )
+{
+    H264Result_t result = H264_RESULT_OK;
+    size_t nalusToAggregate = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pDescriptor == NULL ) ||
+        ( pDescriptor->pSlices == NULL ) ||
+        ( pDescriptor->slicesLength == 0 ) ||
+        ( pDescriptor->packetDataLength == 0 ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        if( pCtx->naluCount == 0 )
+        {
+            result = H264_RESULT_NO_MORE_PACKETS;
+        }
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        /* Are we in the middle of packetizing fragments of a NALU? */
+        if( pCtx->currentlyProcessingPacket == H264_FU_A_PACKET )
+        {
+            result = DescribeFragmentationUnitPacket( pCtx,
+                                                      pDescriptor );
+        }
+        else if( pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength <= pDescriptor->packetDataLength )
+        {
+            /* Aggregation is limited by the slices and the prefix. */
+            nalusToAggregate = CountNalusToAggregate( pCtx,
+                                                      pDescriptor->packetDataLength,
+                                                      H264_MIN( pDescriptor->slicesLength / 2,
+                                                                H264_DESCRIPTOR_MAX_AGGREGATED_NALUS ) );
+
+            if( nalusToAggregate > 1 )
+            {
+                DescribeAggregationPacket( pCtx,
+                                           nalusToAggregate,
+                                           pDescriptor );
+            }
+            else
+            {
+                DescribeSingleNaluPacket( pCtx,
+                                          pDescriptor );
+            }
+        }
+        else
+        {
+            result = DescribeFragmentationUnitPacket( pCtx,
+                                                      pDescriptor );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -5,6 +5,9 @@
 #include <stdint.h>
 #include <stddef.h>
 
+/* RTP includes. */
+#include "rtp_data_types.h"
+
 /*
  * NAL Unit (NALU) Header:
  *
@@ -16,6 +19,9 @@
  */
 #define NALU_HEADER_SIZE            1
 
+#define NALU_HEADER_F_MASK          0x80
+#define NALU_HEADER_F_LOCATION      7
+
 #define NALU_HEADER_TYPE_MASK       0x1F
 #define NALU_HEADER_TYPE_LOCATION   0
 
@@ -123,6 +129,21 @@
 
 /*-----------------------------------------------------------*/
 
+/*
+ * Maximum number of NAL units aggregated in one STAP-A packet described by
+ * H264Packetizer_GetPacketDescriptor.
+ */
+#ifndef H264_DESCRIPTOR_MAX_AGGREGATED_NALUS
+    #define H264_DESCRIPTOR_MAX_AGGREGATED_NALUS    16
+#endif
+
+/* STAP-A header and NAL unit sizes, or FU indicator and FU header. */
+#define H264_DESCRIPTOR_PREFIX_LENGTH               \
+    ( STAP_A_HEADER_SIZE +                          \
+      ( STAP_A_NALU_SIZE * H264_DESCRIPTOR_MAX_AGGREGATED_NALUS ) )
+
+/*-----------------------------------------------------------*/
+
 /* Packet properties, used in H264Depacketizer_GetPacketProperties. */
 #define H264_PACKET_PROPERTY_START_PACKET   ( 1 << 0 )
 #define H264_PACKET_PROPERTY_END_PACKET     ( 1 << 1 )
@@ -174,6 +195,16 @@ typedef struct Frame
     size_t frameDataLength;
 } Frame_t;
 
+/* A packet described as slices instead of copied. The payload is the
+ * concatenation of the slices, which point into prefix and the NALU buffers. */
+typedef struct H264PacketDescriptor
+{
+    uint8_t prefix[ H264_DESCRIPTOR_PREFIX_LENGTH ];
+    RtpIoVec_t * pSlices;
+    size_t slicesLength;     /* In: length of pSlices. Out: slices used. */
+    size_t packetDataLength; /* In: maximum packet size. Out: packet size. */
+} H264PacketDescriptor_t;
+
 /*-----------------------------------------------------------*/
 
 #endif /* H264_DATA_TYPES_H */
@@ -29,6 +29,13 @@ H264Result_t H264Depacketizer_GetNalu( H264DepacketizerContext_t * pCtx,
 H264Result_t H264Depacketizer_GetFrame( H264DepacketizerContext_t * pCtx,
                                         Frame_t * pFrame );
 
+/* Same as H264Depacketizer_GetFrame but precedes each NALU with its length in
+ * naluLengthSize (1, 2 or 4) big-endian bytes, as in AVCC/HVCC. Returns
+ * H264_RESULT_UNSUPPORTED_PACKET if a NALU is too long for the length field. */
+H264Result_t H264Depacketizer_GetFrameLengthPrefixed( H264DepacketizerContext_t * pCtx,
+                                                      Frame_t * pFrame,
+                                                      size_t naluLengthSize );
+
 H264Result_t H264Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
                                                    const size_t packetDataLength,
                                                    uint32_t * pProperties );
@@ -20,6 +20,12 @@ typedef struct H264PacketizerContext
     size_t naluCount;
     H264PacketType_t currentlyProcessingPacket;
     FuAPacketizationState_t fuAPacketizationState;
+
+    /* State of H264Packetizer_AddChunk. */
+    uint8_t * pChunkData;
+    size_t chunkDataLength;
+    size_t chunkScanIndex;
+    uint8_t chunkStartCodeFound;
 } H264PacketizerContext_t;
 
 H264Result_t H264Packetizer_Init( H264PacketizerContext_t * pCtx,
@@ -30,10 +36,34 @@ H264Result_t H264Packetizer_Init( H264PacketizerContext_t * pCtx,
 H264Result_t H264Packetizer_AddFrame( H264PacketizerContext_t * pCtx,
                                       Frame_t * pFrame );
 
+/* A part of an Annex-B frame. NALUs are added as soon as the start code
+ * following them is seen, so packets can be fetched before the rest of the
+ * frame arrives. The last NALU is added when isLastChunk is set, which may
+ * come with an empty chunk to end a frame already submitted. Chunks of a
+ * frame must be consecutive parts of one buffer, because the NALUs point into
+ * it, and the buffer must stay valid until its packets are fetched. */
+H264Result_t H264Packetizer_AddChunk( H264PacketizerContext_t * pCtx,
+                                      Frame_t * pChunk,
+                                      uint8_t isLastChunk );
+
+/* A frame comprising of multiple NALUs, each preceded by its length in
+ * naluLengthSize (1, 2 or 4) big-endian bytes, as in AVCC/HVCC. */
+H264Result_t H264Packetizer_AddFrameLengthPrefixed( H264PacketizerContext_t * pCtx,
+                                                    Frame_t * pFrame,
+                                                    size_t naluLengthSize );
+
 H264Result_t H264Packetizer_AddNalu( H264PacketizerContext_t * pCtx,
                                      Nalu_t * pNalu );
 
 H264Result_t H264Packetizer_GetPacket( H264PacketizerContext_t * pCtx,
                                        H264Packet_t * pPacket );
 
+/* Same as H264Packetizer_GetPacket but does not copy the NALU data. The packet
+ * is returned as slices in pDescriptor->pSlices which can be passed to
+ * sendmsg after the header vector from Rtp_SerializeIoVec. The slices point
+ * into the descriptor and the NALU buffers, so both must stay valid until
+ * the packet is sent. */
+H264Result_t H264Packetizer_GetPacketDescriptor( H264PacketizerContext_t * pCtx,
+                                                 H264PacketDescriptor_t * pDescriptor );
+
 #endif /* H264_PACKETIZER_H */
@@ -3,6 +3,14 @@
 
 /* API includes. */
 #include "h265_packetizer.h"
+#include "annexb_scanner.h"
+#include "rtp_endianness.h"
+
+/*-----------------------------------------------------------*/
+
+/* The NALU array is used as a ring. */
+#define WRAP_NALU_INDEX( pCtx, index ) \
+    ( ( index ) % ( pCtx )->naluArrayLength )
 
 /*-----------------------------------------------------------*/
 
@@ -16,6 +24,30 @@ static void PacketizeAggregationPacket( H265PacketizerContext_t * pCtx,
                                         size_t nalusToAggregate,
                                         H265Packet_t * pPacket );
 
+static void GetNextFragment( H265PacketizerContext_t * pCtx,
+                             size_t maxNaluDataLengthToSend,
+                             uint8_t * pFuHeaders,
+                             uint8_t ** ppNaluData,
+                             size_t * pNaluDataLength );
+
+static size_t CountNalusToAggregate( H265PacketizerContext_t * pCtx,
+                                     size_t maxPacketLength,
+                                     size_t maxNalus );
+
+static void GetAggregationHeader( H265PacketizerContext_t * pCtx,
+                                  size_t nalusToAggregate,
+                                  uint8_t * pPayloadHeader );
+
+static void DescribeSingleNaluPacket( H265PacketizerContext_t * pCtx,
+                                      H265PacketDescriptor_t * pDescriptor );
+
+static H265Result_t DescribeFragmentationUnitPacket( H265PacketizerContext_t * pCtx,
+                                                     H265PacketDescriptor_t * pDescriptor );
+
+static void DescribeAggregationPacket( H265PacketizerContext_t * pCtx,
+                                       size_t nalusToAggregate,
+                                       H265PacketDescriptor_t * pDescriptor );
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -44,7 +76,7 @@ static void PacketizeSingleNaluPacket( H265PacketizerContext_t * pCtx,
     pPacket->packetDataLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
 
     /* Move to the next NALU in the next call to H265Packetizer_GetPacket. */
-    pCtx->tailIndex += 1;
+    pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + 1 );
     pCtx->naluCount -= 1;
 }
 
@@ -54,9 +86,8 @@ static H265Result_t PacketizeFragmentationUnitPacket( H265PacketizerContext_t *
                                                       H265Packet_t * pPacket )
 {
     H265Result_t result = H265_RESULT_OK;
-    uint8_t fuHeader = 0;
-    size_t maxNaluDataLengthToSend, naluDataLengthToSend;
-    uint8_t * pNaluData = pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData;
+    uint8_t * pNaluData;
+    size_t naluDataLengthToSend;
 
     if( pPacket->packetDataLength <= FU_PAYLOAD_HEADER_SIZE + FU_HEADER_SIZE )
     {
@@ -65,76 +96,18 @@ static H265Result_t PacketizeFragmentationUnitPacket( H265PacketizerContext_t *
 
     if( result == H265_RESULT_OK )
     {
-        /* Is this the first fragment? */
-        if( pCtx->currentlyProcessingPacket == H265_PACKET_NONE )
-        {
-            pCtx->currentlyProcessingPacket = H265_FU_PACKET;
-
-            /* Construct the payload header to be sent in all the fragments. The
-             * fields F, and TID in the payload header are equal to the fields
-             * F, and TID, respectively, of the fragmented NAL unit.*/
-            pCtx->fuPacketizationState.payloadHeader[ 0 ] = ( pNaluData[ 0 ] & NALU_HEADER_F_MASK ) |
-                                                            ( FU_PACKET_TYPE << NALU_HEADER_TYPE_LOCATION );
-            pCtx->fuPacketizationState.payloadHeader[ 1 ] = pNaluData[ 1 ] & NALU_HEADER_TID_MASK;
-
-            /* Construct the FU header to be sent in all the fragments. We will
-             * still need to update S and E bit separately. */
-            pCtx->fuPacketizationState.fuHeader = ( pNaluData[ 0 ] & NALU_HEADER_TYPE_MASK ) >> NALU_HEADER_TYPE_LOCATION;
-
-            /* Per RFC https://datatracker.ietf.org/doc/html/rfc7798, we do not
-             * need to send NALU header in FU packets as the information can be
-             * constructed payload header and FU header. */
-            pCtx->fuPacketizationState.naluDataIndex = NALU_HEADER_SIZE;
-            pCtx->fuPacketizationState.remainingNaluLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength - NALU_HEADER_SIZE;
-
-            /* Indicate start fragment in the FU header. */
-            fuHeader |= FU_HEADER_S_BIT_MASK;
-        }
-
-        /* Set type in FU header. */
-        fuHeader |= pCtx->fuPacketizationState.fuHeader;
-
-        /* Maximum NALU data that we can send in this packet. */
-        maxNaluDataLengthToSend = pPacket->packetDataLength - FU_PAYLOAD_HEADER_SIZE - FU_HEADER_SIZE;
-        /* Actual NALU data what we will send in this packet. */
-        naluDataLengthToSend = H265_MIN( maxNaluDataLengthToSend,
-                                         pCtx->fuPacketizationState.remainingNaluLength );
-
-        if( pCtx->fuPacketizationState.remainingNaluLength == naluDataLengthToSend )
-        {
-            /* Indicate end fragment in the FU header. */
-            fuHeader |= FU_HEADER_E_BIT_MASK;
-        }
-
-        /* Write payload header. */
-        memcpy( ( void * ) &( pPacket->pPacketData[ 0 ] ),
-                ( const void * ) &( pCtx->fuPacketizationState.payloadHeader[ 0 ] ),
-                FU_PAYLOAD_HEADER_SIZE );
-
-        /* Write FU header. */
-        pPacket->pPacketData[ FU_HEADER_OFFSET ] = fuHeader;
+        /* Write payload header and FU header. */
+        GetNextFragment( pCtx,
+                         pPacket->packetDataLength - FU_PAYLOAD_HEADER_SIZE - FU_HEADER_SIZE,
+                         &( pPacket->pPacketData[ 0 ] ),
+                         &( pNaluData ),
+                         &( naluDataLengthToSend ) );
 
         /* Write NALU data. */
         memcpy( ( void * ) &( pPacket->pPacketData[ FU_PAYLOAD_HEADER_SIZE + FU_HEADER_SIZE ] ),
-                ( const void * ) &( pNaluData[ pCtx->fuPacketizationState.naluDataIndex ] ),
+                ( const void * ) pNaluData,
                 naluDataLengthToSend );
         pPacket->packetDataLength = naluDataLengthToSend + FU_PAYLOAD_HEADER_SIZE + FU_HEADER_SIZE;
-
-        pCtx->fuPacketizationState.naluDataIndex += naluDataLengthToSend;
-        pCtx->fuPacketizationState.remainingNaluLength -= naluDataLengthToSend;
-
-        if( pCtx->fuPacketizationState.remainingNaluLength == 0 )
-        {
-            /* Reset state. */
-            memset( &( pCtx->fuPacketizationState ),
-                    0,
-                    sizeof( FuPacketizationState_t ) );
-            pCtx->currentlyProcessingPacket = H265_PACKET_NONE;
-
-            /* Move to the next NALU in the next call to H265Packetizer_GetPacket. */
-            pCtx->tailIndex += 1;
-            pCtx->naluCount -= 1;
-        }
     }
 
     return result;
@@ -148,28 +121,22 @@ static void PacketizeAggregationPacket( H265PacketizerContext_t * pCtx,
 {
     size_t i, packetWriteIndex = 0, naluSize;
     uint8_t * pNaluData;
-    uint8_t temporalId, minTemporalId = 0xFF;
 
     /* Write payload header. */
-    pPacket->pPacketData[ 0 ] = AP_PACKET_TYPE << NALU_HEADER_TYPE_LOCATION;
-    pPacket->pPacketData[ 1 ] = 0;
-    packetWriteIndex += 2;
+    GetAggregationHeader( pCtx,
+                          nalusToAggregate,
+                          &( pPacket->pPacketData[ 0 ] ) );
+    packetWriteIndex += AP_HEADER_SIZE;
 
     /* Aggregate all the NAL units in the packet. */
     for( i = 0; i < nalusToAggregate; i++ )
     {
-        pNaluData = pCtx->pNaluArray[ pCtx->tailIndex + i ].pNaluData;
-        naluSize = pCtx->pNaluArray[ pCtx->tailIndex + i ].naluDataLength;
-
-        temporalId = ( pNaluData[ 1 ] & NALU_HEADER_TID_MASK ) >> NALU_HEADER_TID_LOCATION;
-        minTemporalId = H265_MIN( minTemporalId, temporalId );
-
-        /* Update F bit in the payload header. */
-        pPacket->pPacketData[ 0 ] |= ( pNaluData[ 0 ] & NALU_HEADER_F_MASK );
+        pNaluData = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].pNaluData;
+        naluSize = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].naluDataLength;
 
         /* Write NAL unit size. */
-        pPacket->pPacketData[ packetWriteIndex ] = ( naluSize >> 8 ) & 0xFF;
-        pPacket->pPacketData[ packetWriteIndex + 1 ] = naluSize & 0xFF;
+        Rtp_WriteUint16( &( pPacket->pPacketData[ packetWriteIndex ] ),
+                         ( uint16_t ) naluSize );
         packetWriteIndex += 2;
 
         /* Write NAL unit data. */
@@ -179,10 +146,7 @@ static void PacketizeAggregationPacket( H265PacketizerContext_t * pCtx,
         packetWriteIndex += naluSize;
     }
 
-    /* Write TID in the payload header. */
-    pPacket->pPacketData[ 1 ] |= ( minTemporalId << NALU_HEADER_TID_LOCATION );
-
-    pCtx->tailIndex += nalusToAggregate;
+    pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + nalusToAggregate );
     pCtx->naluCount -= nalusToAggregate;
 
     pPacket->packetDataLength = packetWriteIndex;
@@ -190,6 +154,229 @@ static void PacketizeAggregationPacket( H265PacketizerContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+static void GetNextFragment( H265PacketizerContext_t * pCtx,
+                             size_t maxNaluDataLengthToSend,
+                             uint8_t * pFuHeaders,
+                             uint8_t ** ppNaluData,
+                             size_t * pNaluDataLength )
+{
+    uint8_t fuHeader = 0;
+    size_t naluDataLengthToSend;
+    uint8_t * pNaluData = pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData;
+
+    /* Is this the first fragment? */
+    if( pCtx->currentlyProcessingPacket == H265_PACKET_NONE )
+    {
+        pCtx->currentlyProcessingPacket = H265_FU_PACKET;
+
+        /* Construct the payload header to be sent in all the fragments. The
+         * fields F, and TID in the payload header are equal to the fields
+         * F, and TID, respectively, of the fragmented NAL unit.*/
+        pCtx->fuPacketizationState.payloadHeader[ 0 ] = ( pNaluData[ 0 ] & NALU_HEADER_F_MASK ) |
+                                                        ( FU_PACKET_TYPE << NALU_HEADER_TYPE_LOCATION );
+        pCtx->fuPacketizationState.payloadHeader[ 1 ] = pNaluData[ 1 ] & NALU_HEADER_TID_MASK;
+
+        /* Construct the FU header to be sent in all the fragments. We will
+         * still need to update S and E bit separately. */
+        pCtx->fuPacketizationState.fuHeader = ( pNaluData[ 0 ] & NALU_HEADER_TYPE_MASK ) >> NALU_HEADER_TYPE_LOCATION;
+
+        /* Per RFC https://datatracker.ietf.org/doc/html/rfc7798, we do not
+         * need to send NALU header in FU packets as the information can be
+         * constructed payload header and FU header. */
+        pCtx->fuPacketizationState.naluDataIndex = NALU_HEADER_SIZE;
+        pCtx->fuPacketizationState.remainingNaluLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength - NALU_HEADER_SIZE;
+
+        /* Indicate start fragment in the FU header. */
+        fuHeader |= FU_HEADER_S_BIT_MASK;
+    }
+
+    /* Set type in FU header. */
+    fuHeader |= pCtx->fuPacketizationState.fuHeader;
+
+    /* Actual NALU data what we will send in this packet. */
+    naluDataLengthToSend = H265_MIN( maxNaluDataLengthToSend,
+                                     pCtx->fuPacketizationState.remainingNaluLength );
+
+    if( pCtx->fuPacketizationState.remainingNaluLength == naluDataLengthToSend )
+    {
+        /* Indicate end fragment in the FU header. */
+        fuHeader |= FU_HEADER_E_BIT_MASK;
+    }
+
+    /* Write payload header. */
+    memcpy( ( void * ) &( pFuHeaders[ 0 ] ),
+            ( const void * ) &( pCtx->fuPacketizationState.payloadHeader[ 0 ] ),
+            FU_PAYLOAD_HEADER_SIZE );
+
+    /* Write FU header. */
+    pFuHeaders[ FU_HEADER_OFFSET ] = fuHeader;
+
+    *ppNaluData = &( pNaluData[ pCtx->fuPacketizationState.naluDataIndex ] );
+    *pNaluDataLength = naluDataLengthToSend;
+
+    pCtx->fuPacketizationState.naluDataIndex += naluDataLengthToSend;
+    pCtx->fuPacketizationState.remainingNaluLength -= naluDataLengthToSend;
+
+    if( pCtx->fuPacketizationState.remainingNaluLength == 0 )
+    {
+        /* Reset state. */
+        memset( &( pCtx->fuPacketizationState ),
+                0,
+                sizeof( FuPacketizationState_t ) );
+        pCtx->currentlyProcessingPacket = H265_PACKET_NONE;
+
+        /* Move to the next NALU in the next call to H265Packetizer_GetPacket. */
+        pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + 1 );
+        pCtx->naluCount -= 1;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t CountNalusToAggregate( H265PacketizerContext_t * pCtx,
+                                     size_t maxPacketLength,
+                                     size_t maxNalus )
+{
+    size_t i, naluSize, aggregatePacketSize = AP_HEADER_SIZE, nalusToAggregate = 0;
+
+    for( i = 0; i < H265_MIN( pCtx->naluCount, maxNalus ); i++ )
+    {
+        naluSize = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].naluDataLength;
+
+        /* Can we fit in this NAL unit? */
+        if( ( aggregatePacketSize + AP_NALU_LENGTH_FIELD_SIZE + naluSize ) <= maxPacketLength )
+        {
+            aggregatePacketSize += ( AP_NALU_LENGTH_FIELD_SIZE + naluSize );
+            nalusToAggregate += 1;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return nalusToAggregate;
+}
+
+/*-----------------------------------------------------------*/
+
+static void GetAggregationHeader( H265PacketizerContext_t * pCtx,
+                                  size_t nalusToAggregate,
+                                  uint8_t * pPayloadHeader )
+{
+    size_t i;
+    uint8_t * pNaluData;
+    uint8_t temporalId, minTemporalId = 0xFF;
+
+    pPayloadHeader[ 0 ] = AP_PACKET_TYPE << NALU_HEADER_TYPE_LOCATION;
+    pPayloadHeader[ 1 ] = 0;
+
+    for( i = 0; i < nalusToAggregate; i++ )
+    {
+        pNaluData = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].pNaluData;
+
+        temporalId = ( pNaluData[ 1 ] & NALU_HEADER_TID_MASK ) >> NALU_HEADER_TID_LOCATION;
+        minTemporalId = H265_MIN( minTemporalId, temporalId );
+
+        /* Update F bit in the payload header. */
+        pPayloadHeader[ 0 ] |= ( pNaluData[ 0 ] & NALU_HEADER_F_MASK );
+    }
+
+    /* Write TID in the payload header. */
+    pPayloadHeader[ 1 ] |= ( minTemporalId << NALU_HEADER_TID_LOCATION );
+}
+
+/*-----------------------------------------------------------*/
+
+static void DescribeSingleNaluPacket( H265PacketizerContext_t * pCtx,
+                                      H265PacketDescriptor_t * pDescriptor )
+{
+    pDescriptor->pSlices[ 0 ].pBase = pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData;
+    pDescriptor->pSlices[ 0 ].length = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
+    pDescriptor->slicesLength = 1;
+    pDescriptor->packetDataLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
+
+    /* Move to the next NALU in the next call to H265Packetizer_GetPacketDescriptor. */
+    pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + 1 );
+    pCtx->naluCount -= 1;
+}
+
+/*-----------------------------------------------------------*/
+
+static H265Result_t DescribeFragmentationUnitPacket( H265PacketizerContext_t * pCtx,
+                                                     H265PacketDescriptor_t * pDescriptor )
+{
+    H265Result_t result = H265_RESULT_OK;
+    uint8_t * pNaluData;
+    size_t naluDataLengthToSend;
+
+    /* Payload header and FU header in the prefix, FU payload in the NALU. */
+    if( ( pDescriptor->slicesLength < 2 ) ||
+        ( pDescriptor->packetDataLength <= FU_PAYLOAD_HEADER_SIZE + FU_HEADER_SIZE ) )
+    {
+        result = H265_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        GetNextFragment( pCtx,
+                         pDescriptor->packetDataLength - FU_PAYLOAD_HEADER_SIZE - FU_HEADER_SIZE,
+                         &( pDescriptor->prefix[ 0 ] ),
+                         &( pNaluData ),
+                         &( naluDataLengthToSend ) );
+
+        pDescriptor->pSlices[ 0 ].pBase = &( pDescriptor->prefix[ 0 ] );
+        pDescriptor->pSlices[ 0 ].length = FU_PAYLOAD_HEADER_SIZE + FU_HEADER_SIZE;
+        pDescriptor->pSlices[ 1 ].pBase = pNaluData;
+        pDescriptor->pSlices[ 1 ].length = naluDataLengthToSend;
+        pDescriptor->slicesLength = 2;
+        pDescriptor->packetDataLength = naluDataLengthToSend + FU_PAYLOAD_HEADER_SIZE + FU_HEADER_SIZE;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void DescribeAggregationPacket( H265PacketizerContext_t * pCtx,
+                                       size_t nalusToAggregate,
+                                       H265PacketDescriptor_t * pDescriptor )
+{
+    size_t i, prefixIndex = AP_HEADER_SIZE, naluSize, packetLength = AP_HEADER_SIZE;
+
+    GetAggregationHeader( pCtx,
+                          nalusToAggregate,
+                          &( pDescriptor->prefix[ 0 ] ) );
+
+    /* Each NAL unit takes two slices - its size in the prefix and its data.
+     * The first size slice also carries the payload header. */
+    for( i = 0; i < nalusToAggregate; i++ )
+    {
+        naluSize = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].naluDataLength;
+
+        Rtp_WriteUint16( &( pDescriptor->prefix[ prefixIndex ] ),
+                         ( uint16_t ) naluSize );
+
+        pDescriptor->pSlices[ 2 * i ].pBase = ( i == 0 ) ? &( pDescriptor->prefix[ 0 ] ) :
+                                              &( pDescriptor->prefix[ prefixIndex ] );
+        pDescriptor->pSlices[ 2 * i ].length = ( i == 0 ) ? ( AP_HEADER_SIZE + AP_NALU_LENGTH_FIELD_SIZE ) :
+                                               AP_NALU_LENGTH_FIELD_SIZE;
+        pDescriptor->pSlices[ ( 2 * i ) + 1 ].pBase = pCtx->pNaluArray[ WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + i ) ].pNaluData;
+        pDescriptor->pSlices[ ( 2 * i ) + 1 ].length = naluSize;
+
+        prefixIndex += AP_NALU_LENGTH_FIELD_SIZE;
+        packetLength += AP_NALU_LENGTH_FIELD_SIZE + naluSize;
+    }
+
+    pDescriptor->slicesLength = 2 * nalusToAggregate;
+    pDescriptor->packetDataLength = packetLength;
+
+    pCtx->tailIndex = WRAP_NALU_INDEX( pCtx, pCtx->tailIndex + nalusToAggregate );
+    pCtx->naluCount -= nalusToAggregate;
+}
+
+/*-----------------------------------------------------------*/
+
 H265Result_t H265Packetizer_Init( H265PacketizerContext_t * pCtx,
                                   H265Nalu_t * pNaluArray,
                                   size_t naluArrayLength )
@@ -217,6 +404,11 @@ H265Result_t H265Packetizer_Init( H265PacketizerContext_t * pCtx,
         memset( &( pCtx->fuPacketizationState ),
                 0,
                 sizeof( FuPacketizationState_t ) );
+
+        pCtx->pChunkData = NULL;
+        pCtx->chunkDataLength = 0;
+        pCtx->chunkScanIndex = 0;
+        pCtx->chunkStartCodeFound = 0;
     }
 
     return result;
@@ -229,9 +421,7 @@ H265Result_t H265Packetizer_AddFrame( H265PacketizerContext_t * pCtx,
 {
     H265Result_t result = H265_RESULT_OK;
     H265Nalu_t nalu = { 0 };
-    size_t currentIndex = 0, naluStartIndex = 0, remainingFrameLength = 0;
-    const uint8_t startCode1[] = { 0x00, 0x00, 0x00, 0x01 }; /* 4-byte start code. */
-    const uint8_t startCode2[] = { 0x00, 0x00, 0x01 }; /* 3-byte start code. */
+    size_t currentIndex = 0, naluStartIndex = 0, startCodeIndex = 0, startCodeLength = 0;
     uint8_t firstStartCode = 1;
 
     if( ( pCtx == NULL ) ||
@@ -245,63 +435,34 @@ H265Result_t H265Packetizer_AddFrame( H265PacketizerContext_t * pCtx,
     while( ( result == H265_RESULT_OK ) &&
            ( currentIndex < pFrame->frameDataLength ) )
     {
-        remainingFrameLength = pFrame->frameDataLength - currentIndex;
+        startCodeIndex = currentIndex + AnnexB_FindStartCode( &( pFrame->pFrameData[ currentIndex ] ),
+                                                              pFrame->frameDataLength - currentIndex,
+                                                              &( startCodeLength ) );
 
-        /* Check the presence of 4 byte start code. */
-        if( remainingFrameLength >= sizeof( startCode1 ) )
+        if( startCodeLength == 0 )
         {
-            if( memcmp( &( pFrame->pFrameData[ currentIndex ] ),
-                        &( startCode1[ 0 ] ),
-                        sizeof( startCode1 ) ) == 0 )
-            {
-                if( firstStartCode == 1 )
-                {
-                    firstStartCode = 0;
-                }
-                else
-                {
-                    /* Create NAL unit from data between start codes. */
-                    nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
-                    nalu.naluDataLength = currentIndex - naluStartIndex;
-
-                    result = H265Packetizer_AddNalu( pCtx,
-                                                     &( nalu ) );
-                }
-
-                naluStartIndex = currentIndex + sizeof( startCode1 );
-                currentIndex = naluStartIndex;
-                continue;
-            }
+            /* No more start codes. */
+            currentIndex = pFrame->frameDataLength;
         }
-
-        /* Check the presence of 3 byte start code. */
-        if( remainingFrameLength >= sizeof( startCode2 ) )
+        else
         {
-            if( memcmp( &( pFrame->pFrameData[ currentIndex ] ),
-                        &( startCode2[ 0 ] ),
-                        sizeof( startCode2 ) ) == 0 )
+            if( firstStartCode == 1 )
             {
-                if( firstStartCode == 1 )
-                {
-                    firstStartCode = 0;
-                }
-                else
-                {
-                    /* Create NAL unit from data between start codes. */
-                    nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
-                    nalu.naluDataLength = currentIndex - naluStartIndex;
-
-                    result = H265Packetizer_AddNalu( pCtx,
-                                                     &( nalu ) );
-                }
+                firstStartCode = 0;
+            }
+            else
+            {
+                /* Create NAL unit from data between start codes. */
+                nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
+                nalu.naluDataLength = startCodeIndex - naluStartIndex;
 
-                naluStartIndex = currentIndex + sizeof( startCode2 );
-                currentIndex = naluStartIndex;
-                continue;
+                result = H265Packetizer_AddNalu( pCtx,
+                                                 &( nalu ) );
             }
-        }
 
-        currentIndex += 1;
+            naluStartIndex = startCodeIndex + startCodeLength;
+            currentIndex = naluStartIndex;
+        }
     }
 
     /* Handle last NAL unit in frame. */
@@ -326,6 +487,190 @@ H265Result_t H265Packetizer_AddFrame( H265PacketizerContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+H265Result_t H265Packetizer_AddChunk( H265PacketizerContext_t * pCtx,
+                                      H265Frame_t * pChunk,
+                                      uint8_t isLastChunk )
+{
+    H265Result_t result = H265_RESULT_OK;
+    H265Nalu_t nalu;
+    size_t startCodeIndex = 0, startCodeLength = 0;
+    uint8_t scanComplete = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pChunk == NULL ) ||
+        ( ( pChunk->pFrameData == NULL ) && ( pChunk->frameDataLength > 0 ) ) ||
+        ( ( pChunk->frameDataLength == 0 ) && ( isLastChunk == 0 ) ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        if( pChunk->frameDataLength == 0 )
+        {
+            /* An empty last chunk only ends the frame. */
+            scanComplete = 1;
+        }
+        else if( pCtx->pChunkData == NULL )
+        {
+            pCtx->pChunkData = pChunk->pFrameData;
+            pCtx->chunkDataLength = 0;
+            pCtx->chunkScanIndex = 0;
+            pCtx->chunkStartCodeFound = 0;
+        }
+        else if( pChunk->pFrameData != &( pCtx->pChunkData[ pCtx->chunkDataLength ] ) )
+        {
+            /* Chunks must be consecutive parts of one buffer. */
+            result = H265_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        pCtx->chunkDataLength += pChunk->frameDataLength;
+    }
+
+    while( ( result == H265_RESULT_OK ) &&
+           ( scanComplete == 0 ) )
+    {
+        startCodeIndex = pCtx->chunkScanIndex +
+                         AnnexB_FindStartCode( &( pCtx->pChunkData[ pCtx->chunkScanIndex ] ),
+                                               pCtx->chunkDataLength - pCtx->chunkScanIndex,
+                                               &( startCodeLength ) );
+
+        if( startCodeLength == 0 )
+        {
+            /* A start code may be split across chunks. Rescan the last 3
+             * bytes, which also keeps the zero byte of a 4-byte start code,
+             * with the next chunk. */
+            if( ( pCtx->chunkDataLength - pCtx->chunkScanIndex ) > 3 )
+            {
+                pCtx->chunkScanIndex = pCtx->chunkDataLength - 3;
+            }
+
+            scanComplete = 1;
+        }
+        else
+        {
+            if( pCtx->chunkStartCodeFound == 0 )
+            {
+                pCtx->chunkStartCodeFound = 1;
+            }
+            else
+            {
+                /* The NAL unit ends at this start code. */
+                nalu.pNaluData = pCtx->pChunkData;
+                nalu.naluDataLength = startCodeIndex;
+
+                result = H265Packetizer_AddNalu( pCtx,
+                                                 &( nalu ) );
+            }
+
+            pCtx->pChunkData = &( pCtx->pChunkData[ startCodeIndex + startCodeLength ] );
+            pCtx->chunkDataLength -= startCodeIndex + startCodeLength;
+            pCtx->chunkScanIndex = 0;
+        }
+    }
+
+    /* The last NAL unit ends with the last chunk. */
+    if( ( result == H265_RESULT_OK ) &&
+        ( isLastChunk != 0 ) )
+    {
+        if( pCtx->chunkStartCodeFound != 0 )
+        {
+            nalu.pNaluData = pCtx->pChunkData;
+            nalu.naluDataLength = pCtx->chunkDataLength;
+
+            result = H265Packetizer_AddNalu( pCtx,
+                                             &( nalu ) );
+        }
+        else
+        {
+            result = H265_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    /* Start afresh with the next chunk after the frame ends or fails. */
+    if( ( pCtx != NULL ) &&
+        ( ( result != H265_RESULT_OK ) || ( isLastChunk != 0 ) ) )
+    {
+        pCtx->pChunkData = NULL;
+        pCtx->chunkDataLength = 0;
+        pCtx->chunkScanIndex = 0;
+        pCtx->chunkStartCodeFound = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Packetizer_AddFrameLengthPrefixed( H265PacketizerContext_t * pCtx,
+                                                    H265Frame_t * pFrame,
+                                                    size_t naluLengthSize )
+{
+    H265Result_t result = H265_RESULT_OK;
+    H265Nalu_t nalu;
+    size_t currentIndex = 0, naluLength = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) ||
+        ( ( naluLengthSize != 1 ) &&
+          ( naluLengthSize != 2 ) &&
+          ( naluLengthSize != 4 ) ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    while( ( result == H265_RESULT_OK ) &&
+           ( currentIndex < pFrame->frameDataLength ) )
+    {
+        if( ( pFrame->frameDataLength - currentIndex ) < naluLengthSize )
+        {
+            result = H265_RESULT_MALFORMED_PACKET;
+        }
+        else
+        {
+            if( naluLengthSize == 1 )
+            {
+                naluLength = pFrame->pFrameData[ currentIndex ];
+            }
+            else if( naluLengthSize == 2 )
+            {
+                naluLength = Rtp_ReadUint16( &( pFrame->pFrameData[ currentIndex ] ) );
+            }
+            else
+            {
+                naluLength = Rtp_ReadUint32( &( pFrame->pFrameData[ currentIndex ] ) );
+            }
+
+            currentIndex += naluLengthSize;
+
+            if( ( naluLength == 0 ) ||
+                ( naluLength > ( pFrame->frameDataLength - currentIndex ) ) )
+            {
+                result = H265_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                nalu.pNaluData = &( pFrame->pFrameData[ currentIndex ] );
+                nalu.naluDataLength = naluLength;
+
+                result = H265Packetizer_AddNalu( pCtx,
+                                                 &( nalu ) );
+
+                currentIndex += naluLength;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
 H265Result_t H265Packetizer_AddNalu( H265PacketizerContext_t * pCtx,
                                      H265Nalu_t * pNalu )
 {
@@ -359,7 +704,7 @@ H265Result_t H265Packetizer_AddNalu( H265PacketizerContext_t * pCtx,
         pCtx->pNaluArray[ pCtx->headIndex ].pNaluData = pNalu->pNaluData;
         pCtx->pNaluArray[ pCtx->headIndex ].naluDataLength = pNalu->naluDataLength;
 
-        pCtx->headIndex += 1;
+        pCtx->headIndex = WRAP_NALU_INDEX( pCtx, pCtx->headIndex + 1 );
         pCtx->naluCount += 1;
     }
 
@@ -372,8 +717,7 @@ H265Result_t H265Packetizer_GetPacket( H265PacketizerContext_t * pCtx,
                                        H265Packet_t * pPacket )
 {
     H265Result_t result = H265_RESULT_OK;
-    size_t aggregatePacketSize = 0, nalusToAggregate = 0;
-    size_t i, naluSize;
+    size_t nalusToAggregate = 0;
 
     if( ( pCtx == NULL ) ||
         ( pPacket == NULL ) ||
@@ -408,22 +752,9 @@ H265Result_t H265Packetizer_GetPacket( H265PacketizerContext_t * pCtx,
             if( pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength <= pPacket->packetDataLength )
             {
                 /* Can we aggregate more than one NAL units? */
-                aggregatePacketSize = AP_HEADER_SIZE;
-                for( i = 0; i < pCtx->naluCount; i++ )
-                {
-                    naluSize = pCtx->pNaluArray[ pCtx->tailIndex + i ].naluDataLength;
-
-                    /* Can we fit in this NAL unit? */
-                    if( ( aggregatePacketSize + AP_NALU_LENGTH_FIELD_SIZE + naluSize ) <= pPacket->packetDataLength )
-                    {
-                        aggregatePacketSize += ( AP_NALU_LENGTH_FIELD_SIZE + naluSize );
-                        nalusToAggregate += 1;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
+                nalusToAggregate = CountNalusToAggregate( pCtx,
+                                                          pPacket->packetDataLength,
+                                                          pCtx->naluCount );
 
                 /* If we can aggregate more than one NAL units, use Aggregation Packet. */
                 if( nalusToAggregate > 1 )
@@ -452,3 +783,66 @@ H265Result_t H265Packetizer_GetPacket( H265PacketizerContext_t * pCtx,
 }
 
 /*-----------------------------------------------------------*/
+
+H265Result_t H265Packetizer_GetPacketDescriptor( H265PacketizerContext_t * pCtx,
+                                                 H265PacketDescriptor_t * pDescriptor )
+{
+    H265Result_t result = H265_RESULT_OK;
+    size_t nalusToAggregate = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pDescriptor == NULL ) ||
+        ( pDescriptor->pSlices == NULL ) ||
+        ( pDescriptor->slicesLength == 0 ) ||
+        ( pDescriptor->packetDataLength < NALU_HEADER_SIZE + 1 ) ) /* Minimum size for any packet. */
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        if( pCtx->naluCount == 0 )
+        {
+            result = H265_RESULT_NO_MORE_PACKETS;
+        }
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        /* Are we in the middle of packetizing fragments of a NALU? */
+        if( pCtx->currentlyProcessingPacket == H265_FU_PACKET )
+        {
+            result = DescribeFragmentationUnitPacket( pCtx,
+                                                      pDescriptor );
+        }
+        else if( pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength <= pDescriptor->packetDataLength )
+        {
+            /* Aggregation is limited by the slices and the prefix. */
+            nalusToAggregate = CountNalusToAggregate( pCtx,
+                                                      pDescriptor->packetDataLength,
+                                                      H265_MIN( pDescriptor->slicesLength / 2,
+                                                                H265_DESCRIPTOR_MAX_AGGREGATED_NALUS ) );
+
+            if( nalusToAggregate > 1 )
+            {
+                DescribeAggregationPacket( pCtx,
+                                           nalusToAggregate,
+                                           pDescriptor );
+            }
+            else
+            {
+                DescribeSingleNaluPacket( pCtx,
+                                          pDescriptor );
+            }
+        }
+        else
+        {
+            result = DescribeFragmentationUnitPacket( pCtx,
+                                                      pDescriptor );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -5,6 +5,9 @@
 #include <stdint.h>
 #include <stddef.h>
 
+/* RTP includes. */
+#include "rtp_data_types.h"
+
 /*
  * NAL Unit (NALU) Header for H.265:
  *
@@ -111,6 +114,21 @@
 
 /*-----------------------------------------------------------*/
 
+/*
+ * Maximum number of NAL units aggregated in one AP packet described by
+ * H265Packetizer_GetPacketDescriptor.
+ */
+#ifndef H265_DESCRIPTOR_MAX_AGGREGATED_NALUS
+    #define H265_DESCRIPTOR_MAX_AGGREGATED_NALUS    16
+#endif
+
+/* AP payload header and NAL unit sizes, or FU payload header and FU header. */
+#define H265_DESCRIPTOR_PREFIX_LENGTH               \
+    ( AP_HEADER_SIZE +                              \
+      ( AP_NALU_LENGTH_FIELD_SIZE * H265_DESCRIPTOR_MAX_AGGREGATED_NALUS ) )
+
+/*-----------------------------------------------------------*/
+
 /* Packet properties, used in H265Depacketizer_GetPacketProperties. */
 #define H265_PACKET_PROPERTY_START_PACKET    ( 1 << 0 )
 #define H265_PACKET_PROPERTY_END_PACKET      ( 1 << 1 )
@@ -163,6 +181,16 @@ typedef struct H265Frame
     size_t frameDataLength;
 } H265Frame_t;
 
+/* A packet described as slices instead of copied. The payload is the
+ * concatenation of the slices, which point into prefix and the NALU buffers. */
+typedef struct H265PacketDescriptor
+{
+    uint8_t prefix[ H265_DESCRIPTOR_PREFIX_LENGTH ];
+    RtpIoVec_t * pSlices;
+    size_t slicesLength;     /* In: length of pSlices. Out: slices used. */
+    size_t packetDataLength; /* In: maximum packet size. Out: packet size. */
+} H265PacketDescriptor_t;
+
 /*-----------------------------------------------------------*/
 
 #endif /* H265_DATA_TYPES_H */
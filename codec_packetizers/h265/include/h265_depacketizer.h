@@ -28,6 +28,13 @@ H265Result_t H265Depacketizer_GetNalu( H265DepacketizerContext_t * pCtx,
 H265Result_t H265Depacketizer_GetFrame( H265DepacketizerContext_t * pCtx,
                                         H265Frame_t * pFrame );
 
+/* Same as H265Depacketizer_GetFrame but precedes each NALU with its length in
+ * naluLengthSize (1, 2 or 4) big-endian bytes, as in AVCC/HVCC. Returns
+ * H265_RESULT_UNSUPPORTED_PACKET if a NALU is too long for the length field. */
+H265Result_t H265Depacketizer_GetFrameLengthPrefixed( H265DepacketizerContext_t * pCtx,
+                                                      H265Frame_t * pFrame,
+                                                      size_t naluLengthSize );
+
 H265Result_t H265Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
                                                    const size_t packetDataLength,
                                                    uint32_t * pProperties );
@@ -22,6 +22,12 @@ typedef struct H265PacketizerContext
 
     H265PacketType_t currentlyProcessingPacket;
     FuPacketizationState_t fuPacketizationState;
+
+    /* State of H265Packetizer_AddChunk. */
+    uint8_t * pChunkData;
+    size_t chunkDataLength;
+    size_t chunkScanIndex;
+    uint8_t chunkStartCodeFound;
 } H265PacketizerContext_t;
 
 /* Function declarations. */
@@ -32,10 +38,34 @@ H265Result_t H265Packetizer_Init( H265PacketizerContext_t * pCtx,
 H265Result_t H265Packetizer_AddFrame( H265PacketizerContext_t * pCtx,
                                       H265Frame_t * pFrame );
 
+/* A part of an Annex-B frame. NALUs are added as soon as the start code
+ * following them is seen, so packets can be fetched before the rest of the
+ * frame arrives. The last NALU is added when isLastChunk is set, which may
+ * come with an empty chunk to end a frame already submitted. Chunks of a
+ * frame must be consecutive parts of one buffer, because the NALUs point into
+ * it, and the buffer must stay valid until its packets are fetched. */
+H265Result_t H265Packetizer_AddChunk( H265PacketizerContext_t * pCtx,
+                                      H265Frame_t * pChunk,
+                                      uint8_t isLastChunk );
+
+/* A frame comprising of multiple NALUs, each preceded by its length in
+ * naluLengthSize (1, 2 or 4) big-endian bytes, as in AVCC/HVCC. */
+H265Result_t H265Packetizer_AddFrameLengthPrefixed( H265PacketizerContext_t * pCtx,
+                                                    H265Frame_t * pFrame,
+                                                    size_t naluLengthSize );
+
 H265Result_t H265Packetizer_AddNalu( H265PacketizerContext_t * pCtx,
                                      H265Nalu_t * pNalu );
 
 H265Result_t H265Packetizer_GetPacket( H265PacketizerContext_t * pCtx,
                                        H265Packet_t * pPacket );
 
+/* Same as H265Packetizer_GetPacket but does not copy the NALU data. The packet
+ * is returned as slices in pDescriptor->pSlices which can be passed to
+ * sendmsg after the header vector from Rtp_SerializeIoVec. The slices point
+ * into the descriptor and the NALU buffers, so both must stay valid until
+ * the packet is sent. */
+H265Result_t H265Packetizer_GetPacketDescriptor( H265PacketizerContext_t * pCtx,
+                                                 H265PacketDescriptor_t * pDescriptor );
+
 #endif /* H265_PACKETIZER_H */
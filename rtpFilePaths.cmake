@@ -5,6 +5,7 @@
 # RTP library source files.
 file( GLOB RTP_SOURCES
      "${CMAKE_CURRENT_LIST_DIR}/source/*.c"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/common/*.c"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/g711/*.c"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h264/*.c"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h265/*.c"
@@ -14,6 +15,7 @@ file( GLOB RTP_SOURCES
 # RTP library Public Include directories.
 set( RTP_INCLUDE_PUBLIC_DIRS
      "${CMAKE_CURRENT_LIST_DIR}/source/include"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/common/include"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/g711/include"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h264/include"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h265/include"
@@ -23,6 +25,7 @@ set( RTP_INCLUDE_PUBLIC_DIRS
 # RTP library public include header files.
 file( GLOB RTP_INCLUDE_PUBLIC_FILES
      "${CMAKE_CURRENT_LIST_DIR}/source/include/*.h"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/common/include/*.h"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/g711/include/*.h"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h264/include/*.h"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h265/include/*.h"
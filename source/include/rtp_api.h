@@ -11,9 +11,69 @@ RtpResult_t Rtp_Serialize( RtpContext_t * pCtx,
                            uint8_t * pBuffer,
                            size_t * pLength );
 
+/* Serializes only the header in pHeaderBuffer and fills RTP_IOVEC_COUNT
+ * entries in pIoVecArray - the header and the caller's payload, which is not
+ * copied. The result can be passed directly to sendmsg/sendmmsg. */
+RtpResult_t Rtp_SerializeIoVec( RtpContext_t * pCtx,
+                                const RtpPacket_t * pRtpPacket,
+                                uint8_t * pHeaderBuffer,
+                                size_t headerBufferLength,
+                                RtpIoVec_t * pIoVecArray );
+
 RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
                              uint8_t * pSerializedPacket,
                              size_t serializedPacketLength,
                              RtpPacket_t * pRtpPacket );
 
+/* Same as Rtp_DeSerialize but does not modify the serialized packet, so the
+ * same buffer can be parsed by multiple readers concurrently. */
+RtpResult_t Rtp_DeSerializeView( RtpContext_t * pCtx,
+                                 const uint8_t * pSerializedPacket,
+                                 size_t serializedPacketLength,
+                                 RtpPacketView_t * pView );
+
+RtpResult_t Rtp_GetCsrc( RtpContext_t * pCtx,
+                         const RtpPacketView_t * pView,
+                         size_t index,
+                         uint32_t * pCsrc );
+
+RtpResult_t Rtp_GetExtensionPayloadWord( RtpContext_t * pCtx,
+                                         const RtpPacketView_t * pView,
+                                         size_t index,
+                                         uint32_t * pWord );
+
+/* The Rtp_Peek* functions read the fixed header directly from the packet
+ * bytes for fast classification of received packets. They do not need a
+ * context. */
+RtpResult_t Rtp_PeekHeader( const uint8_t * pSerializedPacket,
+                            size_t serializedPacketLength,
+                            RtpFixedHeader_t * pHeader );
+
+/* Same as Rtp_PeekHeader and also returns the offset and length of the
+ * payload after skipping CSRCs and extension, and removing padding. */
+RtpResult_t Rtp_PeekPayloadOffset( const uint8_t * pSerializedPacket,
+                                   size_t serializedPacketLength,
+                                   RtpFixedHeader_t * pHeader,
+                                   size_t * pPayloadOffset,
+                                   size_t * pPayloadLength );
+
+/* Only checks the packet length. */
+RtpResult_t Rtp_PeekSsrc( const uint8_t * pSerializedPacket,
+                          size_t serializedPacketLength,
+                          uint32_t * pSsrc );
+
+RtpResult_t Rtp_InitSenderContext( RtpContext_t * pCtx,
+                                   RtpSenderContext_t * pSenderCtx,
+                                   const RtpHeader_t * pHeader );
+
+/* Serializes all the packets of one frame. All the packets get the same
+ * timestamp and consecutive sequence numbers. Pass RTP_HEADER_FLAG_MARKER in
+ * flags to set the marker bit in the last packet. */
+RtpResult_t Rtp_SerializeBatch( RtpContext_t * pCtx,
+                                RtpSenderContext_t * pSenderCtx,
+                                uint32_t timestamp,
+                                uint32_t flags,
+                                RtpBatchPacket_t * pPackets,
+                                size_t packetCount );
+
 #endif /* RTP_API_H */
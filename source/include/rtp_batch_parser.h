@@ -0,0 +1,44 @@
+#ifndef RTP_BATCH_PARSER_H
+#define RTP_BATCH_PARSER_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum RtpBatchParserResult
+{
+    RTP_BATCH_PARSER_RESULT_OK,
+    RTP_BATCH_PARSER_RESULT_BAD_PARAM
+} RtpBatchParserResult_t;
+
+/*-----------------------------------------------------------*/
+
+/* Caller provided arrays, each with at least packetCount entries, which are
+ * filled with the fixed header fields of the parsed packets. The entry at
+ * index i corresponds to the packet at index i. For packets which fail
+ * validation, all the fields are set to 0. */
+typedef struct RtpBatchHeaders
+{
+    uint16_t * pSequenceNumber;
+    uint32_t * pTimestamp;
+    uint32_t * pSsrc;
+    uint8_t * pPayloadType;
+    uint8_t * pMarker;
+    size_t * pPayloadOffset; /* Offset of the payload after CSRCs and extension. Padding is not removed. */
+} RtpBatchHeaders_t;
+
+/*-----------------------------------------------------------*/
+
+/* Parses the fixed RTP header of packetCount packets. A packet is valid if it
+ * is at least 12 bytes long, has version 2 and contains the CSRCs and the
+ * extension announced in the header. The number of valid packets is returned
+ * in pValidPacketCount. */
+RtpBatchParserResult_t RtpBatchParser_ParseHeaders( const uint8_t * const * ppPackets,
+                                                    const size_t * pPacketLengths,
+                                                    size_t packetCount,
+                                                    RtpBatchHeaders_t * pHeaders,
+                                                    size_t * pValidPacketCount );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_BATCH_PARSER_H */
@@ -0,0 +1,134 @@
+#ifndef RTP_CAPTURE_H
+#define RTP_CAPTURE_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Maximum number of pcapng interfaces in a section.
+ */
+#ifndef RTP_CAPTURE_MAX_INTERFACES
+    #define RTP_CAPTURE_MAX_INTERFACES    8
+#endif
+
+typedef enum RtpCaptureResult
+{
+    RTP_CAPTURE_RESULT_OK,
+    RTP_CAPTURE_RESULT_BAD_PARAM,
+    RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT,
+    RTP_CAPTURE_RESULT_MALFORMED,
+    RTP_CAPTURE_RESULT_OUT_OF_MEMORY,
+    RTP_CAPTURE_RESULT_FLUSH_FAILED,
+    RTP_CAPTURE_RESULT_END /* No more packets. */
+} RtpCaptureResult_t;
+
+typedef enum RtpCaptureFormat
+{
+    RTP_CAPTURE_FORMAT_PCAP,
+    RTP_CAPTURE_FORMAT_PCAPNG,
+    RTP_CAPTURE_FORMAT_RTPDUMP
+} RtpCaptureFormat_t;
+
+/*-----------------------------------------------------------*/
+
+/* A packet of the capture. pPacket points in the capture buffer. */
+typedef struct RtpCapturePacket
+{
+    const uint8_t * pPacket; /* UDP payload, i.e. the serialized RTP packet. */
+    size_t packetLength;
+    uint64_t timestampUs;
+    uint16_t srcPort;
+    uint16_t dstPort;
+} RtpCapturePacket_t;
+
+typedef struct RtpCaptureReader
+{
+    const uint8_t * pBuffer;
+    size_t bufferLength;
+    size_t offset;
+    RtpCaptureFormat_t format;
+    uint8_t isLittleEndian;
+
+    /* pcap. */
+    uint32_t linkType;
+    uint8_t isNanoseconds;
+
+    /* pcapng interfaces of the current section. */
+    uint16_t interfaceLinkTypes[ RTP_CAPTURE_MAX_INTERFACES ];
+    uint8_t interfaceTimestampResolutions[ RTP_CAPTURE_MAX_INTERFACES ];
+    size_t interfaceCount;
+
+    /* rtpdump. */
+    uint64_t startTimeUs;
+    uint16_t sourcePort;
+
+    uint16_t filterPort;     /* 0 for any port. */
+    uint32_t filterSsrc;
+    uint8_t isSsrcFilterEnabled;
+} RtpCaptureReader_t;
+
+/* Called with the buffered bytes when the buffer of the writer is full. */
+typedef RtpCaptureResult_t ( * RtpCaptureFlush_t )( void * pCustomContext,
+                                                   const uint8_t * pData,
+                                                   size_t dataLength );
+
+typedef struct RtpCaptureWriter
+{
+    uint8_t * pBuffer;
+    size_t bufferLength;
+    size_t bufferOffset;
+    RtpCaptureFormat_t format;
+    RtpCaptureFlush_t flush;
+    void * pCustomContext;
+    uint16_t srcPort;
+    uint16_t dstPort;
+    uint64_t startTimeUs;
+} RtpCaptureWriter_t;
+
+/*-----------------------------------------------------------*/
+
+/* The format is detected from the content of the buffer, which usually is a
+ * memory mapped capture file. It must stay valid while the reader is used. */
+RtpCaptureResult_t RtpCaptureReader_Init( RtpCaptureReader_t * pReader,
+                                          const uint8_t * pBuffer,
+                                          size_t bufferLength );
+
+/* Only the packets from or to the UDP port are returned, 0 for any port. The
+ * packets of an rtpdump file have the source port of the file header. */
+RtpCaptureResult_t RtpCaptureReader_SetPortFilter( RtpCaptureReader_t * pReader,
+                                                   uint16_t port );
+
+/* Only the packets with the SSRC in their RTP header are returned. */
+RtpCaptureResult_t RtpCaptureReader_SetSsrcFilter( RtpCaptureReader_t * pReader,
+                                                   uint32_t ssrc );
+
+/* Returns RTP_CAPTURE_RESULT_END once all the packets are read. Non UDP,
+ * fragmented and truncated packets, and rtpdump RTCP records, are skipped. */
+RtpCaptureResult_t RtpCaptureReader_GetNextPacket( RtpCaptureReader_t * pReader,
+                                                   RtpCapturePacket_t * pPacket );
+
+/* Writes a pcap (raw IPv4) or rtpdump capture. Packets are buffered in
+ * pBuffer and passed to the flush callback when it is full. The file header
+ * is written to the buffer by this call. */
+RtpCaptureResult_t RtpCaptureWriter_Init( RtpCaptureWriter_t * pWriter,
+                                          RtpCaptureFormat_t format,
+                                          uint8_t * pBuffer,
+                                          size_t bufferLength,
+                                          RtpCaptureFlush_t flush,
+                                          void * pCustomContext,
+                                          uint16_t srcPort,
+                                          uint16_t dstPort,
+                                          uint64_t startTimeUs );
+
+RtpCaptureResult_t RtpCaptureWriter_WritePacket( RtpCaptureWriter_t * pWriter,
+                                                 const uint8_t * pPacket,
+                                                 size_t packetLength,
+                                                 uint64_t timestampUs );
+
+/* Passes the buffered bytes to the flush callback. */
+RtpCaptureResult_t RtpCaptureWriter_Flush( RtpCaptureWriter_t * pWriter );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_CAPTURE_H */
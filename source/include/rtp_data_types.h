@@ -12,6 +12,27 @@
 #define RTP_HEADER_FLAG_MARKER      ( 1 << 1 )
 #define RTP_HEADER_FLAG_EXTENSION   ( 1 << 2 )
 
+#define RTP_HEADER_MAX_CSRC_COUNT   15
+
+/* I/O vectors filled by Rtp_SerializeIoVec. */
+#define RTP_IOVEC_HEADER_INDEX      0
+#define RTP_IOVEC_PAYLOAD_INDEX     1
+#define RTP_IOVEC_COUNT             2
+
+/*
+ * Maximum number of extension payload words that can be pre-encoded in the
+ * header template of an RtpSenderContext_t.
+ */
+#ifndef RTP_SENDER_MAX_EXTENSION_PAYLOAD_LENGTH
+    #define RTP_SENDER_MAX_EXTENSION_PAYLOAD_LENGTH     8
+#endif
+
+#define RTP_SENDER_HEADER_TEMPLATE_MAX_LENGTH                   \
+    ( 12 + /* Fixed header. */                                  \
+      ( RTP_HEADER_MAX_CSRC_COUNT * 4 ) +                       \
+      4 + /* Extension header. */                               \
+      ( RTP_SENDER_MAX_EXTENSION_PAYLOAD_LENGTH * 4 ) )
+
 /*
  * Transport Wide Congestion Control (TWCC) extension:
  *
@@ -90,6 +111,64 @@ typedef struct RtpDataPacket
     size_t payloadLength;
 } RtpPacket_t;
 
+/* Fixed part of the RTP header, filled by the Rtp_Peek* functions. */
+typedef struct RtpFixedHeader
+{
+    uint32_t flags;
+    uint8_t csrcCount;
+    uint8_t payloadType;
+    uint16_t sequenceNumber;
+    uint32_t timestamp;
+    uint32_t ssrc;
+} RtpFixedHeader_t;
+
+/* Read-only view of a serialized packet, filled by Rtp_DeSerializeView. The
+ * CSRCs and the extension payload stay in network byte order in the packet
+ * and are read using Rtp_GetCsrc and Rtp_GetExtensionPayloadWord. */
+typedef struct RtpPacketView
+{
+    const uint8_t * pSerializedPacket;
+    size_t serializedPacketLength;
+    uint32_t flags;
+    uint8_t csrcCount;
+    uint8_t payloadType;
+    uint16_t sequenceNumber;
+    uint32_t timestamp;
+    uint32_t ssrc;
+    const uint8_t * pCsrc;
+    uint16_t extensionProfile;
+    uint16_t extensionPayloadLength; /* In words. */
+    const uint8_t * pExtensionPayload;
+    const uint8_t * pPayload;
+    size_t payloadLength;
+} RtpPacketView_t;
+
+/* Per stream sender state. The header fields which do not change within a
+ * stream (SSRC, payload type, CSRCs and extension) are encoded once in
+ * Rtp_InitSenderContext and copied as is for every packet. */
+typedef struct RtpSenderContext
+{
+    uint32_t firstWord; /* First header word without sequence number and marker. */
+    uint8_t headerTemplate[ RTP_SENDER_HEADER_TEMPLATE_MAX_LENGTH ];
+    size_t headerTemplateLength;
+    uint16_t nextSequenceNumber;
+} RtpSenderContext_t;
+
+/* Same layout as POSIX struct iovec, used by Rtp_SerializeIoVec. */
+typedef struct RtpIoVec
+{
+    uint8_t * pBase;
+    size_t length;
+} RtpIoVec_t;
+
+typedef struct RtpBatchPacket
+{
+    uint8_t * pPayload;
+    size_t payloadLength;
+    uint8_t * pBuffer;
+    size_t bufferLength; /* In: size of pBuffer, Out: serialized packet length. */
+} RtpBatchPacket_t;
+
 /*-----------------------------------------------------------*/
 
 #endif /* RTP_DATA_TYPES_H */
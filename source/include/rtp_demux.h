@@ -0,0 +1,107 @@
+#ifndef RTP_DEMUX_H
+#define RTP_DEMUX_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtp_data_types.h"
+#include "rtp_extension.h"
+
+/* Payload type which matches any payload type of an SSRC. */
+#define RTP_DEMUX_ANY_PAYLOAD_TYPE      0xFF
+
+/* Extension ID used to disable MID/RID based routing. */
+#define RTP_DEMUX_EXTENSION_ID_NONE     0
+
+typedef enum RtpDemuxResult
+{
+    RTP_DEMUX_RESULT_OK,
+    RTP_DEMUX_RESULT_BAD_PARAM,
+    RTP_DEMUX_RESULT_FULL,
+    RTP_DEMUX_RESULT_NOT_FOUND,
+    RTP_DEMUX_RESULT_MALFORMED_PACKET
+} RtpDemuxResult_t;
+
+/*-----------------------------------------------------------*/
+
+/* Slot of the SSRC hash table. A slot with NULL pStream is empty. */
+typedef struct RtpDemuxEntry
+{
+    uint32_t ssrc;
+    uint8_t payloadType;
+    void * pStream;
+} RtpDemuxEntry_t;
+
+/* RFC 8843 MID (and optionally RTP stream ID) route, used for packets with an
+ * unknown SSRC. */
+typedef struct RtpDemuxMidRoute
+{
+    const uint8_t * pMid;
+    size_t midLength;
+    const uint8_t * pRid; /* NULL to match any RID. */
+    size_t ridLength;
+    void * pStream;
+} RtpDemuxMidRoute_t;
+
+typedef struct RtpDemux
+{
+    RtpDemuxEntry_t * pEntries;
+    size_t entriesMask; /* Number of entries - 1. */
+    size_t entryCount;
+
+    RtpDemuxMidRoute_t * pMidRoutes;
+    size_t midRoutesLength;
+    size_t midRouteCount;
+
+    uint8_t midExtensionId;
+    uint8_t ridExtensionId;
+    RtpContext_t rtpCtx;
+    RtpExtensionTable_t extensionTable;
+} RtpDemux_t;
+
+/*-----------------------------------------------------------*/
+
+/* entriesLength must be a power of 2. At most entriesLength - 1 SSRCs can be
+ * added, but the lookups are fastest when the table is at most half full.
+ * pMidRoutes can be NULL if MID/RID routing is not used. */
+RtpDemuxResult_t RtpDemux_Init( RtpDemux_t * pDemux,
+                                RtpDemuxEntry_t * pEntries,
+                                size_t entriesLength,
+                                RtpDemuxMidRoute_t * pMidRoutes,
+                                size_t midRoutesLength );
+
+/* Sets the negotiated extension IDs of the MID and RID header extensions. */
+RtpDemuxResult_t RtpDemux_SetExtensionIds( RtpDemux_t * pDemux,
+                                           uint8_t midExtensionId,
+                                           uint8_t ridExtensionId );
+
+/* Pass RTP_DEMUX_ANY_PAYLOAD_TYPE to route all the payload types of the SSRC
+ * which do not have their own entry. Adding an existing SSRC and payload type
+ * replaces its stream. */
+RtpDemuxResult_t RtpDemux_AddSsrc( RtpDemux_t * pDemux,
+                                   uint32_t ssrc,
+                                   uint8_t payloadType,
+                                   void * pStream );
+
+RtpDemuxResult_t RtpDemux_RemoveSsrc( RtpDemux_t * pDemux,
+                                      uint32_t ssrc,
+                                      uint8_t payloadType );
+
+/* Routes are checked in the order they are added. */
+RtpDemuxResult_t RtpDemux_AddMidRoute( RtpDemux_t * pDemux,
+                                       const RtpDemuxMidRoute_t * pMidRoute );
+
+/* Finds the stream of a serialized packet by SSRC and payload type. When the
+ * SSRC is unknown, the MID/RID extensions are matched against the MID routes
+ * and, on a match, the SSRC is added to the table so that the following
+ * packets of the stream are routed by SSRC. */
+RtpDemuxResult_t RtpDemux_Route( RtpDemux_t * pDemux,
+                                 const uint8_t * pSerializedPacket,
+                                 size_t serializedPacketLength,
+                                 void ** ppStream );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_DEMUX_H */
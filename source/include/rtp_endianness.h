@@ -3,6 +3,125 @@
 
 /* Standard includes. */
 #include <stdint.h>
+#include <string.h>
+
+/* Byte order of the target, selected at compile time. When the compiler does
+ * not provide it, the generic byte by byte implementation is used which is
+ * correct on any target. */
+#if defined( __BYTE_ORDER__ ) && defined( __ORDER_LITTLE_ENDIAN__ ) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) && defined( __GNUC__ )
+    #define RTP_ENDIANNESS_LITTLE_ENDIAN
+#elif defined( __BYTE_ORDER__ ) && defined( __ORDER_BIG_ENDIAN__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+    #define RTP_ENDIANNESS_BIG_ENDIAN
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* Inline helpers to read/write network byte order (big endian) values from/to
+ * unaligned buffers. memcpy is used instead of pointer casts so that the
+ * compiler can emit a single (unaligned) load/store without violating
+ * alignment or strict aliasing rules. */
+
+static inline uint16_t Rtp_ReadUint16( const uint8_t * pSrc )
+{
+    #if defined( RTP_ENDIANNESS_LITTLE_ENDIAN )
+        uint16_t val;
+
+        memcpy( ( void * ) &( val ), ( const void * ) pSrc, sizeof( val ) );
+        return __builtin_bswap16( val );
+    #elif defined( RTP_ENDIANNESS_BIG_ENDIAN )
+        uint16_t val;
+
+        memcpy( ( void * ) &( val ), ( const void * ) pSrc, sizeof( val ) );
+        return val;
+    #else
+        return ( uint16_t ) ( ( ( uint16_t ) pSrc[ 0 ] << 8 ) |
+                              ( ( uint16_t ) pSrc[ 1 ] ) );
+    #endif
+}
+
+static inline uint32_t Rtp_ReadUint32( const uint8_t * pSrc )
+{
+    #if defined( RTP_ENDIANNESS_LITTLE_ENDIAN )
+        uint32_t val;
+
+        memcpy( ( void * ) &( val ), ( const void * ) pSrc, sizeof( val ) );
+        return __builtin_bswap32( val );
+    #elif defined( RTP_ENDIANNESS_BIG_ENDIAN )
+        uint32_t val;
+
+        memcpy( ( void * ) &( val ), ( const void * ) pSrc, sizeof( val ) );
+        return val;
+    #else
+        return ( ( ( uint32_t ) pSrc[ 0 ] << 24 ) |
+                 ( ( uint32_t ) pSrc[ 1 ] << 16 ) |
+                 ( ( uint32_t ) pSrc[ 2 ] << 8 ) |
+                 ( ( uint32_t ) pSrc[ 3 ] ) );
+    #endif
+}
+
+static inline uint64_t Rtp_ReadUint64( const uint8_t * pSrc )
+{
+    #if defined( RTP_ENDIANNESS_LITTLE_ENDIAN )
+        uint64_t val;
+
+        memcpy( ( void * ) &( val ), ( const void * ) pSrc, sizeof( val ) );
+        return __builtin_bswap64( val );
+    #elif defined( RTP_ENDIANNESS_BIG_ENDIAN )
+        uint64_t val;
+
+        memcpy( ( void * ) &( val ), ( const void * ) pSrc, sizeof( val ) );
+        return val;
+    #else
+        return ( ( ( uint64_t ) Rtp_ReadUint32( pSrc ) << 32 ) |
+                 ( ( uint64_t ) Rtp_ReadUint32( &( pSrc[ 4 ] ) ) ) );
+    #endif
+}
+
+static inline void Rtp_WriteUint16( uint8_t * pDst,
+                                    uint16_t val )
+{
+    #if defined( RTP_ENDIANNESS_LITTLE_ENDIAN )
+        val = __builtin_bswap16( val );
+        memcpy( ( void * ) pDst, ( const void * ) &( val ), sizeof( val ) );
+    #elif defined( RTP_ENDIANNESS_BIG_ENDIAN )
+        memcpy( ( void * ) pDst, ( const void * ) &( val ), sizeof( val ) );
+    #else
+        pDst[ 0 ] = ( uint8_t ) ( val >> 8 );
+        pDst[ 1 ] = ( uint8_t ) ( val );
+    #endif
+}
+
+static inline void Rtp_WriteUint32( uint8_t * pDst,
+                                    uint32_t val )
+{
+    #if defined( RTP_ENDIANNESS_LITTLE_ENDIAN )
+        val = __builtin_bswap32( val );
+        memcpy( ( void * ) pDst, ( const void * ) &( val ), sizeof( val ) );
+    #elif defined( RTP_ENDIANNESS_BIG_ENDIAN )
+        memcpy( ( void * ) pDst, ( const void * ) &( val ), sizeof( val ) );
+    #else
+        pDst[ 0 ] = ( uint8_t ) ( val >> 24 );
+        pDst[ 1 ] = ( uint8_t ) ( val >> 16 );
+        pDst[ 2 ] = ( uint8_t ) ( val >> 8 );
+        pDst[ 3 ] = ( uint8_t ) ( val );
+    #endif
+}
+
+static inline void Rtp_WriteUint64( uint8_t * pDst,
+                                    uint64_t val )
+{
+    #if defined( RTP_ENDIANNESS_LITTLE_ENDIAN )
+        val = __builtin_bswap64( val );
+        memcpy( ( void * ) pDst, ( const void * ) &( val ), sizeof( val ) );
+    #elif defined( RTP_ENDIANNESS_BIG_ENDIAN )
+        memcpy( ( void * ) pDst, ( const void * ) &( val ), sizeof( val ) );
+    #else
+        Rtp_WriteUint32( pDst, ( uint32_t ) ( val >> 32 ) );
+        Rtp_WriteUint32( &( pDst[ 4 ] ), ( uint32_t ) ( val ) );
+    #endif
+}
+
+/*-----------------------------------------------------------*/
 
 /* Endianness Function types. */
 typedef void ( * RtpWriteUint32_t ) ( uint8_t * pDst,
@@ -15,6 +134,8 @@ typedef struct RtpReadWriteFunctions
     RtpReadUint32_t readUint32Fn;
 } RtpReadWriteFunctions_t;
 
+/* Kept for backward compatibility only. New code should use the inline
+ * helpers above. */
 void Rtp_InitReadWriteFunctions( RtpReadWriteFunctions_t * pReadWriteFunctions );
 
 #endif /* RTP_ENDIANNESS_H */
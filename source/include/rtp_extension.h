@@ -0,0 +1,108 @@
+#ifndef RTP_EXTENSION_H
+#define RTP_EXTENSION_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtp_data_types.h"
+
+/*
+ * RFC 8285 header extension profiles.
+ *
+ * One-byte header - IDs 1-14, element data length 1-16 bytes:
+ *
+ *  0                   1                   2                   3
+ *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |       0xBE    |    0xDE       |           length              |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |  ID   | L     |     data      |  ID   | L     |     data...
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *
+ * Two-byte header - IDs 1-255, element data length 0-255 bytes:
+ *
+ *  0                   1                   2                   3
+ *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |         0x100         |appbits|           length              |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |       ID      |     length    |     data...
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *
+ * RFC - https://datatracker.ietf.org/doc/html/rfc8285
+ */
+#define RTP_EXTENSION_ONE_BYTE_PROFILE              0xBEDE
+#define RTP_EXTENSION_TWO_BYTE_PROFILE              0x1000
+#define RTP_EXTENSION_TWO_BYTE_PROFILE_MASK         0xFFF0
+
+#define RTP_EXTENSION_ONE_BYTE_MAX_ID               14
+#define RTP_EXTENSION_ONE_BYTE_MAX_DATA_LENGTH      16
+#define RTP_EXTENSION_TWO_BYTE_MAX_ID               255
+#define RTP_EXTENSION_TWO_BYTE_MAX_DATA_LENGTH      255
+
+/* Number of entries in the ID table, indexed directly by the element ID. */
+#define RTP_EXTENSION_TABLE_LENGTH                  256
+
+/*-----------------------------------------------------------*/
+
+typedef enum RtpExtensionResult
+{
+    RTP_EXTENSION_RESULT_OK,
+    RTP_EXTENSION_RESULT_BAD_PARAM,
+    RTP_EXTENSION_RESULT_OUT_OF_MEMORY,
+    RTP_EXTENSION_RESULT_MALFORMED_EXTENSION,
+    RTP_EXTENSION_RESULT_UNSUPPORTED_PROFILE,
+    RTP_EXTENSION_RESULT_NOT_FOUND
+} RtpExtensionResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtpExtensionElement
+{
+    uint8_t id;
+    uint8_t dataLength;
+    const uint8_t * pData;
+} RtpExtensionElement_t;
+
+/* Elements of one extension block indexed by ID. The offset and length of an
+ * ID are only valid when its bit is set in presentIds, so that only the bitmap
+ * needs to be cleared to parse the next packet. */
+typedef struct RtpExtensionTable
+{
+    const uint8_t * pExtensionPayload;
+    uint32_t presentIds[ RTP_EXTENSION_TABLE_LENGTH / 32 ];
+    uint32_t dataOffset[ RTP_EXTENSION_TABLE_LENGTH ];
+    uint8_t dataLength[ RTP_EXTENSION_TABLE_LENGTH ];
+} RtpExtensionTable_t;
+
+/*-----------------------------------------------------------*/
+
+/* Indexes all the elements of an extension block in a single pass.
+ * pExtensionPayload points to the extension payload in network byte order,
+ * as returned in RtpPacketView_t by Rtp_DeSerializeView, and must remain valid
+ * as long as the table is used. The length is in bytes - multiply the
+ * extensionPayloadLength of RtpPacketView_t, which is in words, by 4. */
+RtpExtensionResult_t RtpExtension_Parse( uint16_t extensionProfile,
+                                         const uint8_t * pExtensionPayload,
+                                         size_t extensionPayloadLength, /* In bytes. */
+                                         RtpExtensionTable_t * pTable );
+
+RtpExtensionResult_t RtpExtension_Get( const RtpExtensionTable_t * pTable,
+                                       uint8_t id,
+                                       const uint8_t ** ppData,
+                                       uint8_t * pDataLength );
+
+/* Packs the elements into pExtensionPayloadBuffer using the one-byte profile
+ * when all the elements fit in it and the two-byte profile otherwise, and
+ * fills pExtension so that it can be passed to Rtp_Serialize. */
+RtpExtensionResult_t RtpExtension_Build( const RtpExtensionElement_t * pElements,
+                                         size_t elementCount,
+                                         uint32_t * pExtensionPayloadBuffer,
+                                         size_t extensionPayloadBufferLength, /* In words. */
+                                         RtpHeaderExtension_t * pExtension );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_EXTENSION_H */
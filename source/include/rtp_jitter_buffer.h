@@ -0,0 +1,105 @@
+#ifndef RTP_JITTER_BUFFER_H
+#define RTP_JITTER_BUFFER_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Packet properties, returned by RtpJitterBufferGetPacketProperties_t. They
+ * have the same values as the *_PACKET_PROPERTY_* of the codec depacketizers.
+ */
+#define RTP_JITTER_BUFFER_PACKET_PROPERTY_START_PACKET  ( 1 << 0 )
+#define RTP_JITTER_BUFFER_PACKET_PROPERTY_END_PACKET    ( 1 << 1 )
+
+typedef enum RtpJitterBufferResult
+{
+    RTP_JITTER_BUFFER_RESULT_OK,
+    RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+    RTP_JITTER_BUFFER_RESULT_OUT_OF_MEMORY,
+    RTP_JITTER_BUFFER_RESULT_LATE_PACKET,      /* Packet is older than the last released or dropped one. */
+    RTP_JITTER_BUFFER_RESULT_DUPLICATE_PACKET,
+    RTP_JITTER_BUFFER_RESULT_NO_FRAME          /* No complete frame is available yet. */
+} RtpJitterBufferResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the RTP_JITTER_BUFFER_PACKET_PROPERTY_* of an RTP payload, or 0 if
+ * they cannot be determined. It is usually a thin wrapper around the
+ * *Depacketizer_GetPacketProperties function of the stream's codec.
+ */
+typedef uint32_t ( * RtpJitterBufferGetPacketProperties_t )( const uint8_t * pPayload,
+                                                              size_t payloadLength );
+
+typedef struct RtpJitterBufferPacket
+{
+    uint16_t seqNum;
+    uint32_t rtpTimestamp;
+    uint8_t isMarker;
+    uint8_t * pPayload;
+    size_t payloadLength;
+} RtpJitterBufferPacket_t;
+
+typedef struct RtpJitterBufferSlot
+{
+    RtpJitterBufferPacket_t packet;
+    uint32_t extendedSeqNum;
+    uint32_t properties;
+    uint8_t isOccupied;
+} RtpJitterBufferSlot_t;
+
+typedef struct RtpJitterBuffer
+{
+    RtpJitterBufferSlot_t * pSlots;
+    size_t slotsMask;            /* Number of slots - 1. */
+    RtpJitterBufferGetPacketProperties_t getPacketProperties;
+    uint64_t maxLatency;         /* 0 to wait forever for missing packets. */
+
+    uint32_t headSeqNum;         /* Extended sequence number of the next packet to release. */
+    uint32_t scanSeqNum;         /* Packets from headSeqNum to scanSeqNum are present and not frame ends. */
+    uint32_t highestSeqNum;
+    uint32_t lastTimestamp;      /* RTP timestamp of the last released or dropped frame. */
+    uint8_t isLastTimestampValid;
+    uint8_t isStarted;
+
+    uint8_t isWaiting;           /* A frame is incomplete since waitStartTime. */
+    uint64_t waitStartTime;
+
+    uint32_t droppedPacketCount;
+    uint32_t latePacketCount;
+} RtpJitterBuffer_t;
+
+/*-----------------------------------------------------------*/
+
+/* The number of slots must be a power of two, and bounds the sequence number
+ * span of the buffered packets. getPacketProperties may be NULL, in which case
+ * frames are only delimited by the RTP timestamp and the marker bit. */
+RtpJitterBufferResult_t RtpJitterBuffer_Init( RtpJitterBuffer_t * pJitterBuffer,
+                                              RtpJitterBufferSlot_t * pSlots,
+                                              size_t slotsLength,
+                                              RtpJitterBufferGetPacketProperties_t getPacketProperties,
+                                              uint64_t maxLatency );
+
+/* Adds a packet, in any order. The payload must stay valid until the packet is
+ * returned by RtpJitterBuffer_PopFrame or dropped. If the packet is too far
+ * ahead of the oldest buffered packet, the oldest frames are dropped. */
+RtpJitterBufferResult_t RtpJitterBuffer_Push( RtpJitterBuffer_t * pJitterBuffer,
+                                              const RtpJitterBufferPacket_t * pPacket );
+
+/* Returns the packets of the oldest complete frame, in sequence number order,
+ * ready to be added to the codec depacketizer. A frame is complete when its
+ * packets are contiguous up to one with the marker bit set, or up to the first
+ * packet of the next frame. If the oldest frame stays
+ * incomplete for more than maxLatency (measured from the first call that found
+ * it incomplete), it is dropped. currentTime must be in the same unit as
+ * maxLatency. */
+RtpJitterBufferResult_t RtpJitterBuffer_PopFrame( RtpJitterBuffer_t * pJitterBuffer,
+                                                  uint64_t currentTime,
+                                                  RtpJitterBufferPacket_t * pPackets,
+                                                  size_t packetsLength,
+                                                  size_t * pPacketCount );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_JITTER_BUFFER_H */
@@ -0,0 +1,83 @@
+#ifndef RTP_PACER_H
+#define RTP_PACER_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtp_pkt_queue.h"
+
+typedef enum RtpPacerResult
+{
+    RTP_PACER_RESULT_OK,
+    RTP_PACER_RESULT_BAD_PARAM,
+    RTP_PACER_RESULT_FULL,
+    RTP_PACER_RESULT_PACKET_DELETED, /* The packet was added after removing older packets of the same priority. */
+    RTP_PACER_RESULT_EMPTY,
+    RTP_PACER_RESULT_NOT_READY       /* Packets are queued but the send budget is exhausted. */
+} RtpPacerResult_t;
+
+/*-----------------------------------------------------------*/
+
+/* Returns the current time in microseconds. */
+typedef uint64_t ( * RtpPacerGetCurrentTimeUs_t )( void * pCustomContext );
+
+typedef struct RtpPacer
+{
+    /* One queue per priority, index 0 being the highest priority. */
+    RtpPacketQueue_t * pQueues;
+    size_t queueCount;
+
+    RtpPacerGetCurrentTimeUs_t getCurrentTimeUs;
+    void * pCustomContext;
+
+    uint64_t bitrate;        /* Bits per second. */
+    size_t maxBurstBytes;
+    int64_t budgetBytes;     /* Negative when in debt. */
+    uint64_t budgetRemainder; /* Fraction of a byte, in bits per second times microseconds. */
+    uint64_t lastUpdateTimeUs;
+} RtpPacer_t;
+
+/*-----------------------------------------------------------*/
+
+/* The queues must be initialized by the caller. Packets are released at
+ * bitrate bits per second, and at most maxBurstBytes plus one packet are
+ * released back to back after an idle period. */
+RtpPacerResult_t RtpPacer_Init( RtpPacer_t * pPacer,
+                                RtpPacketQueue_t * pQueues,
+                                size_t queueCount,
+                                RtpPacerGetCurrentTimeUs_t getCurrentTimeUs,
+                                void * pCustomContext,
+                                uint64_t bitrate,
+                                size_t maxBurstBytes );
+
+RtpPacerResult_t RtpPacer_SetRate( RtpPacer_t * pPacer,
+                                   uint64_t bitrate,
+                                   size_t maxBurstBytes );
+
+/* The queue of the priority must not have storage set - use
+ * RtpPacer_EnqueueCopy for those. */
+RtpPacerResult_t RtpPacer_Enqueue( RtpPacer_t * pPacer,
+                                   size_t priority,
+                                   const RtpPacketInfo_t * pRtpPacketInfo );
+
+/* Copies the serialized packet in the storage of the queue, which must have
+ * been set with RtpPacketQueue_SetStorage. */
+RtpPacerResult_t RtpPacer_EnqueueCopy( RtpPacer_t * pPacer,
+                                       size_t priority,
+                                       uint16_t seqNum,
+                                       const uint8_t * pSerializedRtpPacket,
+                                       size_t serializedPacketLength );
+
+/* Returns the highest priority packet if the send budget allows it. */
+RtpPacerResult_t RtpPacer_GetNextPacket( RtpPacer_t * pPacer,
+                                         RtpPacketInfo_t * pRtpPacketInfo );
+
+/* Returns the time at which RtpPacer_GetNextPacket releases the next packet. */
+RtpPacerResult_t RtpPacer_GetNextSendTime( RtpPacer_t * pPacer,
+                                           uint64_t * pNextSendTimeUs );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_PACER_H */
@@ -5,6 +5,12 @@
 #include <stdint.h>
 #include <stddef.h>
 
+/*
+ * Maximum number of packets requested by one RTCP generic NACK entry - the
+ * PID and the 16 packets of the BLP bitmask.
+ */
+#define RTP_PACKET_QUEUE_NACK_MAX_PACKETS    17
+
 typedef enum RtpPacketQueueResult
 {
     RTP_PACKET_QUEUE_RESULT_OK,
@@ -22,15 +28,28 @@ typedef struct RtpPacketInfo
     uint16_t seqNum;
     uint8_t * pSerializedRtpPacket;
     size_t serializedPacketLength;
+    uint64_t insertionTime; /* Set by the caller, used for the age based eviction. */
 } RtpPacketInfo_t;
 
 typedef struct RtpPacketQueue
 {
     RtpPacketInfo_t * pRtpPacketInfoArray;
     size_t rtpPacketInfoArrayLength;
+    size_t indexMask; /* rtpPacketInfoArrayLength - 1 if it is a power of two, 0 otherwise. */
     size_t writeIndex;
     size_t readIndex;
     size_t packetCount;
+    size_t totalBytes; /* Sum of serializedPacketLength of all the packet infos. */
+    size_t maxBytes;   /* 0 for no limit. */
+    uint64_t maxAge;   /* 0 for no limit. */
+    uint8_t * pStorage; /* Optional storage for the serialized packets. */
+    size_t storageLength;
+    size_t storageWriteOffset;
+    uint8_t * pReservedBuffer;
+    size_t reservedLength;
+    uint8_t isDirectMapped;
+    size_t mappingOffset; /* Direct mapped slot of sequence number s is ( s + mappingOffset ) & indexMask. */
+    size_t unmappedCount; /* Oldest packet infos enqueued before the last sequence number gap. */
 } RtpPacketQueue_t;
 
 /*----------------------------------------------------------------------------*/
@@ -39,6 +58,10 @@ RtpPacketQueueResult_t RtpPacketQueue_Init( RtpPacketQueue_t * pQueue,
                                             RtpPacketInfo_t * pRtpPacketInfoArray,
                                             size_t rtpPacketInfoArrayLength );
 
+RtpPacketQueueResult_t RtpPacketQueue_InitDirectMapped( RtpPacketQueue_t * pQueue,
+                                                        RtpPacketInfo_t * pRtpPacketInfoArray,
+                                                        size_t rtpPacketInfoArrayLength );
+
 RtpPacketQueueResult_t RtpPacketQueue_Enqueue( RtpPacketQueue_t * pQueue,
                                                const RtpPacketInfo_t * pRtpPacketInfo );
 
@@ -56,6 +79,58 @@ RtpPacketQueueResult_t RtpPacketQueue_Retrieve( RtpPacketQueue_t * pQueue,
                                                 uint16_t seqNum,
                                                 RtpPacketInfo_t * pRtpPacketInfo );
 
+RtpPacketQueueResult_t RtpPacketQueue_RetrieveMask( RtpPacketQueue_t * pQueue,
+                                                    uint16_t pid,
+                                                    uint16_t blp,
+                                                    RtpPacketInfo_t * pRtpPacketInfos,
+                                                    size_t rtpPacketInfosLength,
+                                                    size_t * pRetrievedCount,
+                                                    uint32_t * pMissingMask );
+
+RtpPacketQueueResult_t RtpPacketQueue_SetStorage( RtpPacketQueue_t * pQueue,
+                                                  uint8_t * pStorage,
+                                                  size_t storageLength );
+
+RtpPacketQueueResult_t RtpPacketQueue_Reserve( RtpPacketQueue_t * pQueue,
+                                               size_t length,
+                                               uint8_t ** ppBuffer );
+
+RtpPacketQueueResult_t RtpPacketQueue_Commit( RtpPacketQueue_t * pQueue,
+                                              uint16_t seqNum,
+                                              size_t serializedPacketLength,
+                                              uint64_t insertionTime );
+
+RtpPacketQueueResult_t RtpPacketQueue_EnqueueCopy( RtpPacketQueue_t * pQueue,
+                                                   uint16_t seqNum,
+                                                   const uint8_t * pSerializedRtpPacket,
+                                                   size_t serializedPacketLength,
+                                                   uint64_t insertionTime );
+
+RtpPacketQueueResult_t RtpPacketQueue_EnqueueBatch( RtpPacketQueue_t * pQueue,
+                                                    const RtpPacketInfo_t * pRtpPacketInfos,
+                                                    size_t rtpPacketInfosCount,
+                                                    size_t * pEnqueuedCount );
+
+RtpPacketQueueResult_t RtpPacketQueue_DequeueBatch( RtpPacketQueue_t * pQueue,
+                                                    RtpPacketInfo_t * pRtpPacketInfos,
+                                                    size_t rtpPacketInfosLength,
+                                                    size_t * pDequeuedCount );
+
+RtpPacketQueueResult_t RtpPacketQueue_PeekBatch( RtpPacketQueue_t * pQueue,
+                                                 RtpPacketInfo_t * pRtpPacketInfos,
+                                                 size_t rtpPacketInfosLength,
+                                                 size_t * pPeekedCount );
+
+RtpPacketQueueResult_t RtpPacketQueue_SetLimits( RtpPacketQueue_t * pQueue,
+                                                 size_t maxBytes,
+                                                 uint64_t maxAge );
+
+RtpPacketQueueResult_t RtpPacketQueue_Evict( RtpPacketQueue_t * pQueue,
+                                             uint64_t currentTime,
+                                             RtpPacketInfo_t * pEvictedRtpPacketInfos,
+                                             size_t evictedRtpPacketInfosLength,
+                                             size_t * pEvictedCount );
+
 /*----------------------------------------------------------------------------*/
 
 #endif /* RTP_PACKET_QUEUE_H */
@@ -0,0 +1,92 @@
+#ifndef RTP_PLAYOUT_DELAY_H
+#define RTP_PLAYOUT_DELAY_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Resolution and range of the histogram of packet delays. Delays larger than
+ * the range are counted in the last bucket.
+ */
+#ifndef RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS
+    #define RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS   5
+#endif
+
+#ifndef RTP_PLAYOUT_DELAY_BUCKET_COUNT
+    #define RTP_PLAYOUT_DELAY_BUCKET_COUNT      128
+#endif
+
+/*
+ * The target delay is at least this many times the RFC 3550 jitter.
+ */
+#ifndef RTP_PLAYOUT_DELAY_JITTER_FACTOR
+    #define RTP_PLAYOUT_DELAY_JITTER_FACTOR     3
+#endif
+
+typedef enum RtpPlayoutDelayResult
+{
+    RTP_PLAYOUT_DELAY_RESULT_OK,
+    RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM,
+    RTP_PLAYOUT_DELAY_RESULT_NO_DATA   /* No packet was received yet. */
+} RtpPlayoutDelayResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtpPlayoutDelay
+{
+    /* Delay bucket of each of the last windowLength packets. */
+    uint8_t * pWindow;
+    size_t windowLength;
+    size_t windowIndex;
+    size_t windowCount;
+    uint16_t histogram[ RTP_PLAYOUT_DELAY_BUCKET_COUNT ];
+
+    uint32_t clockRate;
+    uint32_t minDelayMs;
+    uint32_t maxDelayMs;
+    uint8_t percentile;
+
+    uint64_t extendedRtpTimestamp;
+    uint32_t lastRtpTimestamp;
+    int64_t previousTransitMs;
+    int64_t baseTransitMs;      /* Minimum transit time, the zero delay reference. */
+    int64_t windowMinTransitMs; /* Minimum transit time since the base was last updated. */
+    size_t windowMinCount;
+    uint32_t jitter;            /* RFC 3550 jitter in ms, Q4 fixed point. */
+    uint8_t isStarted;
+} RtpPlayoutDelay_t;
+
+/*-----------------------------------------------------------*/
+
+/* pWindow holds the delays of the last windowLength packets, over which the
+ * percentile is computed. The target delay is kept within minDelayMs and
+ * maxDelayMs. */
+RtpPlayoutDelayResult_t RtpPlayoutDelay_Init( RtpPlayoutDelay_t * pPlayoutDelay,
+                                              uint8_t * pWindow,
+                                              size_t windowLength,
+                                              uint32_t clockRate,
+                                              uint8_t percentile,
+                                              uint32_t minDelayMs,
+                                              uint32_t maxDelayMs );
+
+/* Updates the estimate with a received packet, in O(1). */
+RtpPlayoutDelayResult_t RtpPlayoutDelay_Update( RtpPlayoutDelay_t * pPlayoutDelay,
+                                                uint32_t rtpTimestamp,
+                                                uint64_t arrivalTimeMs );
+
+/* The buffering delay, relative to the fastest packets, needed to play out
+ * the given percentile of the packets on time. */
+RtpPlayoutDelayResult_t RtpPlayoutDelay_GetTargetDelay( const RtpPlayoutDelay_t * pPlayoutDelay,
+                                                        uint32_t * pTargetDelayMs );
+
+/* The local time at which the frame with the given RTP timestamp should be
+ * released to the decoder. The timestamp must be close to the ones passed to
+ * RtpPlayoutDelay_Update. */
+RtpPlayoutDelayResult_t RtpPlayoutDelay_GetReleaseTime( const RtpPlayoutDelay_t * pPlayoutDelay,
+                                                        uint32_t rtpTimestamp,
+                                                        uint64_t * pReleaseTimeMs );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_PLAYOUT_DELAY_H */
@@ -0,0 +1,86 @@
+#ifndef RTP_RECEIVE_STATS_H
+#define RTP_RECEIVE_STATS_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Sequence number validation parameters from RFC 3550, Appendix A.1.
+ */
+#ifndef RTP_RECEIVE_STATS_MAX_DROPOUT
+    #define RTP_RECEIVE_STATS_MAX_DROPOUT       3000
+#endif
+
+#ifndef RTP_RECEIVE_STATS_MAX_MISORDER
+    #define RTP_RECEIVE_STATS_MAX_MISORDER      100
+#endif
+
+#ifndef RTP_RECEIVE_STATS_MIN_SEQUENTIAL
+    #define RTP_RECEIVE_STATS_MIN_SEQUENTIAL    2
+#endif
+
+typedef enum RtpReceiveStatsResult
+{
+    RTP_RECEIVE_STATS_RESULT_OK,
+    RTP_RECEIVE_STATS_RESULT_BAD_PARAM,
+    RTP_RECEIVE_STATS_RESULT_PROBATION,   /* Source is not valid yet. */
+    RTP_RECEIVE_STATS_RESULT_BAD_SEQUENCE /* Sequence number jumped too much. */
+} RtpReceiveStatsResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtpReceiveStats
+{
+    uint16_t maxSequenceNumber;     /* Highest sequence number seen. */
+    uint32_t cycles;                /* Shifted count of sequence number cycles. */
+    uint32_t baseSequenceNumber;
+    uint32_t badSequenceNumber;     /* Last 'bad' sequence number + 1. */
+    uint32_t probation;             /* Sequential packets till source is valid. */
+    uint32_t received;
+    uint32_t expectedPrior;         /* Packets expected at last report. */
+    uint32_t receivedPrior;         /* Packets received at last report. */
+    uint32_t reordered;             /* Late (reordered or duplicate) packets. */
+    uint32_t transit;               /* Relative transit time of the previous packet. */
+    uint32_t jitter;                /* Estimated jitter in Q4 fixed point. */
+    uint8_t isTransitValid;
+} RtpReceiveStats_t;
+
+/* Values for an RTCP reception report block (RFC 3550, section 6.4.1). */
+typedef struct RtpReceiveStatsReport
+{
+    uint8_t fractionLost;
+    int32_t cumulativeLost; /* Clamped to 24-bit signed range. */
+    uint32_t extendedHighestSequenceNumber;
+    uint32_t jitter;        /* In timestamp units. */
+} RtpReceiveStatsReport_t;
+
+/*-----------------------------------------------------------*/
+
+/* Initializes the statistics with the first packet of a source. The first
+ * packet must then be passed to RtpReceiveStats_Update as well. */
+RtpReceiveStatsResult_t RtpReceiveStats_Init( RtpReceiveStats_t * pStats,
+                                              uint16_t sequenceNumber );
+
+/* Updates the statistics for a received packet. arrivalTime must be in the
+ * same units as the RTP timestamp (i.e. the media clock rate). Returns
+ * RTP_RECEIVE_STATS_RESULT_PROBATION or RTP_RECEIVE_STATS_RESULT_BAD_SEQUENCE
+ * for packets which should not be processed further. */
+RtpReceiveStatsResult_t RtpReceiveStats_Update( RtpReceiveStats_t * pStats,
+                                                uint16_t sequenceNumber,
+                                                uint32_t rtpTimestamp,
+                                                uint32_t arrivalTime );
+
+/* Extends a sequence number to 32 bits relative to the highest sequence
+ * number seen, so that it can be used for ordering across wrap arounds. */
+RtpReceiveStatsResult_t RtpReceiveStats_GetExtendedSequenceNumber( const RtpReceiveStats_t * pStats,
+                                                                   uint16_t sequenceNumber,
+                                                                   uint32_t * pExtendedSequenceNumber );
+
+/* Fills a reception report and starts the next reporting interval. */
+RtpReceiveStatsResult_t RtpReceiveStats_GetReport( RtpReceiveStats_t * pStats,
+                                                   RtpReceiveStatsReport_t * pReport );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_RECEIVE_STATS_H */
@@ -0,0 +1,71 @@
+#ifndef RTP_SCHEDULER_H
+#define RTP_SCHEDULER_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtp_pkt_queue.h"
+
+/*
+ * Number of strict priority levels, 0 being the highest.
+ */
+#ifndef RTP_SCHEDULER_PRIORITY_LEVELS
+    #define RTP_SCHEDULER_PRIORITY_LEVELS   4
+#endif
+
+typedef enum RtpSchedulerResult
+{
+    RTP_SCHEDULER_RESULT_OK,
+    RTP_SCHEDULER_RESULT_BAD_PARAM,
+    RTP_SCHEDULER_RESULT_FULL,
+    RTP_SCHEDULER_RESULT_EMPTY
+} RtpSchedulerResult_t;
+
+/*-----------------------------------------------------------*/
+
+/* A traffic class, such as audio, retransmissions or one video stream. */
+typedef struct RtpSchedulerClass
+{
+    RtpPacketQueue_t queue;
+    uint8_t priority;
+    size_t quantum;  /* Bytes credited per round among the classes of the same priority. */
+    size_t deficit;
+    struct RtpSchedulerClass * pNext; /* Next active class of the same priority. */
+} RtpSchedulerClass_t;
+
+typedef struct RtpScheduler
+{
+    /* Circular list of the classes with queued packets, per priority. The
+     * class served next is the one after the tail. */
+    RtpSchedulerClass_t * pActiveTails[ RTP_SCHEDULER_PRIORITY_LEVELS ];
+    uint32_t activeMask; /* Bit i is set when priority i has active classes. */
+    size_t totalBytes;
+    size_t maxBytes;     /* Shared by all the classes, 0 for no limit. */
+} RtpScheduler_t;
+
+/*-----------------------------------------------------------*/
+
+RtpSchedulerResult_t RtpScheduler_Init( RtpScheduler_t * pScheduler,
+                                        size_t maxBytes );
+
+/* Classes of the same priority share the bandwidth in proportion to their
+ * quantum. A quantum of at least the largest packet length keeps
+ * RtpScheduler_Dequeue O(1). */
+RtpSchedulerResult_t RtpScheduler_InitClass( RtpSchedulerClass_t * pClass,
+                                             RtpPacketInfo_t * pRtpPacketInfoArray,
+                                             size_t rtpPacketInfoArrayLength,
+                                             uint8_t priority,
+                                             size_t quantum );
+
+RtpSchedulerResult_t RtpScheduler_Enqueue( RtpScheduler_t * pScheduler,
+                                           RtpSchedulerClass_t * pClass,
+                                           const RtpPacketInfo_t * pRtpPacketInfo );
+
+RtpSchedulerResult_t RtpScheduler_Dequeue( RtpScheduler_t * pScheduler,
+                                           RtpPacketInfo_t * pRtpPacketInfo );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_SCHEDULER_H */
@@ -0,0 +1,79 @@
+#ifndef RTP_SPSC_PACKET_QUEUE_H
+#define RTP_SPSC_PACKET_QUEUE_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* API includes. */
+#include "rtp_pkt_queue.h"
+
+/*
+ * A single producer/single consumer variant of RtpPacketQueue_t. One thread
+ * may call RtpSpscPacketQueue_Enqueue while another thread concurrently calls
+ * RtpSpscPacketQueue_Dequeue and RtpSpscPacketQueue_Peek, without any lock.
+ */
+
+/*
+ * The producer and the consumer indices are separated by at least this many
+ * bytes so that they never share a cache line.
+ */
+#ifndef RTP_SPSC_PACKET_QUEUE_CACHE_LINE_SIZE
+    #define RTP_SPSC_PACKET_QUEUE_CACHE_LINE_SIZE    64
+#endif
+
+/*
+ * The index type is part of the library ABI, so it must not depend on the
+ * language standard of the file including this header. Define
+ * RTP_SPSC_PACKET_QUEUE_C11_ATOMICS for the library and all its users to use
+ * C11 atomics on compilers without the GNU atomic builtins.
+ */
+#if defined( RTP_SPSC_PACKET_QUEUE_C11_ATOMICS )
+    #include <stdatomic.h>
+    typedef atomic_size_t RtpSpscPacketQueueIndex_t;
+#else
+    typedef size_t RtpSpscPacketQueueIndex_t;
+#endif
+
+/*-----------------------------------------------------------*/
+
+typedef struct RtpSpscPacketQueue
+{
+    /* Set at init and read-only afterwards. */
+    RtpPacketInfo_t * pRtpPacketInfoArray;
+    size_t indexMask;
+    uint8_t padding0[ RTP_SPSC_PACKET_QUEUE_CACHE_LINE_SIZE ];
+
+    /* Owned by the producer. The indices are free running and never wrapped. */
+    RtpSpscPacketQueueIndex_t writeIndex;
+    size_t cachedReadIndex; /* Last read index seen by the producer. */
+    uint8_t padding1[ RTP_SPSC_PACKET_QUEUE_CACHE_LINE_SIZE ];
+
+    /* Owned by the consumer. */
+    RtpSpscPacketQueueIndex_t readIndex;
+    size_t cachedWriteIndex; /* Last write index seen by the consumer. */
+    uint8_t padding2[ RTP_SPSC_PACKET_QUEUE_CACHE_LINE_SIZE ];
+} RtpSpscPacketQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/* The length of the RTP packet info array must be a power of two. */
+RtpPacketQueueResult_t RtpSpscPacketQueue_Init( RtpSpscPacketQueue_t * pQueue,
+                                                RtpPacketInfo_t * pRtpPacketInfoArray,
+                                                size_t rtpPacketInfoArrayLength );
+
+/* Producer only. */
+RtpPacketQueueResult_t RtpSpscPacketQueue_Enqueue( RtpSpscPacketQueue_t * pQueue,
+                                                   const RtpPacketInfo_t * pRtpPacketInfo );
+
+/* Consumer only. */
+RtpPacketQueueResult_t RtpSpscPacketQueue_Dequeue( RtpSpscPacketQueue_t * pQueue,
+                                                   RtpPacketInfo_t * pRtpPacketInfo );
+
+/* Consumer only. */
+RtpPacketQueueResult_t RtpSpscPacketQueue_Peek( RtpSpscPacketQueue_t * pQueue,
+                                                RtpPacketInfo_t * pRtpPacketInfo );
+
+/*-----------------------------------------------------------*/
+
+#endif /* RTP_SPSC_PACKET_QUEUE_H */
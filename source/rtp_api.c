@@ -62,28 +62,166 @@
 #define RTP_HEADER_MIN_LENGTH                   12 /* No CSRC and no extension. */
 
 /* Read, Write macros. */
-#define RTP_WRITE_UINT32   ( pCtx->readWriteFunctions.writeUint32Fn )
-#define RTP_READ_UINT32    ( pCtx->readWriteFunctions.readUint32Fn )
+#define RTP_WRITE_UINT32   Rtp_WriteUint32
+#define RTP_READ_UINT32    Rtp_ReadUint32
 
 /*-----------------------------------------------------------*/
 
+static size_t CalculateSerializedHeaderLength( const RtpHeader_t * pHeader );
+
 static size_t CalculateSerializedPacketLength( const RtpPacket_t * pRtpPacket );
 
+static RtpResult_t ValidatePayloadPadding( const RtpPacket_t * pRtpPacket );
+
+static uint32_t CreateFirstWord( const RtpHeader_t * pHeader );
+
+static size_t SerializeHeader( const RtpHeader_t * pHeader,
+                               uint32_t firstWord,
+                               uint8_t * pBuffer );
+
 /*-----------------------------------------------------------*/
 
-static size_t CalculateSerializedPacketLength( const RtpPacket_t * pRtpPacket )
+static size_t CalculateSerializedHeaderLength( const RtpHeader_t * pHeader )
 {
     size_t headerLength = RTP_HEADER_MIN_LENGTH +
-                          ( pRtpPacket->header.csrcCount * sizeof( uint32_t ) );
+                          ( pHeader->csrcCount * sizeof( uint32_t ) );
 
-    if( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_EXTENSION ) != 0 )
+    if( ( pHeader->flags & RTP_HEADER_FLAG_EXTENSION ) != 0 )
     {
         headerLength = headerLength +
                        4 + /* Extension header. */
-                       ( pRtpPacket->header.extension.extensionPayloadLength * sizeof( uint32_t ) );
+                       ( pHeader->extension.extensionPayloadLength * sizeof( uint32_t ) );
     }
 
-    return headerLength + pRtpPacket->payloadLength;
+    return headerLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t CalculateSerializedPacketLength( const RtpPacket_t * pRtpPacket )
+{
+    return CalculateSerializedHeaderLength( &( pRtpPacket->header ) ) +
+           pRtpPacket->payloadLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpResult_t ValidatePayloadPadding( const RtpPacket_t * pRtpPacket )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+    uint8_t numPaddingOctets;
+
+    if( ( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_PADDING ) != 0 ) &&
+        ( pRtpPacket->pPayload != NULL ) &&
+        ( pRtpPacket->payloadLength > 0 ) )
+    {
+        /* From RFC3550, section 5.1: The last octet of the padding
+         * contains a count of how many padding octets should be
+         * ignored, including itself. */
+        numPaddingOctets = pRtpPacket->pPayload[ pRtpPacket->payloadLength - 1 ];
+
+        if( numPaddingOctets > pRtpPacket->payloadLength )
+        {
+            /* The number of padding octets cannot be larger than the
+             * payload length. */
+            result = RTP_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t CreateFirstWord( const RtpHeader_t * pHeader )
+{
+    uint32_t firstWord;
+
+    firstWord = ( ( uint32_t ) RTP_HEADER_VERSION << RTP_HEADER_VERSION_LOCATION );
+
+    if( ( pHeader->flags & RTP_HEADER_FLAG_PADDING ) != 0 )
+    {
+        firstWord |= ( 1 << RTP_HEADER_PADDING_LOCATION );
+    }
+
+    if( ( pHeader->flags & RTP_HEADER_FLAG_EXTENSION ) != 0 )
+    {
+        firstWord |= ( 1 << RTP_HEADER_EXTENSION_LOCATION );
+    }
+
+    firstWord |= ( ( ( uint32_t ) pHeader->csrcCount <<
+                     RTP_HEADER_CSRC_COUNT_LOCATION ) &
+                   RTP_HEADER_CSRC_COUNT_MASK );
+
+    if( ( pHeader->flags & RTP_HEADER_FLAG_MARKER ) != 0 )
+    {
+        firstWord |= ( 1 << RTP_HEADER_MARKER_LOCATION );
+    }
+
+    firstWord |= ( ( ( uint32_t ) pHeader->payloadType <<
+                     RTP_HEADER_PAYLOAD_TYPE_LOCATION ) &
+                   RTP_HEADER_PAYLOAD_TYPE_MASK );
+
+    firstWord |= ( ( ( uint32_t ) pHeader->sequenceNumber <<
+                     RTP_HEADER_SEQUENCE_NUMBER_LOCATION ) &
+                   RTP_HEADER_SEQUENCE_NUMBER_MASK );
+
+    return firstWord;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Writes the header, starting with the first word built by the caller, and
+ * returns the number of bytes written. */
+static size_t SerializeHeader( const RtpHeader_t * pHeader,
+                               uint32_t firstWord,
+                               uint8_t * pBuffer )
+{
+    size_t i, currentIndex = 0;
+    uint32_t extensionHeader;
+
+    RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                      firstWord );
+    currentIndex += 4;
+
+    RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                      pHeader->timestamp );
+    currentIndex += 4;
+
+    RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                      pHeader->ssrc );
+    currentIndex += 4;
+
+    for( i = 0; i < pHeader->csrcCount; i++ )
+    {
+        RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                          pHeader->pCsrc[ i ] );
+        currentIndex += 4;
+    }
+
+    if( ( pHeader->flags & RTP_HEADER_FLAG_EXTENSION ) != 0 )
+    {
+        extensionHeader = ( ( ( uint32_t ) pHeader->extension.extensionProfile <<
+                              RTP_EXTENSION_HEADER_PROFILE_LOCATION ) &
+                            RTP_EXTENSION_HEADER_PROFILE_MASK );
+
+        extensionHeader |= ( ( ( uint32_t ) pHeader->extension.extensionPayloadLength <<
+                               RTP_EXTENSION_HEADER_LENGTH_LOCATION ) &
+                             RTP_EXTENSION_HEADER_LENGTH_MASK );
+
+        RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                          extensionHeader );
+        currentIndex += 4;
+
+        for( i = 0; i < pHeader->extension.extensionPayloadLength; i++ )
+        {
+            RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
+                              pHeader->extension.pExtensionPayload[ i ] );
+            currentIndex += 4;
+        }
+    }
+
+    return currentIndex;
 }
 
 /*-----------------------------------------------------------*/
@@ -112,10 +250,9 @@ RtpResult_t Rtp_Serialize( RtpContext_t * pCtx,
                            uint8_t * pBuffer,
                            size_t * pLength )
 {
-    size_t i, serializedPacketLength, currentIndex = 0;
-    uint32_t firstWord, extensionHeader;
+    size_t serializedPacketLength, currentIndex = 0;
+    uint32_t firstWord;
     RtpResult_t result = RTP_RESULT_OK;
-    uint8_t numPaddingOctets;
 
     if( ( pCtx == NULL ) ||
         ( pRtpPacket == NULL ) ||
@@ -142,100 +279,84 @@ RtpResult_t Rtp_Serialize( RtpContext_t * pCtx,
     if( ( result == RTP_RESULT_OK ) &&
         ( pBuffer != NULL ) )
     {
-        firstWord = ( RTP_HEADER_VERSION << RTP_HEADER_VERSION_LOCATION );
+        firstWord = CreateFirstWord( &( pRtpPacket->header ) );
 
-        if( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_PADDING ) != 0 )
-        {
-            firstWord |= ( 1 << RTP_HEADER_PADDING_LOCATION );
-        }
+        currentIndex = SerializeHeader( &( pRtpPacket->header ),
+                                        firstWord,
+                                        pBuffer );
 
-        if( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_EXTENSION ) != 0 )
+        if( ( pRtpPacket->pPayload != NULL ) &&
+            ( pRtpPacket->payloadLength > 0 ) )
         {
-            firstWord |= ( 1 << RTP_HEADER_EXTENSION_LOCATION );
-        }
+            result = ValidatePayloadPadding( pRtpPacket );
 
-        firstWord |= ( ( ( uint32_t ) pRtpPacket->header.csrcCount <<
-                         RTP_HEADER_CSRC_COUNT_LOCATION ) &
-                       RTP_HEADER_CSRC_COUNT_MASK );
-
-        if( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_MARKER ) != 0 )
-        {
-            firstWord |= ( 1 << RTP_HEADER_MARKER_LOCATION );
+            if( result == RTP_RESULT_OK )
+            {
+                memcpy( ( void * ) &( pBuffer[ currentIndex ] ),
+                        ( const void * ) &( pRtpPacket->pPayload[ 0 ] ),
+                        pRtpPacket->payloadLength );
+            }
         }
+    }
 
-        firstWord |= ( ( ( uint32_t ) pRtpPacket->header.payloadType <<
-                         RTP_HEADER_PAYLOAD_TYPE_LOCATION ) &
-                       RTP_HEADER_PAYLOAD_TYPE_MASK );
+    return result;
+}
 
-        firstWord |= ( ( ( uint32_t ) pRtpPacket->header.sequenceNumber <<
-                         RTP_HEADER_SEQUENCE_NUMBER_LOCATION ) &
-                       RTP_HEADER_SEQUENCE_NUMBER_MASK );
+/*-----------------------------------------------------------*/
 
-        RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
-                          firstWord );
-        currentIndex += 4;
+RtpResult_t Rtp_SerializeIoVec( RtpContext_t * pCtx,
+                                const RtpPacket_t * pRtpPacket,
+                                uint8_t * pHeaderBuffer,
+                                size_t headerBufferLength,
+                                RtpIoVec_t * pIoVecArray )
+{
+    size_t headerLength;
+    RtpResult_t result = RTP_RESULT_OK;
 
-        RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
-                          pRtpPacket->header.timestamp );
-        currentIndex += 4;
+    if( ( pCtx == NULL ) ||
+        ( pRtpPacket == NULL ) ||
+        ( pHeaderBuffer == NULL ) ||
+        ( pIoVecArray == NULL ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
 
-        RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
-                          pRtpPacket->header.ssrc );
-        currentIndex += 4;
+    if( result == RTP_RESULT_OK )
+    {
+        headerLength = CalculateSerializedHeaderLength( &( pRtpPacket->header ) );
 
-        for( i = 0; i < pRtpPacket->header.csrcCount; i++ )
+        if( headerBufferLength < headerLength )
         {
-            RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
-                              pRtpPacket->header.pCsrc[ i ] );
-            currentIndex += 4;
+            result = RTP_RESULT_OUT_OF_MEMORY;
         }
+    }
 
-        if( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_EXTENSION ) != 0 )
-        {
-            extensionHeader = ( ( ( uint32_t ) pRtpPacket->header.extension.extensionProfile <<
-                                  RTP_EXTENSION_HEADER_PROFILE_LOCATION ) &
-                                RTP_EXTENSION_HEADER_PROFILE_MASK );
-
-            extensionHeader |= ( ( ( uint32_t ) pRtpPacket->header.extension.extensionPayloadLength <<
-                                   RTP_EXTENSION_HEADER_LENGTH_LOCATION ) &
-                                 RTP_EXTENSION_HEADER_LENGTH_MASK );
+    if( result == RTP_RESULT_OK )
+    {
+        result = ValidatePayloadPadding( pRtpPacket );
+    }
 
-            RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
-                              extensionHeader );
-            currentIndex += 4;
+    if( result == RTP_RESULT_OK )
+    {
+        ( void ) SerializeHeader( &( pRtpPacket->header ),
+                                  CreateFirstWord( &( pRtpPacket->header ) ),
+                                  pHeaderBuffer );
 
-            for( i = 0; i < pRtpPacket->header.extension.extensionPayloadLength; i++ )
-            {
-                RTP_WRITE_UINT32( &( pBuffer[ currentIndex ] ),
-                                  pRtpPacket->header.extension.pExtensionPayload[ i ] );
-                currentIndex += 4;
-            }
-        }
+        pIoVecArray[ RTP_IOVEC_HEADER_INDEX ].pBase = pHeaderBuffer;
+        pIoVecArray[ RTP_IOVEC_HEADER_INDEX ].length = headerLength;
 
+        /* The payload is not copied - the second vector points to the
+         * caller's payload buffer. */
         if( ( pRtpPacket->pPayload != NULL ) &&
             ( pRtpPacket->payloadLength > 0 ) )
         {
-            if( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_PADDING ) != 0 )
-            {
-                /* From RFC3550, section 5.1: The last octet of the padding
-                 * contains a count of how many padding octets should be
-                 * ignored, including itself. */
-                numPaddingOctets = pRtpPacket->pPayload[ pRtpPacket->payloadLength - 1 ];
-
-                if( numPaddingOctets > pRtpPacket->payloadLength )
-                {
-                    /* The number of padding octets cannot be larger than the
-                     * payload length. */
-                    result = RTP_RESULT_MALFORMED_PACKET;
-                }
-            }
-
-            if( result == RTP_RESULT_OK )
-            {
-                memcpy( ( void * ) &( pBuffer[ currentIndex ] ),
-                        ( const void * ) &( pRtpPacket->pPayload[ 0 ] ),
-                        pRtpPacket->payloadLength );
-            }
+            pIoVecArray[ RTP_IOVEC_PAYLOAD_INDEX ].pBase = pRtpPacket->pPayload;
+            pIoVecArray[ RTP_IOVEC_PAYLOAD_INDEX ].length = pRtpPacket->payloadLength;
+        }
+        else
+        {
+            pIoVecArray[ RTP_IOVEC_PAYLOAD_INDEX ].pBase = NULL;
+            pIoVecArray[ RTP_IOVEC_PAYLOAD_INDEX ].length = 0;
         }
     }
 
@@ -244,20 +365,20 @@ RtpResult_t Rtp_Serialize( RtpContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
-RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
-                             uint8_t * pSerializedPacket,
-                             size_t serializedPacketLength,
-                             RtpPacket_t * pRtpPacket )
+RtpResult_t Rtp_DeSerializeView( RtpContext_t * pCtx,
+                                 const uint8_t * pSerializedPacket,
+                                 size_t serializedPacketLength,
+                                 RtpPacketView_t * pView )
 {
-    size_t i, currentIndex = 0;
-    uint32_t firstWord, extensionHeader, word;
+    size_t currentIndex = 0;
+    uint32_t firstWord, extensionHeader;
     RtpResult_t result = RTP_RESULT_OK;
     uint8_t numPaddingOctets;
 
     if( ( pCtx == NULL ) ||
         ( pSerializedPacket == NULL ) ||
         ( serializedPacketLength < RTP_HEADER_MIN_LENGTH ) ||
-        ( pRtpPacket == NULL ) )
+        ( pView == NULL ) )
     {
         result = RTP_RESULT_BAD_PARAM;
     }
@@ -276,46 +397,45 @@ RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
 
     if( result == RTP_RESULT_OK )
     {
-        pRtpPacket->header.flags = 0;
+        pView->pSerializedPacket = pSerializedPacket;
+        pView->serializedPacketLength = serializedPacketLength;
+        pView->flags = 0;
 
         if( ( firstWord & RTP_HEADER_PADDING_MASK ) != 0 )
         {
-            pRtpPacket->header.flags |= RTP_HEADER_FLAG_PADDING;
+            pView->flags |= RTP_HEADER_FLAG_PADDING;
         }
 
-        pRtpPacket->header.csrcCount = ( firstWord & RTP_HEADER_CSRC_COUNT_MASK ) >>
-                                       RTP_HEADER_CSRC_COUNT_LOCATION;
+        pView->csrcCount = ( firstWord & RTP_HEADER_CSRC_COUNT_MASK ) >>
+                           RTP_HEADER_CSRC_COUNT_LOCATION;
 
         if( ( firstWord & RTP_HEADER_MARKER_MASK ) != 0 )
         {
-            pRtpPacket->header.flags |= RTP_HEADER_FLAG_MARKER;
+            pView->flags |= RTP_HEADER_FLAG_MARKER;
         }
 
-        pRtpPacket->header.payloadType = ( firstWord & RTP_HEADER_PAYLOAD_TYPE_MASK ) >>
-                                         RTP_HEADER_PAYLOAD_TYPE_LOCATION;
-        pRtpPacket->header.sequenceNumber = ( firstWord & RTP_HEADER_SEQUENCE_NUMBER_MASK ) >>
-                                            RTP_HEADER_SEQUENCE_NUMBER_LOCATION;
+        pView->payloadType = ( firstWord & RTP_HEADER_PAYLOAD_TYPE_MASK ) >>
+                             RTP_HEADER_PAYLOAD_TYPE_LOCATION;
+        pView->sequenceNumber = ( firstWord & RTP_HEADER_SEQUENCE_NUMBER_MASK ) >>
+                                RTP_HEADER_SEQUENCE_NUMBER_LOCATION;
 
-        pRtpPacket->header.timestamp = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
+        pView->timestamp = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
         currentIndex += 4;
 
-        pRtpPacket->header.ssrc = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
+        pView->ssrc = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
         currentIndex += 4;
 
-        if( pRtpPacket->header.csrcCount > 0 )
+        pView->extensionProfile = 0;
+        pView->extensionPayloadLength = 0;
+        pView->pExtensionPayload = NULL;
+
+        if( pView->csrcCount > 0 )
         {
             /* Is there enough data to read CSRCs? */
-            if( ( currentIndex + ( pRtpPacket->header.csrcCount * sizeof( uint32_t ) ) ) <= serializedPacketLength )
+            if( ( currentIndex + ( pView->csrcCount * sizeof( uint32_t ) ) ) <= serializedPacketLength )
             {
-                pRtpPacket->header.pCsrc = ( uint32_t * ) &( pSerializedPacket[ currentIndex ] );
-
-                for( i = 0; i < pRtpPacket->header.csrcCount; i++ )
-                {
-                    word = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
-                    currentIndex += 4;
-
-                    pRtpPacket->header.pCsrc[ i ] = word;
-                }
+                pView->pCsrc = &( pSerializedPacket[ currentIndex ] );
+                currentIndex += ( pView->csrcCount * sizeof( uint32_t ) );
             }
             else
             {
@@ -324,7 +444,7 @@ RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
         }
         else
         {
-            pRtpPacket->header.pCsrc = NULL;
+            pView->pCsrc = NULL;
         }
     }
 
@@ -332,7 +452,7 @@ RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
     {
         if( ( firstWord & RTP_HEADER_EXTENSION_MASK ) != 0 )
         {
-            pRtpPacket->header.flags |= RTP_HEADER_FLAG_EXTENSION;
+            pView->flags |= RTP_HEADER_FLAG_EXTENSION;
 
             /* Is there enough data to read extension header? */
             if( ( currentIndex + sizeof( uint32_t ) ) <= serializedPacketLength )
@@ -340,12 +460,12 @@ RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
                 extensionHeader = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
                 currentIndex += 4;
 
-                pRtpPacket->header.extension.extensionProfile = ( extensionHeader &
-                                                                  RTP_EXTENSION_HEADER_PROFILE_MASK ) >>
-                                                                RTP_EXTENSION_HEADER_PROFILE_LOCATION;
-                pRtpPacket->header.extension.extensionPayloadLength = ( extensionHeader &
-                                                                        RTP_EXTENSION_HEADER_LENGTH_MASK ) >>
-                                                                      RTP_EXTENSION_HEADER_LENGTH_LOCATION;
+                pView->extensionProfile = ( extensionHeader &
+                                            RTP_EXTENSION_HEADER_PROFILE_MASK ) >>
+                                          RTP_EXTENSION_HEADER_PROFILE_LOCATION;
+                pView->extensionPayloadLength = ( extensionHeader &
+                                                  RTP_EXTENSION_HEADER_LENGTH_MASK ) >>
+                                                RTP_EXTENSION_HEADER_LENGTH_LOCATION;
             }
             else
             {
@@ -356,18 +476,10 @@ RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
             {
                 /* Is there enough data to read extension payload? */
                 if( ( currentIndex +
-                      ( pRtpPacket->header.extension.extensionPayloadLength *
-                        sizeof( uint32_t ) ) ) <= serializedPacketLength )
+                      ( pView->extensionPayloadLength * sizeof( uint32_t ) ) ) <= serializedPacketLength )
                 {
-                    pRtpPacket->header.extension.pExtensionPayload = ( uint32_t * ) &( pSerializedPacket[ currentIndex ] );
-
-                    for( i = 0; i < pRtpPacket->header.extension.extensionPayloadLength; i++ )
-                    {
-                        word = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
-                        currentIndex += 4;
-
-                        pRtpPacket->header.extension.pExtensionPayload[ i ] = word;
-                    }
+                    pView->pExtensionPayload = &( pSerializedPacket[ currentIndex ] );
+                    currentIndex += ( pView->extensionPayloadLength * sizeof( uint32_t ) );
                 }
                 else
                 {
@@ -381,19 +493,19 @@ RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
     {
         if( currentIndex < serializedPacketLength )
         {
-            pRtpPacket->pPayload = &( pSerializedPacket[ currentIndex ] );
-            pRtpPacket->payloadLength = ( serializedPacketLength - currentIndex );
+            pView->pPayload = &( pSerializedPacket[ currentIndex ] );
+            pView->payloadLength = ( serializedPacketLength - currentIndex );
 
-            if( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_PADDING ) != 0 )
+            if( ( pView->flags & RTP_HEADER_FLAG_PADDING ) != 0 )
             {
                 /* From RFC3550, section 5.1: The last octet of the padding
                  * contains a count of how many padding octets should be
                  * ignored, including itself. */
-                numPaddingOctets = pRtpPacket->pPayload[ pRtpPacket->payloadLength - 1 ];
+                numPaddingOctets = pView->pPayload[ pView->payloadLength - 1 ];
 
-                if( numPaddingOctets <= pRtpPacket->payloadLength )
+                if( numPaddingOctets <= pView->payloadLength )
                 {
-                    pRtpPacket->payloadLength -= numPaddingOctets;
+                    pView->payloadLength -= numPaddingOctets;
                 }
                 else
                 {
@@ -404,10 +516,436 @@ RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
             }
         }
         else
+        {
+            pView->pPayload = NULL;
+            pView->payloadLength = 0;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpResult_t Rtp_GetCsrc( RtpContext_t * pCtx,
+                         const RtpPacketView_t * pView,
+                         size_t index,
+                         uint32_t * pCsrc )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pView == NULL ) ||
+        ( index >= pView->csrcCount ) ||
+        ( pCsrc == NULL ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        *pCsrc = RTP_READ_UINT32( &( pView->pCsrc[ index * sizeof( uint32_t ) ] ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpResult_t Rtp_GetExtensionPayloadWord( RtpContext_t * pCtx,
+                                         const RtpPacketView_t * pView,
+                                         size_t index,
+                                         uint32_t * pWord )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pView == NULL ) ||
+        ( index >= pView->extensionPayloadLength ) ||
+        ( pWord == NULL ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        *pWord = RTP_READ_UINT32( &( pView->pExtensionPayload[ index * sizeof( uint32_t ) ] ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpResult_t Rtp_DeSerialize( RtpContext_t * pCtx,
+                             uint8_t * pSerializedPacket,
+                             size_t serializedPacketLength,
+                             RtpPacket_t * pRtpPacket )
+{
+    size_t i, currentIndex;
+    uint32_t word;
+    RtpPacketView_t view;
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( pRtpPacket == NULL )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        result = Rtp_DeSerializeView( pCtx,
+                                      pSerializedPacket,
+                                      serializedPacketLength,
+                                      &( view ) );
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        pRtpPacket->header.flags = view.flags;
+        pRtpPacket->header.csrcCount = view.csrcCount;
+        pRtpPacket->header.payloadType = view.payloadType;
+        pRtpPacket->header.sequenceNumber = view.sequenceNumber;
+        pRtpPacket->header.timestamp = view.timestamp;
+        pRtpPacket->header.ssrc = view.ssrc;
+
+        /* CSRCs and extension payload are converted to host byte order in
+         * place so that they can be accessed as uint32_t arrays. */
+        if( view.csrcCount > 0 )
+        {
+            currentIndex = ( size_t ) ( view.pCsrc - pSerializedPacket );
+            pRtpPacket->header.pCsrc = ( uint32_t * ) &( pSerializedPacket[ currentIndex ] );
+
+            for( i = 0; i < view.csrcCount; i++ )
+            {
+                word = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
+                currentIndex += 4;
+
+                pRtpPacket->header.pCsrc[ i ] = word;
+            }
+        }
+        else
+        {
+            pRtpPacket->header.pCsrc = NULL;
+        }
+
+        if( ( view.flags & RTP_HEADER_FLAG_EXTENSION ) != 0 )
+        {
+            pRtpPacket->header.extension.extensionProfile = view.extensionProfile;
+            pRtpPacket->header.extension.extensionPayloadLength = view.extensionPayloadLength;
+
+            currentIndex = ( size_t ) ( view.pExtensionPayload - pSerializedPacket );
+            pRtpPacket->header.extension.pExtensionPayload = ( uint32_t * ) &( pSerializedPacket[ currentIndex ] );
+
+            for( i = 0; i < view.extensionPayloadLength; i++ )
+            {
+                word = RTP_READ_UINT32( &( pSerializedPacket[ currentIndex ] ) );
+                currentIndex += 4;
+
+                pRtpPacket->header.extension.pExtensionPayload[ i ] = word;
+            }
+        }
+
+        if( view.pPayload != NULL )
+        {
+            pRtpPacket->pPayload = &( pSerializedPacket[ view.pPayload - pSerializedPacket ] );
+        }
+        else
         {
             pRtpPacket->pPayload = NULL;
-            pRtpPacket->payloadLength = 0;
         }
+
+        pRtpPacket->payloadLength = view.payloadLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpResult_t Rtp_InitSenderContext( RtpContext_t * pCtx,
+                                   RtpSenderContext_t * pSenderCtx,
+                                   const RtpHeader_t * pHeader )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pSenderCtx == NULL ) ||
+        ( pHeader == NULL ) ||
+        ( pHeader->csrcCount > RTP_HEADER_MAX_CSRC_COUNT ) ||
+        ( ( pHeader->csrcCount > 0 ) && ( pHeader->pCsrc == NULL ) ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTP_RESULT_OK ) &&
+        ( ( pHeader->flags & RTP_HEADER_FLAG_EXTENSION ) != 0 ) )
+    {
+        if( pHeader->extension.extensionPayloadLength > RTP_SENDER_MAX_EXTENSION_PAYLOAD_LENGTH )
+        {
+            result = RTP_RESULT_OUT_OF_MEMORY;
+        }
+        else if( ( pHeader->extension.extensionPayloadLength > 0 ) &&
+                 ( pHeader->extension.pExtensionPayload == NULL ) )
+        {
+            result = RTP_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        /* Padding, marker and sequence number are decided per packet. */
+        pSenderCtx->firstWord = CreateFirstWord( pHeader ) &
+                                ~( RTP_HEADER_PADDING_MASK |
+                                   RTP_HEADER_MARKER_MASK |
+                                   RTP_HEADER_SEQUENCE_NUMBER_MASK );
+
+        pSenderCtx->headerTemplateLength = SerializeHeader( pHeader,
+                                                            pSenderCtx->firstWord,
+                                                            &( pSenderCtx->headerTemplate[ 0 ] ) );
+
+        pSenderCtx->nextSequenceNumber = pHeader->sequenceNumber;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpResult_t Rtp_SerializeBatch( RtpContext_t * pCtx,
+                                RtpSenderContext_t * pSenderCtx,
+                                uint32_t timestamp,
+                                uint32_t flags,
+                                RtpBatchPacket_t * pPackets,
+                                size_t packetCount )
+{
+    size_t i;
+    uint32_t firstWord;
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pSenderCtx == NULL ) ||
+        ( pPackets == NULL ) ||
+        ( packetCount == 0 ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    /* Validate all the packets before writing any, so that either all or none
+     * of the packets are serialized and the sequence numbers stay in sync. */
+    for( i = 0; ( result == RTP_RESULT_OK ) && ( i < packetCount ); i++ )
+    {
+        if( ( pPackets[ i ].pBuffer == NULL ) ||
+            ( ( pPackets[ i ].pPayload == NULL ) && ( pPackets[ i ].payloadLength > 0 ) ) )
+        {
+            result = RTP_RESULT_BAD_PARAM;
+        }
+        else if( pPackets[ i ].bufferLength < ( pSenderCtx->headerTemplateLength +
+                                                pPackets[ i ].payloadLength ) )
+        {
+            result = RTP_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    for( i = 0; ( result == RTP_RESULT_OK ) && ( i < packetCount ); i++ )
+    {
+        /* Only the sequence number, marker and timestamp change from packet
+         * to packet - everything else comes from the template. */
+        firstWord = pSenderCtx->firstWord |
+                    ( ( ( uint32_t ) pSenderCtx->nextSequenceNumber <<
+                        RTP_HEADER_SEQUENCE_NUMBER_LOCATION ) &
+                      RTP_HEADER_SEQUENCE_NUMBER_MASK );
+
+        if( ( i == ( packetCount - 1 ) ) &&
+            ( ( flags & RTP_HEADER_FLAG_MARKER ) != 0 ) )
+        {
+            firstWord |= ( 1 << RTP_HEADER_MARKER_LOCATION );
+        }
+
+        RTP_WRITE_UINT32( &( pPackets[ i ].pBuffer[ 0 ] ),
+                          firstWord );
+        RTP_WRITE_UINT32( &( pPackets[ i ].pBuffer[ 4 ] ),
+                          timestamp );
+
+        memcpy( ( void * ) &( pPackets[ i ].pBuffer[ 8 ] ),
+                ( const void * ) &( pSenderCtx->headerTemplate[ 8 ] ),
+                pSenderCtx->headerTemplateLength - 8 );
+
+        if( pPackets[ i ].payloadLength > 0 )
+        {
+            memcpy( ( void * ) &( pPackets[ i ].pBuffer[ pSenderCtx->headerTemplateLength ] ),
+                    ( const void * ) &( pPackets[ i ].pPayload[ 0 ] ),
+                    pPackets[ i ].payloadLength );
+        }
+
+        pPackets[ i ].bufferLength = pSenderCtx->headerTemplateLength +
+                                     pPackets[ i ].payloadLength;
+
+        pSenderCtx->nextSequenceNumber += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpResult_t Rtp_PeekHeader( const uint8_t * pSerializedPacket,
+                            size_t serializedPacketLength,
+                            RtpFixedHeader_t * pHeader )
+{
+    uint32_t firstWord;
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( ( pSerializedPacket == NULL ) ||
+        ( serializedPacketLength < RTP_HEADER_MIN_LENGTH ) ||
+        ( pHeader == NULL ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        firstWord = RTP_READ_UINT32( &( pSerializedPacket[ 0 ] ) );
+
+        if( ( ( firstWord & RTP_HEADER_VERSION_MASK ) >>
+              RTP_HEADER_VERSION_LOCATION ) != RTP_HEADER_VERSION )
+        {
+            result = RTP_RESULT_WRONG_VERSION;
+        }
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        pHeader->flags = 0;
+
+        if( ( firstWord & RTP_HEADER_PADDING_MASK ) != 0 )
+        {
+            pHeader->flags |= RTP_HEADER_FLAG_PADDING;
+        }
+
+        if( ( firstWord & RTP_HEADER_EXTENSION_MASK ) != 0 )
+        {
+            pHeader->flags |= RTP_HEADER_FLAG_EXTENSION;
+        }
+
+        if( ( firstWord & RTP_HEADER_MARKER_MASK ) != 0 )
+        {
+            pHeader->flags |= RTP_HEADER_FLAG_MARKER;
+        }
+
+        pHeader->csrcCount = ( firstWord & RTP_HEADER_CSRC_COUNT_MASK ) >>
+                             RTP_HEADER_CSRC_COUNT_LOCATION;
+        pHeader->payloadType = ( firstWord & RTP_HEADER_PAYLOAD_TYPE_MASK ) >>
+                               RTP_HEADER_PAYLOAD_TYPE_LOCATION;
+        pHeader->sequenceNumber = ( firstWord & RTP_HEADER_SEQUENCE_NUMBER_MASK ) >>
+                                  RTP_HEADER_SEQUENCE_NUMBER_LOCATION;
+        pHeader->timestamp = RTP_READ_UINT32( &( pSerializedPacket[ 4 ] ) );
+        pHeader->ssrc = RTP_READ_UINT32( &( pSerializedPacket[ 8 ] ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpResult_t Rtp_PeekPayloadOffset( const uint8_t * pSerializedPacket,
+                                   size_t serializedPacketLength,
+                                   RtpFixedHeader_t * pHeader,
+                                   size_t * pPayloadOffset,
+                                   size_t * pPayloadLength )
+{
+    size_t payloadOffset, payloadLength = 0;
+    uint8_t numPaddingOctets;
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( ( pPayloadOffset == NULL ) ||
+        ( pPayloadLength == NULL ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        result = Rtp_PeekHeader( pSerializedPacket,
+                                 serializedPacketLength,
+                                 pHeader );
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        payloadOffset = RTP_HEADER_MIN_LENGTH +
+                        ( pHeader->csrcCount * sizeof( uint32_t ) );
+
+        if( ( pHeader->flags & RTP_HEADER_FLAG_EXTENSION ) != 0 )
+        {
+            /* Is there enough data to read extension header? */
+            if( ( payloadOffset + sizeof( uint32_t ) ) <= serializedPacketLength )
+            {
+                payloadOffset += sizeof( uint32_t ) +
+                                 ( Rtp_ReadUint16( &( pSerializedPacket[ payloadOffset + 2 ] ) ) * sizeof( uint32_t ) );
+            }
+            else
+            {
+                result = RTP_RESULT_MALFORMED_PACKET;
+            }
+        }
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        if( payloadOffset <= serializedPacketLength )
+        {
+            payloadLength = serializedPacketLength - payloadOffset;
+        }
+        else
+        {
+            result = RTP_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    if( ( result == RTP_RESULT_OK ) &&
+        ( ( pHeader->flags & RTP_HEADER_FLAG_PADDING ) != 0 ) &&
+        ( payloadLength > 0 ) )
+    {
+        numPaddingOctets = pSerializedPacket[ serializedPacketLength - 1 ];
+
+        if( numPaddingOctets <= payloadLength )
+        {
+            payloadLength -= numPaddingOctets;
+        }
+        else
+        {
+            result = RTP_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        *pPayloadOffset = payloadOffset;
+        *pPayloadLength = payloadLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpResult_t Rtp_PeekSsrc( const uint8_t * pSerializedPacket,
+                          size_t serializedPacketLength,
+                          uint32_t * pSsrc )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( ( pSerializedPacket == NULL ) ||
+        ( serializedPacketLength < RTP_HEADER_MIN_LENGTH ) ||
+        ( pSsrc == NULL ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        *pSsrc = RTP_READ_UINT32( &( pSerializedPacket[ 8 ] ) );
     }
 
     return result;
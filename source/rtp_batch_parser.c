@@ -0,0 +1,299 @@
+/* API includes. */
+#include "rtp_batch_parser.h"
+#include "rtp_endianness.h"
+
+/* SIMD includes. The vector path is selected at build time, based on the
+ * instruction sets enabled for the compiler (for example -mavx2 or
+ * -mssse3). */
+#if defined( __AVX2__ )
+    #include <immintrin.h>
+    #define RTP_BATCH_PARSER_USE_AVX2
+#elif defined( __SSSE3__ )
+    #include <tmmintrin.h>
+    #define RTP_BATCH_PARSER_USE_SSSE3
+#endif
+
+/*-----------------------------------------------------------*/
+
+#define RTP_HEADER_MIN_LENGTH           12
+#define RTP_HEADER_VERSION              2
+
+#define RTP_HEADER_VERSION_MASK         0xC0
+#define RTP_HEADER_VERSION_LOCATION     6
+#define RTP_HEADER_EXTENSION_MASK       0x10
+#define RTP_HEADER_CSRC_COUNT_MASK      0x0F
+#define RTP_HEADER_MARKER_MASK          0x80
+#define RTP_HEADER_PAYLOAD_TYPE_MASK    0x7F
+
+/* Number of bytes loaded by one 128-bit vector load. Packets shorter than this
+ * are parsed using the scalar path so that the load never reads past the end
+ * of the packet. */
+#define RTP_BATCH_PARSER_VECTOR_LOAD_LENGTH  16
+
+/* Indices of the words in the unpacked header. */
+#define UNPACKED_TIMESTAMP_INDEX        0
+#define UNPACKED_SSRC_INDEX             1
+#define UNPACKED_SEQUENCE_NUMBER_INDEX  2
+#define UNPACKED_FIRST_BYTES_INDEX      3 /* First byte in bits 0-7, second byte in bits 8-15. */
+#define UNPACKED_WORD_COUNT             4
+
+/*-----------------------------------------------------------*/
+
+static void UnpackHeaderScalar( const uint8_t * pPacket,
+                                uint32_t * pUnpacked );
+
+static size_t CalculatePayloadOffset( const uint8_t * pPacket,
+                                      size_t packetLength,
+                                      uint8_t firstByte );
+
+static uint8_t StoreHeader( const uint8_t * pPacket,
+                            size_t packetLength,
+                            const uint32_t * pUnpacked,
+                            RtpBatchHeaders_t * pHeaders,
+                            size_t index );
+
+static uint8_t ParseHeaderScalar( const uint8_t * pPacket,
+                                  size_t packetLength,
+                                  RtpBatchHeaders_t * pHeaders,
+                                  size_t index );
+
+#if defined( RTP_BATCH_PARSER_USE_AVX2 ) || defined( RTP_BATCH_PARSER_USE_SSSE3 )
+
+/* Byte shuffle which converts the first 12 bytes of an RTP packet to the
+ * unpacked header layout in one instruction. */
+    #define UNPACK_SHUFFLE_MASK_BYTES                          \
+    7, 6, 5, 4,                     /* Timestamp. */           \
+    11, 10, 9, 8,                   /* SSRC. */                \
+    3, 2, ( char ) 0x80, ( char ) 0x80, /* Sequence number. */ \
+    0, 1, ( char ) 0x80, ( char ) 0x80  /* First two bytes. */
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+static void UnpackHeaderScalar( const uint8_t * pPacket,
+                                uint32_t * pUnpacked )
+{
+    pUnpacked[ UNPACKED_TIMESTAMP_INDEX ] = Rtp_ReadUint32( &( pPacket[ 4 ] ) );
+    pUnpacked[ UNPACKED_SSRC_INDEX ] = Rtp_ReadUint32( &( pPacket[ 8 ] ) );
+    pUnpacked[ UNPACKED_SEQUENCE_NUMBER_INDEX ] = Rtp_ReadUint16( &( pPacket[ 2 ] ) );
+    pUnpacked[ UNPACKED_FIRST_BYTES_INDEX ] = ( ( uint32_t ) pPacket[ 1 ] << 8 ) |
+                                              ( ( uint32_t ) pPacket[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t CalculatePayloadOffset( const uint8_t * pPacket,
+                                      size_t packetLength,
+                                      uint8_t firstByte )
+{
+    size_t payloadOffset;
+
+    payloadOffset = RTP_HEADER_MIN_LENGTH +
+                    ( ( firstByte & RTP_HEADER_CSRC_COUNT_MASK ) * sizeof( uint32_t ) );
+
+    if( ( firstByte & RTP_HEADER_EXTENSION_MASK ) != 0 )
+    {
+        if( ( payloadOffset + sizeof( uint32_t ) ) <= packetLength )
+        {
+            /* The extension length is in the last 16 bits of the extension
+             * header and does not include the extension header itself. */
+            payloadOffset += sizeof( uint32_t ) +
+                             ( Rtp_ReadUint16( &( pPacket[ payloadOffset + 2 ] ) ) * sizeof( uint32_t ) );
+        }
+        else
+        {
+            payloadOffset = 0;
+        }
+    }
+
+    if( payloadOffset > packetLength )
+    {
+        payloadOffset = 0;
+    }
+
+    return payloadOffset;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t StoreHeader( const uint8_t * pPacket,
+                            size_t packetLength,
+                            const uint32_t * pUnpacked,
+                            RtpBatchHeaders_t * pHeaders,
+                            size_t index )
+{
+    uint8_t firstByte, secondByte, isValid = 0;
+    size_t payloadOffset = 0;
+
+    firstByte = ( uint8_t ) ( pUnpacked[ UNPACKED_FIRST_BYTES_INDEX ] & 0xFF );
+    secondByte = ( uint8_t ) ( pUnpacked[ UNPACKED_FIRST_BYTES_INDEX ] >> 8 );
+
+    if( ( ( firstByte & RTP_HEADER_VERSION_MASK ) >> RTP_HEADER_VERSION_LOCATION ) == RTP_HEADER_VERSION )
+    {
+        payloadOffset = CalculatePayloadOffset( pPacket,
+                                                packetLength,
+                                                firstByte );
+    }
+
+    if( payloadOffset != 0 )
+    {
+        pHeaders->pSequenceNumber[ index ] = ( uint16_t ) pUnpacked[ UNPACKED_SEQUENCE_NUMBER_INDEX ];
+        pHeaders->pTimestamp[ index ] = pUnpacked[ UNPACKED_TIMESTAMP_INDEX ];
+        pHeaders->pSsrc[ index ] = pUnpacked[ UNPACKED_SSRC_INDEX ];
+        pHeaders->pPayloadType[ index ] = secondByte & RTP_HEADER_PAYLOAD_TYPE_MASK;
+        pHeaders->pMarker[ index ] = ( ( secondByte & RTP_HEADER_MARKER_MASK ) != 0 ) ? 1 : 0;
+        pHeaders->pPayloadOffset[ index ] = payloadOffset;
+        isValid = 1;
+    }
+    else
+    {
+        pHeaders->pSequenceNumber[ index ] = 0;
+        pHeaders->pTimestamp[ index ] = 0;
+        pHeaders->pSsrc[ index ] = 0;
+        pHeaders->pPayloadType[ index ] = 0;
+        pHeaders->pMarker[ index ] = 0;
+        pHeaders->pPayloadOffset[ index ] = 0;
+    }
+
+    return isValid;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t ParseHeaderScalar( const uint8_t * pPacket,
+                                  size_t packetLength,
+                                  RtpBatchHeaders_t * pHeaders,
+                                  size_t index )
+{
+    uint32_t unpacked[ UNPACKED_WORD_COUNT ] = { 0 };
+
+    /* Unpacked words of all zeros (version 0) make StoreHeader mark the
+     * packet invalid. */
+    if( ( pPacket != NULL ) &&
+        ( packetLength >= RTP_HEADER_MIN_LENGTH ) )
+    {
+        UnpackHeaderScalar( pPacket,
+                            &( unpacked[ 0 ] ) );
+    }
+
+    return StoreHeader( pPacket,
+                        packetLength,
+                        &( unpacked[ 0 ] ),
+                        pHeaders,
+                        index );
+}
+
+/*-----------------------------------------------------------*/
+
+RtpBatchParserResult_t RtpBatchParser_ParseHeaders( const uint8_t * const * ppPackets,
+                                                    const size_t * pPacketLengths,
+                                                    size_t packetCount,
+                                                    RtpBatchHeaders_t * pHeaders,
+                                                    size_t * pValidPacketCount )
+{
+    RtpBatchParserResult_t result = RTP_BATCH_PARSER_RESULT_OK;
+    size_t i = 0, validPacketCount = 0;
+
+    #if defined( RTP_BATCH_PARSER_USE_AVX2 )
+        uint32_t unpacked[ 2 * UNPACKED_WORD_COUNT ];
+        const __m256i shuffleMask = _mm256_setr_epi8( UNPACK_SHUFFLE_MASK_BYTES,
+                                                      UNPACK_SHUFFLE_MASK_BYTES );
+        __m256i headers;
+    #elif defined( RTP_BATCH_PARSER_USE_SSSE3 )
+        uint32_t unpacked[ UNPACKED_WORD_COUNT ];
+        const __m128i shuffleMask = _mm_setr_epi8( UNPACK_SHUFFLE_MASK_BYTES );
+        __m128i header;
+    #endif
+
+    if( ( ppPackets == NULL ) ||
+        ( pPacketLengths == NULL ) ||
+        ( pHeaders == NULL ) ||
+        ( pHeaders->pSequenceNumber == NULL ) ||
+        ( pHeaders->pTimestamp == NULL ) ||
+        ( pHeaders->pSsrc == NULL ) ||
+        ( pHeaders->pPayloadType == NULL ) ||
+        ( pHeaders->pMarker == NULL ) ||
+        ( pHeaders->pPayloadOffset == NULL ) ||
+        ( pValidPacketCount == NULL ) )
+    {
+        result = RTP_BATCH_PARSER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_BATCH_PARSER_RESULT_OK )
+    {
+        while( i < packetCount )
+        {
+            #if defined( RTP_BATCH_PARSER_USE_AVX2 )
+                /* Unpack two headers at once, one in each 128-bit lane. */
+                if( ( ( i + 1 ) < packetCount ) &&
+                    ( ppPackets[ i ] != NULL ) &&
+                    ( ppPackets[ i + 1 ] != NULL ) &&
+                    ( pPacketLengths[ i ] >= RTP_BATCH_PARSER_VECTOR_LOAD_LENGTH ) &&
+                    ( pPacketLengths[ i + 1 ] >= RTP_BATCH_PARSER_VECTOR_LOAD_LENGTH ) )
+                {
+                    headers = _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( ( const __m128i * ) ppPackets[ i ] ) ),
+                                                       _mm_loadu_si128( ( const __m128i * ) ppPackets[ i + 1 ] ),
+                                                       1 );
+                    headers = _mm256_shuffle_epi8( headers, shuffleMask );
+                    _mm256_storeu_si256( ( __m256i * ) &( unpacked[ 0 ] ), headers );
+
+                    validPacketCount += StoreHeader( ppPackets[ i ],
+                                                     pPacketLengths[ i ],
+                                                     &( unpacked[ 0 ] ),
+                                                     pHeaders,
+                                                     i );
+                    validPacketCount += StoreHeader( ppPackets[ i + 1 ],
+                                                     pPacketLengths[ i + 1 ],
+                                                     &( unpacked[ UNPACKED_WORD_COUNT ] ),
+                                                     pHeaders,
+                                                     i + 1 );
+                    i += 2;
+                }
+                else
+                {
+                    validPacketCount += ParseHeaderScalar( ppPackets[ i ],
+                                                           pPacketLengths[ i ],
+                                                           pHeaders,
+                                                           i );
+                    i += 1;
+                }
+            #elif defined( RTP_BATCH_PARSER_USE_SSSE3 )
+                if( ( ppPackets[ i ] != NULL ) &&
+                    ( pPacketLengths[ i ] >= RTP_BATCH_PARSER_VECTOR_LOAD_LENGTH ) )
+                {
+                    header = _mm_loadu_si128( ( const __m128i * ) ppPackets[ i ] );
+                    header = _mm_shuffle_epi8( header, shuffleMask );
+                    _mm_storeu_si128( ( __m128i * ) &( unpacked[ 0 ] ), header );
+
+                    validPacketCount += StoreHeader( ppPackets[ i ],
+                                                     pPacketLengths[ i ],
+                                                     &( unpacked[ 0 ] ),
+                                                     pHeaders,
+                                                     i );
+                }
+                else
+                {
+                    validPacketCount += ParseHeaderScalar( ppPackets[ i ],
+                                                           pPacketLengths[ i ],
+                                                           pHeaders,
+                                                           i );
+                }
+
+                i += 1;
+            #else /* if defined( RTP_BATCH_PARSER_USE_AVX2 ) */
+                validPacketCount += ParseHeaderScalar( ppPackets[ i ],
+                                                       pPacketLengths[ i ],
+                                                       pHeaders,
+                                                       i );
+                i += 1;
+            #endif /* if defined( RTP_BATCH_PARSER_USE_AVX2 ) */
+        }
+
+        *pValidPacketCount = validPacketCount;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,1118 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtp_capture.h"
+#include "rtp_endianness.h"
+
+/*-----------------------------------------------------------*/
+
+#define US_PER_SECOND                       1000000U
+
+#define PCAP_FILE_HEADER_LENGTH             24
+#define PCAP_RECORD_HEADER_LENGTH           16
+#define PCAP_MAGIC_MICROSECONDS             0xA1B2C3D4U
+#define PCAP_MAGIC_NANOSECONDS              0xA1B23C4DU
+#define PCAP_SNAPLEN                        65535U
+
+#define PCAPNG_BLOCK_MIN_LENGTH             12
+#define PCAPNG_SECTION_HEADER_BLOCK         0x0A0D0D0AU
+#define PCAPNG_SECTION_HEADER_MIN_LENGTH    28
+#define PCAPNG_BYTE_ORDER_MAGIC             0x1A2B3C4DU
+#define PCAPNG_INTERFACE_BLOCK              1U
+#define PCAPNG_INTERFACE_MIN_LENGTH         20
+#define PCAPNG_SIMPLE_PACKET_BLOCK          3U
+#define PCAPNG_SIMPLE_PACKET_MIN_LENGTH     16
+#define PCAPNG_ENHANCED_PACKET_BLOCK        6U
+#define PCAPNG_ENHANCED_PACKET_MIN_LENGTH   32
+#define PCAPNG_OPTION_END                   0U
+#define PCAPNG_OPTION_TIMESTAMP_RESOLUTION  9U
+#define PCAPNG_DEFAULT_RESOLUTION           6U
+#define PCAPNG_RESOLUTION_POWER_OF_TWO      0x80U
+
+#define RTPDUMP_MAGIC                       "#!rtpplay1.0 "
+#define RTPDUMP_MAGIC_LENGTH                ( sizeof( RTPDUMP_MAGIC ) - 1 )
+#define RTPDUMP_FILE_HEADER_LENGTH          16
+#define RTPDUMP_RECORD_HEADER_LENGTH        8
+
+#define LINK_TYPE_NULL                      0U
+#define LINK_TYPE_ETHERNET                  1U
+#define LINK_TYPE_RAW                       101U
+#define LINK_TYPE_LINUX_SLL                 113U
+#define LINK_TYPE_IPV4                      228U
+#define LINK_TYPE_IPV6                      229U
+
+#define NULL_HEADER_LENGTH                  4
+#define ETHERNET_HEADER_LENGTH              14
+#define VLAN_TAG_LENGTH                     4
+#define LINUX_SLL_HEADER_LENGTH             16
+#define ETHER_TYPE_IPV4                     0x0800U
+#define ETHER_TYPE_IPV6                     0x86DDU
+#define ETHER_TYPE_VLAN                     0x8100U
+#define ETHER_TYPE_QINQ                     0x88A8U
+
+#define IPV4_HEADER_LENGTH                  20
+#define IPV4_FRAGMENT_MASK                  0x3FFFU
+#define IPV4_DONT_FRAGMENT                  0x4000U
+#define IPV4_TTL                            64U
+#define IPV4_LOOPBACK_ADDRESS               0x7F000001U
+#define IPV6_HEADER_LENGTH                  40
+#define IP_PROTOCOL_UDP                     17U
+#define UDP_HEADER_LENGTH                   8
+
+#define RTP_HEADER_MIN_LENGTH               12
+#define RTP_SSRC_OFFSET                     8
+
+/*-----------------------------------------------------------*/
+
+static uint16_t ReadUint16LittleEndian( const uint8_t * pSrc );
+
+static uint32_t ReadUint32LittleEndian( const uint8_t * pSrc );
+
+static void WriteUint16LittleEndian( uint8_t * pDst,
+                                     uint16_t val );
+
+static void WriteUint32LittleEndian( uint8_t * pDst,
+                                     uint32_t val );
+
+static uint16_t ReadFileUint16( const RtpCaptureReader_t * pReader,
+                                const uint8_t * pSrc );
+
+static uint32_t ReadFileUint32( const RtpCaptureReader_t * pReader,
+                                const uint8_t * pSrc );
+
+static uint8_t IsLinkTypeSupported( uint32_t linkType );
+
+static uint8_t ParseUdpPacket( uint32_t linkType,
+                               const uint8_t * pData,
+                               size_t dataLength,
+                               RtpCapturePacket_t * pPacket );
+
+static uint64_t ConvertPcapngTimestamp( uint64_t timestamp,
+                                        uint8_t resolution );
+
+static uint8_t ParsePcapngInterfaceResolution( const RtpCaptureReader_t * pReader,
+                                               const uint8_t * pBlock,
+                                               size_t blockLength );
+
+static RtpCaptureResult_t ReadPcapRecord( RtpCaptureReader_t * pReader,
+                                          RtpCapturePacket_t * pPacket,
+                                          uint8_t * pIsFound );
+
+static RtpCaptureResult_t ReadPcapngBlock( RtpCaptureReader_t * pReader,
+                                           RtpCapturePacket_t * pPacket,
+                                           uint8_t * pIsFound );
+
+static RtpCaptureResult_t ReadRtpdumpRecord( RtpCaptureReader_t * pReader,
+                                             RtpCapturePacket_t * pPacket,
+                                             uint8_t * pIsFound );
+
+static uint8_t IsPacketMatching( const RtpCaptureReader_t * pReader,
+                                 const RtpCapturePacket_t * pPacket );
+
+static size_t WriteDecimal( uint8_t * pDst,
+                            uint16_t value );
+
+static void WriteIpv4UdpHeaders( const RtpCaptureWriter_t * pWriter,
+                                 uint8_t * pDst,
+                                 size_t packetLength );
+
+/*-----------------------------------------------------------*/
+
+static uint16_t ReadUint16LittleEndian( const uint8_t * pSrc )
+{
+    return ( uint16_t ) ( ( ( uint16_t ) pSrc[ 1 ] << 8 ) |
+                          ( ( uint16_t ) pSrc[ 0 ] ) );
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t ReadUint32LittleEndian( const uint8_t * pSrc )
+{
+    return ( ( ( uint32_t ) pSrc[ 3 ] << 24 ) |
+             ( ( uint32_t ) pSrc[ 2 ] << 16 ) |
+             ( ( uint32_t ) pSrc[ 1 ] << 8 ) |
+             ( ( uint32_t ) pSrc[ 0 ] ) );
+}
+
+/*-----------------------------------------------------------*/
+
+static void WriteUint16LittleEndian( uint8_t * pDst,
+                                     uint16_t val )
+{
+    pDst[ 0 ] = ( uint8_t ) ( val );
+    pDst[ 1 ] = ( uint8_t ) ( val >> 8 );
+}
+
+/*-----------------------------------------------------------*/
+
+static void WriteUint32LittleEndian( uint8_t * pDst,
+                                     uint32_t val )
+{
+    pDst[ 0 ] = ( uint8_t ) ( val );
+    pDst[ 1 ] = ( uint8_t ) ( val >> 8 );
+    pDst[ 2 ] = ( uint8_t ) ( val >> 16 );
+    pDst[ 3 ] = ( uint8_t ) ( val >> 24 );
+}
+
+/*-----------------------------------------------------------*/
+
+static uint16_t ReadFileUint16( const RtpCaptureReader_t * pReader,
+                                const uint8_t * pSrc )
+{
+    return ( pReader->isLittleEndian != 0U ) ? ReadUint16LittleEndian( pSrc ) :
+                                               Rtp_ReadUint16( pSrc );
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t ReadFileUint32( const RtpCaptureReader_t * pReader,
+                                const uint8_t * pSrc )
+{
+    return ( pReader->isLittleEndian != 0U ) ? ReadUint32LittleEndian( pSrc ) :
+                                               Rtp_ReadUint32( pSrc );
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t IsLinkTypeSupported( uint32_t linkType )
+{
+    return ( ( linkType == LINK_TYPE_NULL ) ||
+             ( linkType == LINK_TYPE_ETHERNET ) ||
+             ( linkType == LINK_TYPE_RAW ) ||
+             ( linkType == LINK_TYPE_LINUX_SLL ) ||
+             ( linkType == LINK_TYPE_IPV4 ) ||
+             ( linkType == LINK_TYPE_IPV6 ) ) ? 1U : 0U;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns 1 and fills the payload and ports of pPacket if the frame is a
+ * complete, non fragmented, UDP datagram. */
+static uint8_t ParseUdpPacket( uint32_t linkType,
+                               const uint8_t * pData,
+                               size_t dataLength,
+                               RtpCapturePacket_t * pPacket )
+{
+    size_t offset = 0, udpOffset = 0, udpEnd = 0, headerLength, totalLength;
+    uint16_t etherType = ETHER_TYPE_IPV4, udpLength;
+    uint8_t isIp = 1, isUdp = 0, isFound = 0;
+
+    switch( linkType )
+    {
+        case LINK_TYPE_NULL:
+            offset = NULL_HEADER_LENGTH;
+            break;
+
+        case LINK_TYPE_ETHERNET:
+
+            if( dataLength >= ETHERNET_HEADER_LENGTH )
+            {
+                etherType = Rtp_ReadUint16( &( pData[ ETHERNET_HEADER_LENGTH - 2 ] ) );
+                offset = ETHERNET_HEADER_LENGTH;
+
+                while( ( ( etherType == ETHER_TYPE_VLAN ) || ( etherType == ETHER_TYPE_QINQ ) ) &&
+                       ( dataLength >= offset + VLAN_TAG_LENGTH ) )
+                {
+                    etherType = Rtp_ReadUint16( &( pData[ offset + 2 ] ) );
+                    offset += VLAN_TAG_LENGTH;
+                }
+            }
+            else
+            {
+                isIp = 0;
+            }
+
+            break;
+
+        case LINK_TYPE_LINUX_SLL:
+
+            if( dataLength >= LINUX_SLL_HEADER_LENGTH )
+            {
+                etherType = Rtp_ReadUint16( &( pData[ LINUX_SLL_HEADER_LENGTH - 2 ] ) );
+                offset = LINUX_SLL_HEADER_LENGTH;
+            }
+            else
+            {
+                isIp = 0;
+            }
+
+            break;
+
+        case LINK_TYPE_RAW:
+        case LINK_TYPE_IPV4:
+        case LINK_TYPE_IPV6:
+            break;
+
+        default:
+            isIp = 0;
+            break;
+    }
+
+    if( ( etherType != ETHER_TYPE_IPV4 ) && ( etherType != ETHER_TYPE_IPV6 ) )
+    {
+        isIp = 0;
+    }
+
+    if( ( isIp != 0U ) &&
+        ( offset <= dataLength ) &&
+        ( dataLength - offset >= IPV4_HEADER_LENGTH ) &&
+        ( ( pData[ offset ] >> 4 ) == 4U ) )
+    {
+        headerLength = ( size_t ) ( pData[ offset ] & 0x0FU ) * 4U;
+        totalLength = Rtp_ReadUint16( &( pData[ offset + 2 ] ) );
+
+        /* The total length excludes the link layer padding. */
+        if( ( headerLength >= IPV4_HEADER_LENGTH ) &&
+            ( totalLength >= headerLength ) &&
+            ( totalLength <= dataLength - offset ) &&
+            ( pData[ offset + 9 ] == IP_PROTOCOL_UDP ) &&
+            ( ( Rtp_ReadUint16( &( pData[ offset + 6 ] ) ) & IPV4_FRAGMENT_MASK ) == 0U ) )
+        {
+            udpOffset = offset + headerLength;
+            udpEnd = offset + totalLength;
+            isUdp = 1;
+        }
+    }
+    else if( ( isIp != 0U ) &&
+             ( offset <= dataLength ) &&
+             ( dataLength - offset >= IPV6_HEADER_LENGTH ) &&
+             ( ( pData[ offset ] >> 4 ) == 6U ) )
+    {
+        totalLength = Rtp_ReadUint16( &( pData[ offset + 4 ] ) );
+
+        if( ( pData[ offset + 6 ] == IP_PROTOCOL_UDP ) &&
+            ( totalLength <= dataLength - offset - IPV6_HEADER_LENGTH ) )
+        {
+            udpOffset = offset + IPV6_HEADER_LENGTH;
+            udpEnd = udpOffset + totalLength;
+            isUdp = 1;
+        }
+    }
+    else
+    {
+        /* Not an IP packet. */
+    }
+
+    if( ( isUdp != 0U ) &&
+        ( udpEnd - udpOffset >= UDP_HEADER_LENGTH ) )
+    {
+        udpLength = Rtp_ReadUint16( &( pData[ udpOffset + 4 ] ) );
+
+        /* A shorter datagram was truncated by the capture snap length. */
+        if( ( udpLength >= UDP_HEADER_LENGTH ) &&
+            ( udpLength <= udpEnd - udpOffset ) )
+        {
+            pPacket->srcPort = Rtp_ReadUint16( &( pData[ udpOffset ] ) );
+            pPacket->dstPort = Rtp_ReadUint16( &( pData[ udpOffset + 2 ] ) );
+            pPacket->pPacket = &( pData[ udpOffset + UDP_HEADER_LENGTH ] );
+            pPacket->packetLength = ( size_t ) udpLength - UDP_HEADER_LENGTH;
+            isFound = 1;
+        }
+    }
+
+    return isFound;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint64_t ConvertPcapngTimestamp( uint64_t timestamp,
+                                        uint8_t resolution )
+{
+    uint64_t timestampUs, divisor = 1;
+    uint8_t exponent = resolution & ( uint8_t ) ~PCAPNG_RESOLUTION_POWER_OF_TWO;
+
+    if( ( resolution & PCAPNG_RESOLUTION_POWER_OF_TWO ) != 0U )
+    {
+        /* Keep the fraction small enough to be scaled without overflow. A
+         * shift of 64 or more would be undefined, and any timestamp at such a
+         * resolution is below a microsecond anyway. */
+        if( exponent >= 96U )
+        {
+            timestamp = 0;
+            exponent = 32U;
+        }
+        else if( exponent > 32U )
+        {
+            timestamp >>= ( exponent - 32U );
+            exponent = 32U;
+        }
+        else
+        {
+            /* The fraction can be scaled as is. */
+        }
+
+        timestampUs = ( ( timestamp >> exponent ) * US_PER_SECOND ) +
+                      ( ( ( timestamp & ( ( ( uint64_t ) 1U << exponent ) - 1U ) ) * US_PER_SECOND ) >> exponent );
+    }
+    else if( exponent <= PCAPNG_DEFAULT_RESOLUTION )
+    {
+        for( ; exponent < PCAPNG_DEFAULT_RESOLUTION; exponent++ )
+        {
+            timestamp *= 10U;
+        }
+
+        timestampUs = timestamp;
+    }
+    else
+    {
+        for( ; ( exponent > PCAPNG_DEFAULT_RESOLUTION ) && ( divisor <= ( UINT64_MAX / 10U ) ); exponent-- )
+        {
+            divisor *= 10U;
+        }
+
+        /* The timestamp is below a microsecond when the divisor does not fit. */
+        timestampUs = ( exponent > PCAPNG_DEFAULT_RESOLUTION ) ? 0U : ( timestamp / divisor );
+    }
+
+    return timestampUs;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t ParsePcapngInterfaceResolution( const RtpCaptureReader_t * pReader,
+                                               const uint8_t * pBlock,
+                                               size_t blockLength )
+{
+    size_t offset = PCAPNG_INTERFACE_MIN_LENGTH - 4, optionsEnd = blockLength - 4;
+    uint16_t optionCode = 1, optionLength;
+    uint8_t resolution = PCAPNG_DEFAULT_RESOLUTION;
+
+    while( ( optionCode != PCAPNG_OPTION_END ) &&
+           ( offset + 4 <= optionsEnd ) )
+    {
+        optionCode = ReadFileUint16( pReader, &( pBlock[ offset ] ) );
+        optionLength = ReadFileUint16( pReader, &( pBlock[ offset + 2 ] ) );
+
+        if( optionLength > optionsEnd - offset - 4 )
+        {
+            /* Ignore the malformed options. */
+            optionCode = PCAPNG_OPTION_END;
+        }
+        else if( ( optionCode == PCAPNG_OPTION_TIMESTAMP_RESOLUTION ) &&
+                 ( optionLength >= 1U ) )
+        {
+            resolution = pBlock[ offset + 4 ];
+        }
+        else
+        {
+            /* Other options are not needed. */
+        }
+
+        offset += 4 + ( ( ( size_t ) optionLength + 3U ) & ~( ( size_t ) 3U ) );
+    }
+
+    return resolution;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpCaptureResult_t ReadPcapRecord( RtpCaptureReader_t * pReader,
+                                          RtpCapturePacket_t * pPacket,
+                                          uint8_t * pIsFound )
+{
+    const uint8_t * pRecord = &( pReader->pBuffer[ pReader->offset ] );
+    size_t remainingLength = pReader->bufferLength - pReader->offset;
+    uint32_t seconds, fraction, capturedLength = 0;
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( remainingLength < PCAP_RECORD_HEADER_LENGTH )
+    {
+        result = RTP_CAPTURE_RESULT_MALFORMED;
+    }
+    else
+    {
+        capturedLength = ReadFileUint32( pReader, &( pRecord[ 8 ] ) );
+
+        if( capturedLength > remainingLength - PCAP_RECORD_HEADER_LENGTH )
+        {
+            result = RTP_CAPTURE_RESULT_MALFORMED;
+        }
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        seconds = ReadFileUint32( pReader, &( pRecord[ 0 ] ) );
+        fraction = ReadFileUint32( pReader, &( pRecord[ 4 ] ) );
+
+        *pIsFound = ParseUdpPacket( pReader->linkType,
+                                    &( pRecord[ PCAP_RECORD_HEADER_LENGTH ] ),
+                                    capturedLength,
+                                    pPacket );
+        pPacket->timestampUs = ( ( uint64_t ) seconds * US_PER_SECOND ) +
+                               ( ( pReader->isNanoseconds != 0U ) ? ( fraction / 1000U ) : fraction );
+
+        pReader->offset += PCAP_RECORD_HEADER_LENGTH + ( size_t ) capturedLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpCaptureResult_t ReadPcapngBlock( RtpCaptureReader_t * pReader,
+                                           RtpCapturePacket_t * pPacket,
+                                           uint8_t * pIsFound )
+{
+    const uint8_t * pBlock = &( pReader->pBuffer[ pReader->offset ] );
+    size_t remainingLength = pReader->bufferLength - pReader->offset;
+    size_t blockLength = 0, interfaceCount;
+    uint32_t blockType = 0, interfaceId, capturedLength;
+    uint64_t timestamp;
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( remainingLength < PCAPNG_BLOCK_MIN_LENGTH )
+    {
+        result = RTP_CAPTURE_RESULT_MALFORMED;
+    }
+    else
+    {
+        /* The section header block type reads the same in both byte orders. */
+        blockType = ReadFileUint32( pReader, pBlock );
+    }
+
+    if( ( result == RTP_CAPTURE_RESULT_OK ) &&
+        ( blockType == PCAPNG_SECTION_HEADER_BLOCK ) )
+    {
+        if( remainingLength < PCAPNG_SECTION_HEADER_MIN_LENGTH )
+        {
+            result = RTP_CAPTURE_RESULT_MALFORMED;
+        }
+        else if( ReadUint32LittleEndian( &( pBlock[ 8 ] ) ) == PCAPNG_BYTE_ORDER_MAGIC )
+        {
+            pReader->isLittleEndian = 1;
+        }
+        else if( Rtp_ReadUint32( &( pBlock[ 8 ] ) ) == PCAPNG_BYTE_ORDER_MAGIC )
+        {
+            pReader->isLittleEndian = 0;
+        }
+        else
+        {
+            result = RTP_CAPTURE_RESULT_MALFORMED;
+        }
+
+        /* Interface ids are local to a section. */
+        pReader->interfaceCount = 0;
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        blockLength = ReadFileUint32( pReader, &( pBlock[ 4 ] ) );
+
+        if( ( blockLength < PCAPNG_BLOCK_MIN_LENGTH ) ||
+            ( ( blockLength % 4U ) != 0U ) ||
+            ( blockLength > remainingLength ) )
+        {
+            result = RTP_CAPTURE_RESULT_MALFORMED;
+        }
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        interfaceCount = ( pReader->interfaceCount < RTP_CAPTURE_MAX_INTERFACES ) ?
+                         pReader->interfaceCount : RTP_CAPTURE_MAX_INTERFACES;
+
+        switch( blockType )
+        {
+            case PCAPNG_INTERFACE_BLOCK:
+
+                if( blockLength < PCAPNG_INTERFACE_MIN_LENGTH )
+                {
+                    result = RTP_CAPTURE_RESULT_MALFORMED;
+                }
+                else
+                {
+                    /* Packets of the interfaces beyond the maximum are skipped. */
+                    if( pReader->interfaceCount < RTP_CAPTURE_MAX_INTERFACES )
+                    {
+                        pReader->interfaceLinkTypes[ pReader->interfaceCount ] = ReadFileUint16( pReader, &( pBlock[ 8 ] ) );
+                        pReader->interfaceTimestampResolutions[ pReader->interfaceCount ] = ParsePcapngInterfaceResolution( pReader,
+                                                                                                                           pBlock,
+                                                                                                                           blockLength );
+                    }
+
+                    pReader->interfaceCount += 1;
+                }
+
+                break;
+
+            case PCAPNG_ENHANCED_PACKET_BLOCK:
+
+                if( blockLength < PCAPNG_ENHANCED_PACKET_MIN_LENGTH )
+                {
+                    result = RTP_CAPTURE_RESULT_MALFORMED;
+                }
+                else
+                {
+                    interfaceId = ReadFileUint32( pReader, &( pBlock[ 8 ] ) );
+                    capturedLength = ReadFileUint32( pReader, &( pBlock[ 20 ] ) );
+
+                    if( capturedLength > blockLength - PCAPNG_ENHANCED_PACKET_MIN_LENGTH )
+                    {
+                        result = RTP_CAPTURE_RESULT_MALFORMED;
+                    }
+                    else if( interfaceId < interfaceCount )
+                    {
+                        timestamp = ( ( uint64_t ) ReadFileUint32( pReader, &( pBlock[ 12 ] ) ) << 32 ) |
+                                    ( uint64_t ) ReadFileUint32( pReader, &( pBlock[ 16 ] ) );
+
+                        *pIsFound = ParseUdpPacket( pReader->interfaceLinkTypes[ interfaceId ],
+                                                    &( pBlock[ 28 ] ),
+                                                    capturedLength,
+                                                    pPacket );
+                        pPacket->timestampUs = ConvertPcapngTimestamp( timestamp,
+                                                                       pReader->interfaceTimestampResolutions[ interfaceId ] );
+                    }
+                    else
+                    {
+                        /* Unknown interface. */
+                    }
+                }
+
+                break;
+
+            case PCAPNG_SIMPLE_PACKET_BLOCK:
+
+                if( blockLength < PCAPNG_SIMPLE_PACKET_MIN_LENGTH )
+                {
+                    result = RTP_CAPTURE_RESULT_MALFORMED;
+                }
+                else if( interfaceCount > 0U )
+                {
+                    /* Simple packet blocks belong to the first interface and
+                     * have no timestamp. */
+                    capturedLength = ReadFileUint32( pReader, &( pBlock[ 8 ] ) );
+                    capturedLength = ( capturedLength < blockLength - PCAPNG_SIMPLE_PACKET_MIN_LENGTH ) ?
+                                     capturedLength : ( uint32_t ) ( blockLength - PCAPNG_SIMPLE_PACKET_MIN_LENGTH );
+
+                    *pIsFound = ParseUdpPacket( pReader->interfaceLinkTypes[ 0 ],
+                                                &( pBlock[ 12 ] ),
+                                                capturedLength,
+                                                pPacket );
+                    pPacket->timestampUs = 0;
+                }
+                else
+                {
+                    /* No interface. */
+                }
+
+                break;
+
+            default:
+                /* Other blocks are skipped. */
+                break;
+        }
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        pReader->offset += blockLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpCaptureResult_t ReadRtpdumpRecord( RtpCaptureReader_t * pReader,
+                                             RtpCapturePacket_t * pPacket,
+                                             uint8_t * pIsFound )
+{
+    const uint8_t * pRecord = &( pReader->pBuffer[ pReader->offset ] );
+    size_t remainingLength = pReader->bufferLength - pReader->offset;
+    size_t recordLength = 0, dataLength;
+    uint16_t packetLength;
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( remainingLength < RTPDUMP_RECORD_HEADER_LENGTH )
+    {
+        result = RTP_CAPTURE_RESULT_MALFORMED;
+    }
+    else
+    {
+        recordLength = Rtp_ReadUint16( pRecord );
+
+        if( ( recordLength < RTPDUMP_RECORD_HEADER_LENGTH ) ||
+            ( recordLength > remainingLength ) )
+        {
+            result = RTP_CAPTURE_RESULT_MALFORMED;
+        }
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        dataLength = recordLength - RTPDUMP_RECORD_HEADER_LENGTH;
+
+        /* The packet length is 0 for RTCP packets, which are skipped. */
+        packetLength = Rtp_ReadUint16( &( pRecord[ 2 ] ) );
+
+        if( ( packetLength != 0U ) &&
+            ( packetLength <= dataLength ) )
+        {
+            pPacket->pPacket = &( pRecord[ RTPDUMP_RECORD_HEADER_LENGTH ] );
+            pPacket->packetLength = packetLength;
+            pPacket->timestampUs = pReader->startTimeUs +
+                                   ( ( uint64_t ) Rtp_ReadUint32( &( pRecord[ 4 ] ) ) * 1000U );
+            pPacket->srcPort = pReader->sourcePort;
+            pPacket->dstPort = 0;
+            *pIsFound = 1;
+        }
+
+        pReader->offset += recordLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t IsPacketMatching( const RtpCaptureReader_t * pReader,
+                                 const RtpCapturePacket_t * pPacket )
+{
+    uint8_t isMatching = 1;
+
+    if( ( pReader->filterPort != 0U ) &&
+        ( pPacket->srcPort != pReader->filterPort ) &&
+        ( pPacket->dstPort != pReader->filterPort ) )
+    {
+        isMatching = 0;
+    }
+
+    if( ( pReader->isSsrcFilterEnabled != 0U ) &&
+        ( ( pPacket->packetLength < RTP_HEADER_MIN_LENGTH ) ||
+          ( Rtp_ReadUint32( &( pPacket->pPacket[ RTP_SSRC_OFFSET ] ) ) != pReader->filterSsrc ) ) )
+    {
+        isMatching = 0;
+    }
+
+    return isMatching;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t WriteDecimal( uint8_t * pDst,
+                            uint16_t value )
+{
+    uint8_t digits[ 5 ];
+    size_t digitCount = 0, i;
+
+    do
+    {
+        digits[ digitCount ] = ( uint8_t ) ( '0' + ( value % 10U ) );
+        value /= 10U;
+        digitCount++;
+    } while( value != 0U );
+
+    for( i = 0; i < digitCount; i++ )
+    {
+        pDst[ i ] = digits[ digitCount - 1U - i ];
+    }
+
+    return digitCount;
+}
+
+/*-----------------------------------------------------------*/
+
+static void WriteIpv4UdpHeaders( const RtpCaptureWriter_t * pWriter,
+                                 uint8_t * pDst,
+                                 size_t packetLength )
+{
+    uint32_t checksum = 0;
+    size_t i;
+
+    memset( pDst, 0, IPV4_HEADER_LENGTH + UDP_HEADER_LENGTH );
+
+    pDst[ 0 ] = 0x45;
+    Rtp_WriteUint16( &( pDst[ 2 ] ), ( uint16_t ) ( IPV4_HEADER_LENGTH + UDP_HEADER_LENGTH + packetLength ) );
+    Rtp_WriteUint16( &( pDst[ 6 ] ), IPV4_DONT_FRAGMENT );
+    pDst[ 8 ] = IPV4_TTL;
+    pDst[ 9 ] = IP_PROTOCOL_UDP;
+    Rtp_WriteUint32( &( pDst[ 12 ] ), IPV4_LOOPBACK_ADDRESS );
+    Rtp_WriteUint32( &( pDst[ 16 ] ), IPV4_LOOPBACK_ADDRESS );
+
+    for( i = 0; i < IPV4_HEADER_LENGTH; i += 2 )
+    {
+        checksum += Rtp_ReadUint16( &( pDst[ i ] ) );
+    }
+
+    checksum = ( checksum & 0xFFFFU ) + ( checksum >> 16 );
+    checksum += ( checksum >> 16 );
+    Rtp_WriteUint16( &( pDst[ 10 ] ), ( uint16_t ) ~checksum );
+
+    /* A zero UDP checksum means no checksum. */
+    Rtp_WriteUint16( &( pDst[ IPV4_HEADER_LENGTH ] ), pWriter->srcPort );
+    Rtp_WriteUint16( &( pDst[ IPV4_HEADER_LENGTH + 2 ] ), pWriter->dstPort );
+    Rtp_WriteUint16( &( pDst[ IPV4_HEADER_LENGTH + 4 ] ), ( uint16_t ) ( UDP_HEADER_LENGTH + packetLength ) );
+}
+
+/*-----------------------------------------------------------*/
+
+RtpCaptureResult_t RtpCaptureReader_Init( RtpCaptureReader_t * pReader,
+                                          const uint8_t * pBuffer,
+                                          size_t bufferLength )
+{
+    size_t i;
+    uint32_t magic = 0;
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( ( pReader == NULL ) ||
+        ( pBuffer == NULL ) )
+    {
+        result = RTP_CAPTURE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        memset( pReader, 0, sizeof( RtpCaptureReader_t ) );
+        pReader->pBuffer = pBuffer;
+        pReader->bufferLength = bufferLength;
+
+        if( bufferLength < 4U )
+        {
+            result = RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT;
+        }
+        else
+        {
+            magic = Rtp_ReadUint32( pBuffer );
+        }
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        if( ( magic == PCAP_MAGIC_MICROSECONDS ) || ( magic == PCAP_MAGIC_NANOSECONDS ) ||
+            ( ReadUint32LittleEndian( pBuffer ) == PCAP_MAGIC_MICROSECONDS ) ||
+            ( ReadUint32LittleEndian( pBuffer ) == PCAP_MAGIC_NANOSECONDS ) )
+        {
+            pReader->format = RTP_CAPTURE_FORMAT_PCAP;
+            pReader->isLittleEndian = ( ( magic == PCAP_MAGIC_MICROSECONDS ) || ( magic == PCAP_MAGIC_NANOSECONDS ) ) ? 0U : 1U;
+            pReader->isNanoseconds = ( ReadFileUint32( pReader, pBuffer ) == PCAP_MAGIC_NANOSECONDS ) ? 1U : 0U;
+
+            if( bufferLength < PCAP_FILE_HEADER_LENGTH )
+            {
+                result = RTP_CAPTURE_RESULT_MALFORMED;
+            }
+            else
+            {
+                pReader->linkType = ReadFileUint32( pReader, &( pBuffer[ 20 ] ) );
+                pReader->offset = PCAP_FILE_HEADER_LENGTH;
+
+                if( IsLinkTypeSupported( pReader->linkType ) == 0U )
+                {
+                    result = RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT;
+                }
+            }
+        }
+        else if( magic == PCAPNG_SECTION_HEADER_BLOCK )
+        {
+            /* The blocks, including the first section header, are parsed by
+             * RtpCaptureReader_GetNextPacket. */
+            pReader->format = RTP_CAPTURE_FORMAT_PCAPNG;
+        }
+        else if( ( bufferLength >= RTPDUMP_MAGIC_LENGTH ) &&
+                 ( memcmp( pBuffer, RTPDUMP_MAGIC, RTPDUMP_MAGIC_LENGTH ) == 0 ) )
+        {
+            pReader->format = RTP_CAPTURE_FORMAT_RTPDUMP;
+
+            /* The text line ends with a new line, followed by the binary header. */
+            i = RTPDUMP_MAGIC_LENGTH;
+
+            while( ( i < bufferLength ) && ( pBuffer[ i ] != ( uint8_t ) '\n' ) )
+            {
+                i++;
+            }
+
+            if( bufferLength - i < RTPDUMP_FILE_HEADER_LENGTH + 1U )
+            {
+                result = RTP_CAPTURE_RESULT_MALFORMED;
+            }
+            else
+            {
+                pReader->startTimeUs = ( ( uint64_t ) Rtp_ReadUint32( &( pBuffer[ i + 1U ] ) ) * US_PER_SECOND ) +
+                                       Rtp_ReadUint32( &( pBuffer[ i + 5U ] ) );
+                pReader->sourcePort = Rtp_ReadUint16( &( pBuffer[ i + 13U ] ) );
+                pReader->offset = i + 1U + RTPDUMP_FILE_HEADER_LENGTH;
+            }
+        }
+        else
+        {
+            result = RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpCaptureResult_t RtpCaptureReader_SetPortFilter( RtpCaptureReader_t * pReader,
+                                                   uint16_t port )
+{
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( pReader == NULL )
+    {
+        result = RTP_CAPTURE_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        pReader->filterPort = port;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpCaptureResult_t RtpCaptureReader_SetSsrcFilter( RtpCaptureReader_t * pReader,
+                                                   uint32_t ssrc )
+{
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( pReader == NULL )
+    {
+        result = RTP_CAPTURE_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        pReader->filterSsrc = ssrc;
+        pReader->isSsrcFilterEnabled = 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpCaptureResult_t RtpCaptureReader_GetNextPacket( RtpCaptureReader_t * pReader,
+                                                   RtpCapturePacket_t * pPacket )
+{
+    uint8_t isFound = 0;
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( ( pReader == NULL ) ||
+        ( pPacket == NULL ) )
+    {
+        result = RTP_CAPTURE_RESULT_BAD_PARAM;
+    }
+
+    while( ( result == RTP_CAPTURE_RESULT_OK ) &&
+           ( isFound == 0U ) )
+    {
+        if( pReader->offset == pReader->bufferLength )
+        {
+            result = RTP_CAPTURE_RESULT_END;
+        }
+        else if( pReader->format == RTP_CAPTURE_FORMAT_PCAP )
+        {
+            result = ReadPcapRecord( pReader, pPacket, &( isFound ) );
+        }
+        else if( pReader->format == RTP_CAPTURE_FORMAT_PCAPNG )
+        {
+            result = ReadPcapngBlock( pReader, pPacket, &( isFound ) );
+        }
+        else
+        {
+            result = ReadRtpdumpRecord( pReader, pPacket, &( isFound ) );
+        }
+
+        if( ( result == RTP_CAPTURE_RESULT_OK ) &&
+            ( isFound != 0U ) )
+        {
+            isFound = IsPacketMatching( pReader, pPacket );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpCaptureResult_t RtpCaptureWriter_Init( RtpCaptureWriter_t * pWriter,
+                                          RtpCaptureFormat_t format,
+                                          uint8_t * pBuffer,
+                                          size_t bufferLength,
+                                          RtpCaptureFlush_t flush,
+                                          void * pCustomContext,
+                                          uint16_t srcPort,
+                                          uint16_t dstPort,
+                                          uint64_t startTimeUs )
+{
+    /* "#!rtpplay1.0 127.0.0.1/65535\n" followed by the binary header. */
+    static const char rtpdumpAddress[] = "127.0.0.1/";
+    size_t headerLength = 0;
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( ( pWriter == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( flush == NULL ) )
+    {
+        result = RTP_CAPTURE_RESULT_BAD_PARAM;
+    }
+    else if( format == RTP_CAPTURE_FORMAT_PCAP )
+    {
+        headerLength = PCAP_FILE_HEADER_LENGTH;
+    }
+    else if( format == RTP_CAPTURE_FORMAT_RTPDUMP )
+    {
+        headerLength = RTPDUMP_MAGIC_LENGTH + sizeof( rtpdumpAddress ) - 1U + 5U + 1U + RTPDUMP_FILE_HEADER_LENGTH;
+    }
+    else
+    {
+        result = RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT;
+    }
+
+    if( ( result == RTP_CAPTURE_RESULT_OK ) &&
+        ( bufferLength < headerLength ) )
+    {
+        result = RTP_CAPTURE_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        pWriter->pBuffer = pBuffer;
+        pWriter->bufferLength = bufferLength;
+        pWriter->format = format;
+        pWriter->flush = flush;
+        pWriter->pCustomContext = pCustomContext;
+        pWriter->srcPort = srcPort;
+        pWriter->dstPort = dstPort;
+        pWriter->startTimeUs = startTimeUs;
+
+        if( format == RTP_CAPTURE_FORMAT_PCAP )
+        {
+            memset( pBuffer, 0, PCAP_FILE_HEADER_LENGTH );
+            WriteUint32LittleEndian( &( pBuffer[ 0 ] ), PCAP_MAGIC_MICROSECONDS );
+            WriteUint16LittleEndian( &( pBuffer[ 4 ] ), 2 );
+            WriteUint16LittleEndian( &( pBuffer[ 6 ] ), 4 );
+            WriteUint32LittleEndian( &( pBuffer[ 16 ] ), PCAP_SNAPLEN );
+            WriteUint32LittleEndian( &( pBuffer[ 20 ] ), LINK_TYPE_RAW );
+            pWriter->bufferOffset = PCAP_FILE_HEADER_LENGTH;
+        }
+        else
+        {
+            memcpy( pBuffer, RTPDUMP_MAGIC, RTPDUMP_MAGIC_LENGTH );
+            headerLength = RTPDUMP_MAGIC_LENGTH;
+            memcpy( &( pBuffer[ headerLength ] ), rtpdumpAddress, sizeof( rtpdumpAddress ) - 1U );
+            headerLength += sizeof( rtpdumpAddress ) - 1U;
+            headerLength += WriteDecimal( &( pBuffer[ headerLength ] ), dstPort );
+            pBuffer[ headerLength ] = ( uint8_t ) '\n';
+            headerLength += 1U;
+
+            memset( &( pBuffer[ headerLength ] ), 0, RTPDUMP_FILE_HEADER_LENGTH );
+            Rtp_WriteUint32( &( pBuffer[ headerLength ] ), ( uint32_t ) ( startTimeUs / US_PER_SECOND ) );
+            Rtp_WriteUint32( &( pBuffer[ headerLength + 4U ] ), ( uint32_t ) ( startTimeUs % US_PER_SECOND ) );
+            Rtp_WriteUint32( &( pBuffer[ headerLength + 8U ] ), IPV4_LOOPBACK_ADDRESS );
+            Rtp_WriteUint16( &( pBuffer[ headerLength + 12U ] ), srcPort );
+            pWriter->bufferOffset = headerLength + RTPDUMP_FILE_HEADER_LENGTH;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpCaptureResult_t RtpCaptureWriter_WritePacket( RtpCaptureWriter_t * pWriter,
+                                                 const uint8_t * pPacket,
+                                                 size_t packetLength,
+                                                 uint64_t timestampUs )
+{
+    size_t recordLength = 0;
+    uint8_t * pRecord;
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( ( pWriter == NULL ) ||
+        ( pPacket == NULL ) )
+    {
+        result = RTP_CAPTURE_RESULT_BAD_PARAM;
+    }
+    else if( pWriter->format == RTP_CAPTURE_FORMAT_PCAP )
+    {
+        recordLength = PCAP_RECORD_HEADER_LENGTH + IPV4_HEADER_LENGTH + UDP_HEADER_LENGTH + packetLength;
+
+        if( packetLength > UINT16_MAX - IPV4_HEADER_LENGTH - UDP_HEADER_LENGTH )
+        {
+            result = RTP_CAPTURE_RESULT_BAD_PARAM;
+        }
+    }
+    else
+    {
+        recordLength = RTPDUMP_RECORD_HEADER_LENGTH + packetLength;
+
+        if( packetLength > UINT16_MAX - RTPDUMP_RECORD_HEADER_LENGTH )
+        {
+            result = RTP_CAPTURE_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( ( result == RTP_CAPTURE_RESULT_OK ) &&
+        ( recordLength > pWriter->bufferLength - pWriter->bufferOffset ) )
+    {
+        result = RtpCaptureWriter_Flush( pWriter );
+
+        if( ( result == RTP_CAPTURE_RESULT_OK ) &&
+            ( recordLength > pWriter->bufferLength ) )
+        {
+            result = RTP_CAPTURE_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == RTP_CAPTURE_RESULT_OK )
+    {
+        pRecord = &( pWriter->pBuffer[ pWriter->bufferOffset ] );
+
+        if( pWriter->format == RTP_CAPTURE_FORMAT_PCAP )
+        {
+            WriteUint32LittleEndian( &( pRecord[ 0 ] ), ( uint32_t ) ( timestampUs / US_PER_SECOND ) );
+            WriteUint32LittleEndian( &( pRecord[ 4 ] ), ( uint32_t ) ( timestampUs % US_PER_SECOND ) );
+            WriteUint32LittleEndian( &( pRecord[ 8 ] ), ( uint32_t ) ( recordLength - PCAP_RECORD_HEADER_LENGTH ) );
+            WriteUint32LittleEndian( &( pRecord[ 12 ] ), ( uint32_t ) ( recordLength - PCAP_RECORD_HEADER_LENGTH ) );
+            WriteIpv4UdpHeaders( pWriter,
+                                 &( pRecord[ PCAP_RECORD_HEADER_LENGTH ] ),
+                                 packetLength );
+        }
+        else
+        {
+            Rtp_WriteUint16( &( pRecord[ 0 ] ), ( uint16_t ) recordLength );
+            Rtp_WriteUint16( &( pRecord[ 2 ] ), ( uint16_t ) packetLength );
+            Rtp_WriteUint32( &( pRecord[ 4 ] ),
+                             ( timestampUs > pWriter->startTimeUs ) ? ( uint32_t ) ( ( timestampUs - pWriter->startTimeUs ) / 1000U ) : 0U );
+        }
+
+        memcpy( &( pRecord[ recordLength - packetLength ] ), pPacket, packetLength );
+        pWriter->bufferOffset += recordLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpCaptureResult_t RtpCaptureWriter_Flush( RtpCaptureWriter_t * pWriter )
+{
+    RtpCaptureResult_t result = RTP_CAPTURE_RESULT_OK;
+
+    if( pWriter == NULL )
+    {
+        result = RTP_CAPTURE_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == RTP_CAPTURE_RESULT_OK ) &&
+        ( pWriter->bufferOffset > 0U ) )
+    {
+        if( pWriter->flush( pWriter->pCustomContext,
+                            pWriter->pBuffer,
+                            pWriter->bufferOffset ) != RTP_CAPTURE_RESULT_OK )
+        {
+            result = RTP_CAPTURE_RESULT_FLUSH_FAILED;
+        }
+        else
+        {
+            pWriter->bufferOffset = 0;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
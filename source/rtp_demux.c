@@ -0,0 +1,439 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtp_demux.h"
+#include "rtp_api.h"
+
+/*-----------------------------------------------------------*/
+
+#define IS_ENTRY_EMPTY( pDemux, index ) \
+    ( ( pDemux )->pEntries[ ( index ) ].pStream == NULL )
+
+#define NEXT_INDEX( pDemux, index ) \
+    ( ( ( index ) + 1 ) & ( pDemux )->entriesMask )
+
+/*-----------------------------------------------------------*/
+
+static size_t HashSsrc( const RtpDemux_t * pDemux,
+                        uint32_t ssrc );
+
+static uint8_t FindEntry( const RtpDemux_t * pDemux,
+                          uint32_t ssrc,
+                          uint8_t payloadType,
+                          size_t * pIndex );
+
+static uint8_t IsElementEqual( const uint8_t * pData,
+                               uint8_t dataLength,
+                               const uint8_t * pExpected,
+                               size_t expectedLength );
+
+static RtpDemuxResult_t RouteByMid( RtpDemux_t * pDemux,
+                                    const uint8_t * pSerializedPacket,
+                                    size_t serializedPacketLength,
+                                    void ** ppStream );
+
+/*-----------------------------------------------------------*/
+
+static size_t HashSsrc( const RtpDemux_t * pDemux,
+                        uint32_t ssrc )
+{
+    uint32_t hash = ssrc;
+
+    /* SSRCs are random but some senders allocate them sequentially, so mix
+     * the bits before masking. */
+    hash ^= hash >> 16;
+    hash *= 0x45D9F3BU;
+    hash ^= hash >> 16;
+
+    return ( ( size_t ) hash ) & pDemux->entriesMask;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns 1 and the index of the matching entry if found. Otherwise, returns
+ * 0 and the index of the empty entry which terminated the probe. */
+static uint8_t FindEntry( const RtpDemux_t * pDemux,
+                          uint32_t ssrc,
+                          uint8_t payloadType,
+                          size_t * pIndex )
+{
+    size_t index;
+    uint8_t found = 0;
+
+    index = HashSsrc( pDemux, ssrc );
+
+    while( ( found == 0 ) &&
+           ( !IS_ENTRY_EMPTY( pDemux, index ) ) )
+    {
+        if( ( pDemux->pEntries[ index ].ssrc == ssrc ) &&
+            ( pDemux->pEntries[ index ].payloadType == payloadType ) )
+        {
+            found = 1;
+        }
+        else
+        {
+            index = NEXT_INDEX( pDemux, index );
+        }
+    }
+
+    *pIndex = index;
+
+    return found;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t IsElementEqual( const uint8_t * pData,
+                               uint8_t dataLength,
+                               const uint8_t * pExpected,
+                               size_t expectedLength )
+{
+    return ( ( dataLength == expectedLength ) &&
+             ( memcmp( pData, pExpected, expectedLength ) == 0 ) ) ? 1 : 0;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpDemuxResult_t RouteByMid( RtpDemux_t * pDemux,
+                                    const uint8_t * pSerializedPacket,
+                                    size_t serializedPacketLength,
+                                    void ** ppStream )
+{
+    RtpDemuxResult_t result = RTP_DEMUX_RESULT_OK;
+    RtpPacketView_t view;
+    const uint8_t * pMid = NULL, * pRid = NULL;
+    uint8_t midLength = 0, ridLength = 0;
+    size_t i;
+
+    if( Rtp_DeSerializeView( &( pDemux->rtpCtx ),
+                             pSerializedPacket,
+                             serializedPacketLength,
+                             &( view ) ) != RTP_RESULT_OK )
+    {
+        result = RTP_DEMUX_RESULT_MALFORMED_PACKET;
+    }
+    else if( ( view.flags & RTP_HEADER_FLAG_EXTENSION ) == 0 )
+    {
+        result = RTP_DEMUX_RESULT_NOT_FOUND;
+    }
+    else if( RtpExtension_Parse( view.extensionProfile,
+                                 view.pExtensionPayload,
+                                 view.extensionPayloadLength * sizeof( uint32_t ),
+                                 &( pDemux->extensionTable ) ) != RTP_EXTENSION_RESULT_OK )
+    {
+        result = RTP_DEMUX_RESULT_MALFORMED_PACKET;
+    }
+    else if( RtpExtension_Get( &( pDemux->extensionTable ),
+                               pDemux->midExtensionId,
+                               &( pMid ),
+                               &( midLength ) ) != RTP_EXTENSION_RESULT_OK )
+    {
+        result = RTP_DEMUX_RESULT_NOT_FOUND;
+    }
+    else
+    {
+        /* RID is optional. */
+        ( void ) RtpExtension_Get( &( pDemux->extensionTable ),
+                                   pDemux->ridExtensionId,
+                                   &( pRid ),
+                                   &( ridLength ) );
+
+        result = RTP_DEMUX_RESULT_NOT_FOUND;
+
+        for( i = 0; ( result == RTP_DEMUX_RESULT_NOT_FOUND ) && ( i < pDemux->midRouteCount ); i++ )
+        {
+            if( ( IsElementEqual( pMid,
+                                  midLength,
+                                  pDemux->pMidRoutes[ i ].pMid,
+                                  pDemux->pMidRoutes[ i ].midLength ) != 0 ) &&
+                ( ( pDemux->pMidRoutes[ i ].pRid == NULL ) ||
+                  ( ( pRid != NULL ) &&
+                    ( IsElementEqual( pRid,
+                                      ridLength,
+                                      pDemux->pMidRoutes[ i ].pRid,
+                                      pDemux->pMidRoutes[ i ].ridLength ) != 0 ) ) ) )
+            {
+                *ppStream = pDemux->pMidRoutes[ i ].pStream;
+                result = RTP_DEMUX_RESULT_OK;
+            }
+        }
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        /* Learn the SSRC so that the next packets of this stream are routed
+         * without parsing the extensions. If the table is full, the packets
+         * are still routed using MID. */
+        ( void ) RtpDemux_AddSsrc( pDemux,
+                                   view.ssrc,
+                                   RTP_DEMUX_ANY_PAYLOAD_TYPE,
+                                   *ppStream );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpDemuxResult_t RtpDemux_Init( RtpDemux_t * pDemux,
+                                RtpDemuxEntry_t * pEntries,
+                                size_t entriesLength,
+                                RtpDemuxMidRoute_t * pMidRoutes,
+                                size_t midRoutesLength )
+{
+    RtpDemuxResult_t result = RTP_DEMUX_RESULT_OK;
+
+    if( ( pDemux == NULL ) ||
+        ( pEntries == NULL ) ||
+        ( entriesLength < 2 ) ||
+        ( ( entriesLength & ( entriesLength - 1 ) ) != 0 ) ||
+        ( ( pMidRoutes == NULL ) && ( midRoutesLength > 0 ) ) )
+    {
+        result = RTP_DEMUX_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        memset( pEntries,
+                0,
+                sizeof( RtpDemuxEntry_t ) * entriesLength );
+
+        pDemux->pEntries = pEntries;
+        pDemux->entriesMask = entriesLength - 1;
+        pDemux->entryCount = 0;
+
+        pDemux->pMidRoutes = pMidRoutes;
+        pDemux->midRoutesLength = midRoutesLength;
+        pDemux->midRouteCount = 0;
+
+        pDemux->midExtensionId = RTP_DEMUX_EXTENSION_ID_NONE;
+        pDemux->ridExtensionId = RTP_DEMUX_EXTENSION_ID_NONE;
+
+        ( void ) Rtp_Init( &( pDemux->rtpCtx ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpDemuxResult_t RtpDemux_SetExtensionIds( RtpDemux_t * pDemux,
+                                           uint8_t midExtensionId,
+                                           uint8_t ridExtensionId )
+{
+    RtpDemuxResult_t result = RTP_DEMUX_RESULT_OK;
+
+    if( pDemux == NULL )
+    {
+        result = RTP_DEMUX_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        pDemux->midExtensionId = midExtensionId;
+        pDemux->ridExtensionId = ridExtensionId;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpDemuxResult_t RtpDemux_AddSsrc( RtpDemux_t * pDemux,
+                                   uint32_t ssrc,
+                                   uint8_t payloadType,
+                                   void * pStream )
+{
+    RtpDemuxResult_t result = RTP_DEMUX_RESULT_OK;
+    size_t index;
+
+    if( ( pDemux == NULL ) ||
+        ( pStream == NULL ) )
+    {
+        result = RTP_DEMUX_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        if( FindEntry( pDemux, ssrc, payloadType, &( index ) ) != 0 )
+        {
+            pDemux->pEntries[ index ].pStream = pStream;
+        }
+        else if( pDemux->entryCount < pDemux->entriesMask )
+        {
+            /* At least one entry is always left empty so that the probes for
+             * unknown SSRCs terminate. */
+            pDemux->pEntries[ index ].ssrc = ssrc;
+            pDemux->pEntries[ index ].payloadType = payloadType;
+            pDemux->pEntries[ index ].pStream = pStream;
+            pDemux->entryCount += 1;
+        }
+        else
+        {
+            result = RTP_DEMUX_RESULT_FULL;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpDemuxResult_t RtpDemux_RemoveSsrc( RtpDemux_t * pDemux,
+                                      uint32_t ssrc,
+                                      uint8_t payloadType )
+{
+    RtpDemuxResult_t result = RTP_DEMUX_RESULT_OK;
+    size_t emptyIndex, index, homeIndex;
+
+    if( pDemux == NULL )
+    {
+        result = RTP_DEMUX_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        if( FindEntry( pDemux, ssrc, payloadType, &( emptyIndex ) ) == 0 )
+        {
+            result = RTP_DEMUX_RESULT_NOT_FOUND;
+        }
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        /* Backward shift deletion - move the following entries of the probe
+         * sequence into the hole so that no tombstones are needed. An entry
+         * can be moved only if the hole lies cyclically between its home
+         * index and its current index. */
+        index = NEXT_INDEX( pDemux, emptyIndex );
+
+        while( !IS_ENTRY_EMPTY( pDemux, index ) )
+        {
+            homeIndex = HashSsrc( pDemux, pDemux->pEntries[ index ].ssrc );
+
+            if( ( ( index - homeIndex ) & pDemux->entriesMask ) >=
+                ( ( index - emptyIndex ) & pDemux->entriesMask ) )
+            {
+                pDemux->pEntries[ emptyIndex ] = pDemux->pEntries[ index ];
+                emptyIndex = index;
+            }
+
+            index = NEXT_INDEX( pDemux, index );
+        }
+
+        pDemux->pEntries[ emptyIndex ].pStream = NULL;
+        pDemux->entryCount -= 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpDemuxResult_t RtpDemux_AddMidRoute( RtpDemux_t * pDemux,
+                                       const RtpDemuxMidRoute_t * pMidRoute )
+{
+    RtpDemuxResult_t result = RTP_DEMUX_RESULT_OK;
+
+    if( ( pDemux == NULL ) ||
+        ( pMidRoute == NULL ) ||
+        ( pMidRoute->pMid == NULL ) ||
+        ( pMidRoute->pStream == NULL ) )
+    {
+        result = RTP_DEMUX_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        if( pDemux->midRouteCount < pDemux->midRoutesLength )
+        {
+            pDemux->pMidRoutes[ pDemux->midRouteCount ] = *pMidRoute;
+            pDemux->midRouteCount += 1;
+        }
+        else
+        {
+            result = RTP_DEMUX_RESULT_FULL;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpDemuxResult_t RtpDemux_Route( RtpDemux_t * pDemux,
+                                 const uint8_t * pSerializedPacket,
+                                 size_t serializedPacketLength,
+                                 void ** ppStream )
+{
+    RtpDemuxResult_t result = RTP_DEMUX_RESULT_OK;
+    RtpFixedHeader_t header;
+    void * pWildcardStream = NULL;
+    size_t index;
+
+    if( ( pDemux == NULL ) ||
+        ( pSerializedPacket == NULL ) ||
+        ( ppStream == NULL ) )
+    {
+        result = RTP_DEMUX_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        if( Rtp_PeekHeader( pSerializedPacket,
+                            serializedPacketLength,
+                            &( header ) ) != RTP_RESULT_OK )
+        {
+            result = RTP_DEMUX_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    if( result == RTP_DEMUX_RESULT_OK )
+    {
+        /* Single probe sequence for both the exact and the wildcard entry as
+         * all the entries of an SSRC have the same home index. */
+        result = RTP_DEMUX_RESULT_NOT_FOUND;
+        index = HashSsrc( pDemux, header.ssrc );
+
+        while( ( result == RTP_DEMUX_RESULT_NOT_FOUND ) &&
+               ( !IS_ENTRY_EMPTY( pDemux, index ) ) )
+        {
+            if( pDemux->pEntries[ index ].ssrc == header.ssrc )
+            {
+                if( pDemux->pEntries[ index ].payloadType == header.payloadType )
+                {
+                    *ppStream = pDemux->pEntries[ index ].pStream;
+                    result = RTP_DEMUX_RESULT_OK;
+                }
+                else if( pDemux->pEntries[ index ].payloadType == RTP_DEMUX_ANY_PAYLOAD_TYPE )
+                {
+                    pWildcardStream = pDemux->pEntries[ index ].pStream;
+                }
+            }
+
+            index = NEXT_INDEX( pDemux, index );
+        }
+
+        if( ( result == RTP_DEMUX_RESULT_NOT_FOUND ) &&
+            ( pWildcardStream != NULL ) )
+        {
+            *ppStream = pWildcardStream;
+            result = RTP_DEMUX_RESULT_OK;
+        }
+    }
+
+    if( ( result == RTP_DEMUX_RESULT_NOT_FOUND ) &&
+        ( pDemux->midExtensionId != RTP_DEMUX_EXTENSION_ID_NONE ) &&
+        ( pDemux->midRouteCount > 0 ) )
+    {
+        result = RouteByMid( pDemux,
+                             pSerializedPacket,
+                             serializedPacketLength,
+                             ppStream );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,323 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtp_extension.h"
+
+/*-----------------------------------------------------------*/
+
+#define ONE_BYTE_HEADER_ID_MASK         0xF0
+#define ONE_BYTE_HEADER_ID_LOCATION     4
+#define ONE_BYTE_HEADER_LENGTH_MASK     0x0F
+
+/* ID 15 is reserved in the one-byte header and processing must stop when it
+ * is encountered (RFC 8285, section 4.2). */
+#define ONE_BYTE_HEADER_RESERVED_ID     15
+
+/* ID 0 is a padding byte in both the profiles. */
+#define PADDING_ID                      0
+
+#define SET_ID_PRESENT( pTable, id ) \
+    ( ( pTable )->presentIds[ ( id ) >> 5 ] |= ( 1U << ( ( id ) & 0x1F ) ) )
+
+#define IS_ID_PRESENT( pTable, id ) \
+    ( ( ( pTable )->presentIds[ ( id ) >> 5 ] & ( 1U << ( ( id ) & 0x1F ) ) ) != 0 )
+
+/*-----------------------------------------------------------*/
+
+static RtpExtensionResult_t ParseOneByteElements( const uint8_t * pExtensionPayload,
+                                                  size_t extensionPayloadLength,
+                                                  RtpExtensionTable_t * pTable );
+
+static RtpExtensionResult_t ParseTwoByteElements( const uint8_t * pExtensionPayload,
+                                                  size_t extensionPayloadLength,
+                                                  RtpExtensionTable_t * pTable );
+
+static void WriteByte( uint32_t * pExtensionPayloadBuffer,
+                       size_t index,
+                       uint8_t byte );
+
+/*-----------------------------------------------------------*/
+
+static RtpExtensionResult_t ParseOneByteElements( const uint8_t * pExtensionPayload,
+                                                  size_t extensionPayloadLength,
+                                                  RtpExtensionTable_t * pTable )
+{
+    RtpExtensionResult_t result = RTP_EXTENSION_RESULT_OK;
+    size_t currentIndex = 0, dataLength;
+    uint8_t id;
+
+    while( ( result == RTP_EXTENSION_RESULT_OK ) &&
+           ( currentIndex < extensionPayloadLength ) )
+    {
+        id = ( pExtensionPayload[ currentIndex ] & ONE_BYTE_HEADER_ID_MASK ) >>
+             ONE_BYTE_HEADER_ID_LOCATION;
+
+        if( id == PADDING_ID )
+        {
+            currentIndex += 1;
+        }
+        else if( id == ONE_BYTE_HEADER_RESERVED_ID )
+        {
+            currentIndex = extensionPayloadLength;
+        }
+        else
+        {
+            /* The length field contains the data length minus one. */
+            dataLength = ( pExtensionPayload[ currentIndex ] & ONE_BYTE_HEADER_LENGTH_MASK ) + 1;
+            currentIndex += 1;
+
+            if( ( currentIndex + dataLength ) <= extensionPayloadLength )
+            {
+                SET_ID_PRESENT( pTable, id );
+                pTable->dataOffset[ id ] = ( uint32_t ) currentIndex;
+                pTable->dataLength[ id ] = ( uint8_t ) dataLength;
+                currentIndex += dataLength;
+            }
+            else
+            {
+                result = RTP_EXTENSION_RESULT_MALFORMED_EXTENSION;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpExtensionResult_t ParseTwoByteElements( const uint8_t * pExtensionPayload,
+                                                  size_t extensionPayloadLength,
+                                                  RtpExtensionTable_t * pTable )
+{
+    RtpExtensionResult_t result = RTP_EXTENSION_RESULT_OK;
+    size_t currentIndex = 0, dataLength;
+    uint8_t id;
+
+    while( ( result == RTP_EXTENSION_RESULT_OK ) &&
+           ( currentIndex < extensionPayloadLength ) )
+    {
+        id = pExtensionPayload[ currentIndex ];
+
+        if( id == PADDING_ID )
+        {
+            currentIndex += 1;
+        }
+        else if( ( currentIndex + 2 ) <= extensionPayloadLength )
+        {
+            dataLength = pExtensionPayload[ currentIndex + 1 ];
+            currentIndex += 2;
+
+            if( ( currentIndex + dataLength ) <= extensionPayloadLength )
+            {
+                SET_ID_PRESENT( pTable, id );
+                pTable->dataOffset[ id ] = ( uint32_t ) currentIndex;
+                pTable->dataLength[ id ] = ( uint8_t ) dataLength;
+                currentIndex += dataLength;
+            }
+            else
+            {
+                result = RTP_EXTENSION_RESULT_MALFORMED_EXTENSION;
+            }
+        }
+        else
+        {
+            result = RTP_EXTENSION_RESULT_MALFORMED_EXTENSION;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void WriteByte( uint32_t * pExtensionPayloadBuffer,
+                       size_t index,
+                       uint8_t byte )
+{
+    /* Words are in host byte order and are converted to network byte order by
+     * Rtp_Serialize. So the first byte on the wire is the most significant
+     * byte of the word. */
+    pExtensionPayloadBuffer[ index / 4 ] |= ( ( uint32_t ) byte ) << ( 24 - ( 8 * ( index % 4 ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+RtpExtensionResult_t RtpExtension_Parse( uint16_t extensionProfile,
+                                         const uint8_t * pExtensionPayload,
+                                         size_t extensionPayloadLength,
+                                         RtpExtensionTable_t * pTable )
+{
+    RtpExtensionResult_t result = RTP_EXTENSION_RESULT_OK;
+
+    if( ( ( pExtensionPayload == NULL ) && ( extensionPayloadLength > 0 ) ) ||
+        ( pTable == NULL ) )
+    {
+        result = RTP_EXTENSION_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_EXTENSION_RESULT_OK )
+    {
+        memset( &( pTable->presentIds[ 0 ] ),
+                0,
+                sizeof( pTable->presentIds ) );
+        pTable->pExtensionPayload = pExtensionPayload;
+
+        if( extensionProfile == RTP_EXTENSION_ONE_BYTE_PROFILE )
+        {
+            result = ParseOneByteElements( pExtensionPayload,
+                                           extensionPayloadLength,
+                                           pTable );
+        }
+        else if( ( extensionProfile & RTP_EXTENSION_TWO_BYTE_PROFILE_MASK ) == RTP_EXTENSION_TWO_BYTE_PROFILE )
+        {
+            result = ParseTwoByteElements( pExtensionPayload,
+                                           extensionPayloadLength,
+                                           pTable );
+        }
+        else
+        {
+            result = RTP_EXTENSION_RESULT_UNSUPPORTED_PROFILE;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpExtensionResult_t RtpExtension_Get( const RtpExtensionTable_t * pTable,
+                                       uint8_t id,
+                                       const uint8_t ** ppData,
+                                       uint8_t * pDataLength )
+{
+    RtpExtensionResult_t result = RTP_EXTENSION_RESULT_OK;
+
+    if( ( pTable == NULL ) ||
+        ( ppData == NULL ) ||
+        ( pDataLength == NULL ) )
+    {
+        result = RTP_EXTENSION_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_EXTENSION_RESULT_OK )
+    {
+        if( IS_ID_PRESENT( pTable, id ) )
+        {
+            *ppData = &( pTable->pExtensionPayload[ pTable->dataOffset[ id ] ] );
+            *pDataLength = pTable->dataLength[ id ];
+        }
+        else
+        {
+            result = RTP_EXTENSION_RESULT_NOT_FOUND;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpExtensionResult_t RtpExtension_Build( const RtpExtensionElement_t * pElements,
+                                         size_t elementCount,
+                                         uint32_t * pExtensionPayloadBuffer,
+                                         size_t extensionPayloadBufferLength,
+                                         RtpHeaderExtension_t * pExtension )
+{
+    RtpExtensionResult_t result = RTP_EXTENSION_RESULT_OK;
+    size_t i, j, currentIndex = 0, requiredLength = 0, elementHeaderLength = 1;
+    uint8_t useTwoByteHeader = 0;
+
+    if( ( pElements == NULL ) ||
+        ( elementCount == 0 ) ||
+        ( pExtensionPayloadBuffer == NULL ) ||
+        ( pExtension == NULL ) )
+    {
+        result = RTP_EXTENSION_RESULT_BAD_PARAM;
+    }
+
+    /* The one-byte header is used unless an element does not fit in it. */
+    for( i = 0; ( result == RTP_EXTENSION_RESULT_OK ) && ( i < elementCount ); i++ )
+    {
+        if( ( pElements[ i ].id == PADDING_ID ) ||
+            ( ( pElements[ i ].pData == NULL ) && ( pElements[ i ].dataLength > 0 ) ) )
+        {
+            result = RTP_EXTENSION_RESULT_BAD_PARAM;
+        }
+        else if( ( pElements[ i ].id > RTP_EXTENSION_ONE_BYTE_MAX_ID ) ||
+                 ( pElements[ i ].dataLength == 0 ) ||
+                 ( pElements[ i ].dataLength > RTP_EXTENSION_ONE_BYTE_MAX_DATA_LENGTH ) )
+        {
+            useTwoByteHeader = 1;
+        }
+
+        requiredLength += pElements[ i ].dataLength;
+    }
+
+    if( result == RTP_EXTENSION_RESULT_OK )
+    {
+        if( useTwoByteHeader != 0 )
+        {
+            elementHeaderLength = 2;
+        }
+
+        requiredLength += ( elementCount * elementHeaderLength );
+
+        /* Pad to a multiple of 4 bytes. */
+        requiredLength = ( requiredLength + 3 ) / 4;
+
+        if( ( requiredLength > extensionPayloadBufferLength ) ||
+            ( requiredLength > UINT16_MAX ) )
+        {
+            result = RTP_EXTENSION_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == RTP_EXTENSION_RESULT_OK )
+    {
+        /* Padding bytes are zero. */
+        memset( pExtensionPayloadBuffer,
+                0,
+                requiredLength * sizeof( uint32_t ) );
+
+        for( i = 0; i < elementCount; i++ )
+        {
+            if( useTwoByteHeader != 0 )
+            {
+                WriteByte( pExtensionPayloadBuffer, currentIndex, pElements[ i ].id );
+                WriteByte( pExtensionPayloadBuffer, currentIndex + 1, pElements[ i ].dataLength );
+            }
+            else
+            {
+                WriteByte( pExtensionPayloadBuffer,
+                           currentIndex,
+                           ( uint8_t ) ( ( pElements[ i ].id << ONE_BYTE_HEADER_ID_LOCATION ) |
+                                         ( pElements[ i ].dataLength - 1 ) ) );
+            }
+
+            currentIndex += elementHeaderLength;
+
+            for( j = 0; j < pElements[ i ].dataLength; j++ )
+            {
+                WriteByte( pExtensionPayloadBuffer, currentIndex, pElements[ i ].pData[ j ] );
+                currentIndex += 1;
+            }
+        }
+
+        if( useTwoByteHeader != 0 )
+        {
+            pExtension->extensionProfile = RTP_EXTENSION_TWO_BYTE_PROFILE;
+        }
+        else
+        {
+            pExtension->extensionProfile = RTP_EXTENSION_ONE_BYTE_PROFILE;
+        }
+
+        pExtension->extensionPayloadLength = ( uint16_t ) requiredLength;
+        pExtension->pExtensionPayload = pExtensionPayloadBuffer;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,409 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtp_jitter_buffer.h"
+
+/*-----------------------------------------------------------*/
+
+/* The first packet gets this extended sequence number offset so that packets
+ * reordered before it do not wrap below zero. */
+#define RTP_SEQUENCE_NUMBER_MOD     ( 1U << 16 )
+#define RTP_SEQUENCE_NUMBER_HALF    ( 1U << 15 )
+
+#define GET_SLOT( pJitterBuffer, extendedSeqNum ) \
+    ( &( ( pJitterBuffer )->pSlots[ ( extendedSeqNum ) & ( pJitterBuffer )->slotsMask ] ) )
+
+/*-----------------------------------------------------------*/
+
+static uint32_t GetExtendedSeqNum( const RtpJitterBuffer_t * pJitterBuffer,
+                                   uint16_t seqNum );
+
+static const RtpJitterBufferSlot_t * GetPacketSlot( const RtpJitterBuffer_t * pJitterBuffer,
+                                                    uint32_t extendedSeqNum );
+
+static uint8_t IsFrameStart( const RtpJitterBuffer_t * pJitterBuffer,
+                             const RtpJitterBufferSlot_t * pSlot );
+
+static void DropPacket( RtpJitterBuffer_t * pJitterBuffer,
+                        RtpJitterBufferSlot_t * pSlot );
+
+static void SkipToFrameStart( RtpJitterBuffer_t * pJitterBuffer );
+
+static void DropOldestFrame( RtpJitterBuffer_t * pJitterBuffer );
+
+static uint8_t FindFrameEnd( RtpJitterBuffer_t * pJitterBuffer );
+
+/*-----------------------------------------------------------*/
+
+static uint32_t GetExtendedSeqNum( const RtpJitterBuffer_t * pJitterBuffer,
+                                   uint16_t seqNum )
+{
+    uint32_t extendedSeqNum;
+    uint16_t delta = ( uint16_t ) ( seqNum - ( uint16_t ) pJitterBuffer->highestSeqNum );
+
+    if( delta < RTP_SEQUENCE_NUMBER_HALF )
+    {
+        extendedSeqNum = pJitterBuffer->highestSeqNum + delta;
+    }
+    else
+    {
+        extendedSeqNum = pJitterBuffer->highestSeqNum - ( RTP_SEQUENCE_NUMBER_MOD - delta );
+    }
+
+    return extendedSeqNum;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns the slot holding the packet with the given extended sequence number,
+ * or NULL if that packet is not in the buffer. */
+static const RtpJitterBufferSlot_t * GetPacketSlot( const RtpJitterBuffer_t * pJitterBuffer,
+                                                    uint32_t extendedSeqNum )
+{
+    const RtpJitterBufferSlot_t * pSlot = GET_SLOT( pJitterBuffer, extendedSeqNum );
+
+    return ( ( pSlot->isOccupied != 0 ) &&
+             ( pSlot->extendedSeqNum == extendedSeqNum ) ) ? pSlot : NULL;
+}
+
+/*-----------------------------------------------------------*/
+
+/* A packet starts a frame if it has a new RTP timestamp and, when the codec
+ * can tell, starts a NAL unit/partition. */
+static uint8_t IsFrameStart( const RtpJitterBuffer_t * pJitterBuffer,
+                             const RtpJitterBufferSlot_t * pSlot )
+{
+    uint8_t isFrameStart = 1;
+
+    if( ( pJitterBuffer->isLastTimestampValid != 0 ) &&
+        ( pSlot->packet.rtpTimestamp == pJitterBuffer->lastTimestamp ) )
+    {
+        isFrameStart = 0;
+    }
+    else if( ( pJitterBuffer->getPacketProperties != NULL ) &&
+             ( ( pSlot->properties & RTP_JITTER_BUFFER_PACKET_PROPERTY_START_PACKET ) == 0 ) )
+    {
+        isFrameStart = 0;
+    }
+
+    return isFrameStart;
+}
+
+/*-----------------------------------------------------------*/
+
+static void DropPacket( RtpJitterBuffer_t * pJitterBuffer,
+                        RtpJitterBufferSlot_t * pSlot )
+{
+    pJitterBuffer->lastTimestamp = pSlot->packet.rtpTimestamp;
+    pJitterBuffer->isLastTimestampValid = 1;
+    pJitterBuffer->droppedPacketCount += 1;
+    pSlot->isOccupied = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Drops the leading packets which belong to a frame already released or
+ * dropped, or whose first packets were lost. */
+static void SkipToFrameStart( RtpJitterBuffer_t * pJitterBuffer )
+{
+    const RtpJitterBufferSlot_t * pSlot;
+
+    pSlot = GetPacketSlot( pJitterBuffer, pJitterBuffer->headSeqNum );
+
+    while( ( pSlot != NULL ) &&
+           ( IsFrameStart( pJitterBuffer, pSlot ) == 0 ) )
+    {
+        DropPacket( pJitterBuffer, GET_SLOT( pJitterBuffer, pJitterBuffer->headSeqNum ) );
+        pJitterBuffer->headSeqNum += 1;
+
+        pSlot = GetPacketSlot( pJitterBuffer, pJitterBuffer->headSeqNum );
+    }
+
+    if( pJitterBuffer->scanSeqNum < pJitterBuffer->headSeqNum )
+    {
+        pJitterBuffer->scanSeqNum = pJitterBuffer->headSeqNum;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Drops the packets up to the next buffered frame start, skipping the missing
+ * ones. Every sequence number is passed at most once over the lifetime of the
+ * buffer, so the cost is amortized over the packets. */
+static void DropOldestFrame( RtpJitterBuffer_t * pJitterBuffer )
+{
+    uint32_t seqNum = pJitterBuffer->headSeqNum;
+    const RtpJitterBufferSlot_t * pSlot;
+    uint8_t isFrameStartFound = 0;
+
+    /* The oldest frame is dropped even if its first packet is present. */
+    pSlot = GetPacketSlot( pJitterBuffer, seqNum );
+
+    if( pSlot != NULL )
+    {
+        DropPacket( pJitterBuffer, GET_SLOT( pJitterBuffer, seqNum ) );
+        seqNum += 1;
+    }
+
+    while( ( isFrameStartFound == 0 ) &&
+           ( seqNum <= pJitterBuffer->highestSeqNum ) )
+    {
+        pSlot = GetPacketSlot( pJitterBuffer, seqNum );
+
+        if( pSlot == NULL )
+        {
+            seqNum += 1;
+        }
+        else if( IsFrameStart( pJitterBuffer, pSlot ) != 0 )
+        {
+            isFrameStartFound = 1;
+        }
+        else
+        {
+            DropPacket( pJitterBuffer, GET_SLOT( pJitterBuffer, seqNum ) );
+            seqNum += 1;
+        }
+    }
+
+    pJitterBuffer->headSeqNum = seqNum;
+    pJitterBuffer->scanSeqNum = seqNum;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Extends the run of present packets from scanSeqNum until the end of the
+ * oldest frame is found. A packet ends a frame if it has the marker bit set,
+ * or if the next packet has a different RTP timestamp. Each packet is
+ * examined once, as scanSeqNum is kept across calls. */
+static uint8_t FindFrameEnd( RtpJitterBuffer_t * pJitterBuffer )
+{
+    const RtpJitterBufferSlot_t * pSlot, * pNextSlot;
+    uint8_t isFrameEndFound = 0, isBlocked = 0;
+
+    while( ( isFrameEndFound == 0 ) &&
+           ( isBlocked == 0 ) )
+    {
+        pSlot = GetPacketSlot( pJitterBuffer, pJitterBuffer->scanSeqNum );
+        pNextSlot = GetPacketSlot( pJitterBuffer, pJitterBuffer->scanSeqNum + 1 );
+
+        if( pSlot == NULL )
+        {
+            isBlocked = 1;
+        }
+        else if( pSlot->packet.isMarker != 0 )
+        {
+            isFrameEndFound = 1;
+        }
+        else if( pNextSlot == NULL )
+        {
+            isBlocked = 1;
+        }
+        else if( pNextSlot->packet.rtpTimestamp != pSlot->packet.rtpTimestamp )
+        {
+            isFrameEndFound = 1;
+        }
+        else
+        {
+            pJitterBuffer->scanSeqNum += 1;
+        }
+    }
+
+    return isFrameEndFound;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpJitterBufferResult_t RtpJitterBuffer_Init( RtpJitterBuffer_t * pJitterBuffer,
+                                              RtpJitterBufferSlot_t * pSlots,
+                                              size_t slotsLength,
+                                              RtpJitterBufferGetPacketProperties_t getPacketProperties,
+                                              uint64_t maxLatency )
+{
+    RtpJitterBufferResult_t result = RTP_JITTER_BUFFER_RESULT_OK;
+
+    if( ( pJitterBuffer == NULL ) ||
+        ( pSlots == NULL ) ||
+        ( slotsLength < 2 ) ||
+        ( slotsLength > RTP_SEQUENCE_NUMBER_HALF ) ||
+        ( ( slotsLength & ( slotsLength - 1 ) ) != 0 ) )
+    {
+        result = RTP_JITTER_BUFFER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        memset( pJitterBuffer, 0, sizeof( RtpJitterBuffer_t ) );
+        memset( pSlots, 0, sizeof( RtpJitterBufferSlot_t ) * slotsLength );
+
+        pJitterBuffer->pSlots = pSlots;
+        pJitterBuffer->slotsMask = slotsLength - 1;
+        pJitterBuffer->getPacketProperties = getPacketProperties;
+        pJitterBuffer->maxLatency = maxLatency;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpJitterBufferResult_t RtpJitterBuffer_Push( RtpJitterBuffer_t * pJitterBuffer,
+                                              const RtpJitterBufferPacket_t * pPacket )
+{
+    uint32_t extendedSeqNum = 0;
+    RtpJitterBufferSlot_t * pSlot;
+    RtpJitterBufferResult_t result = RTP_JITTER_BUFFER_RESULT_OK;
+
+    if( ( pJitterBuffer == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPayload == NULL ) )
+    {
+        result = RTP_JITTER_BUFFER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        if( pJitterBuffer->isStarted == 0 )
+        {
+            extendedSeqNum = RTP_SEQUENCE_NUMBER_MOD + pPacket->seqNum;
+            pJitterBuffer->headSeqNum = extendedSeqNum;
+            pJitterBuffer->scanSeqNum = extendedSeqNum;
+            pJitterBuffer->highestSeqNum = extendedSeqNum;
+            pJitterBuffer->isStarted = 1;
+        }
+        else
+        {
+            extendedSeqNum = GetExtendedSeqNum( pJitterBuffer, pPacket->seqNum );
+        }
+
+        if( extendedSeqNum < pJitterBuffer->headSeqNum )
+        {
+            pJitterBuffer->latePacketCount += 1;
+            result = RTP_JITTER_BUFFER_RESULT_LATE_PACKET;
+        }
+        else if( GetPacketSlot( pJitterBuffer, extendedSeqNum ) != NULL )
+        {
+            result = RTP_JITTER_BUFFER_RESULT_DUPLICATE_PACKET;
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        /* Make room by dropping the oldest frames. */
+        while( ( ( extendedSeqNum - pJitterBuffer->headSeqNum ) > pJitterBuffer->slotsMask ) &&
+               ( pJitterBuffer->headSeqNum <= pJitterBuffer->highestSeqNum ) )
+        {
+            DropOldestFrame( pJitterBuffer );
+        }
+
+        if( ( extendedSeqNum - pJitterBuffer->headSeqNum ) > pJitterBuffer->slotsMask )
+        {
+            /* The buffer is empty and the packet is far ahead - restart from it. */
+            pJitterBuffer->headSeqNum = extendedSeqNum;
+            pJitterBuffer->scanSeqNum = extendedSeqNum;
+        }
+
+        pSlot = GET_SLOT( pJitterBuffer, extendedSeqNum );
+        pSlot->packet = *pPacket;
+        pSlot->extendedSeqNum = extendedSeqNum;
+        pSlot->properties = ( pJitterBuffer->getPacketProperties != NULL ) ?
+                            pJitterBuffer->getPacketProperties( pPacket->pPayload, pPacket->payloadLength ) : 0;
+        pSlot->isOccupied = 1;
+
+        if( extendedSeqNum > pJitterBuffer->highestSeqNum )
+        {
+            pJitterBuffer->highestSeqNum = extendedSeqNum;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpJitterBufferResult_t RtpJitterBuffer_PopFrame( RtpJitterBuffer_t * pJitterBuffer,
+                                                  uint64_t currentTime,
+                                                  RtpJitterBufferPacket_t * pPackets,
+                                                  size_t packetsLength,
+                                                  size_t * pPacketCount )
+{
+    size_t i, count = 0;
+    uint8_t isFrameEndFound = 0;
+    RtpJitterBufferSlot_t * pSlot;
+    RtpJitterBufferResult_t result = RTP_JITTER_BUFFER_RESULT_OK;
+
+    if( ( pJitterBuffer == NULL ) ||
+        ( pPackets == NULL ) ||
+        ( pPacketCount == NULL ) )
+    {
+        result = RTP_JITTER_BUFFER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        if( pJitterBuffer->isStarted != 0 )
+        {
+            SkipToFrameStart( pJitterBuffer );
+            isFrameEndFound = FindFrameEnd( pJitterBuffer );
+
+            if( ( isFrameEndFound == 0 ) &&
+                ( pJitterBuffer->maxLatency != 0 ) )
+            {
+                if( pJitterBuffer->headSeqNum > pJitterBuffer->highestSeqNum )
+                {
+                    /* Nothing is buffered. */
+                    pJitterBuffer->isWaiting = 0;
+                }
+                else if( pJitterBuffer->isWaiting == 0 )
+                {
+                    pJitterBuffer->isWaiting = 1;
+                    pJitterBuffer->waitStartTime = currentTime;
+                }
+                else if( ( currentTime > pJitterBuffer->waitStartTime ) &&
+                         ( ( currentTime - pJitterBuffer->waitStartTime ) > pJitterBuffer->maxLatency ) )
+                {
+                    DropOldestFrame( pJitterBuffer );
+                    pJitterBuffer->waitStartTime = currentTime;
+                    isFrameEndFound = FindFrameEnd( pJitterBuffer );
+                }
+            }
+        }
+
+        if( isFrameEndFound == 0 )
+        {
+            result = RTP_JITTER_BUFFER_RESULT_NO_FRAME;
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        count = ( size_t ) ( pJitterBuffer->scanSeqNum - pJitterBuffer->headSeqNum ) + 1;
+
+        if( count > packetsLength )
+        {
+            result = RTP_JITTER_BUFFER_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        for( i = 0; i < count; i++ )
+        {
+            pSlot = GET_SLOT( pJitterBuffer, pJitterBuffer->headSeqNum + i );
+            pPackets[ i ] = pSlot->packet;
+            pSlot->isOccupied = 0;
+        }
+
+        pJitterBuffer->lastTimestamp = pPackets[ 0 ].rtpTimestamp;
+        pJitterBuffer->isLastTimestampValid = 1;
+        pJitterBuffer->headSeqNum += ( uint32_t ) count;
+        pJitterBuffer->scanSeqNum = pJitterBuffer->headSeqNum;
+        pJitterBuffer->isWaiting = 0;
+
+        *pPacketCount = count;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
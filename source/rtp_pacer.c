@@ -0,0 +1,323 @@
+/* API includes. */
+#include "rtp_pacer.h"
+
+/*-----------------------------------------------------------*/
+
+/* The budget is accrued in bits per second times microseconds. */
+#define BUDGET_UNITS_PER_BYTE    ( 8U * 1000000U )
+
+/*-----------------------------------------------------------*/
+
+static RtpPacerResult_t ConvertQueueResult( RtpPacketQueueResult_t queueResult );
+
+static void UpdateBudget( RtpPacer_t * pPacer,
+                          uint64_t currentTimeUs );
+
+static RtpPacerResult_t FindNextPacket( RtpPacer_t * pPacer,
+                                        size_t * pPriority,
+                                        RtpPacketInfo_t * pRtpPacketInfo );
+
+/*-----------------------------------------------------------*/
+
+static RtpPacerResult_t ConvertQueueResult( RtpPacketQueueResult_t queueResult )
+{
+    RtpPacerResult_t result;
+
+    switch( queueResult )
+    {
+        case RTP_PACKET_QUEUE_RESULT_OK:
+            result = RTP_PACER_RESULT_OK;
+            break;
+
+        case RTP_PACKET_QUEUE_RESULT_FULL:
+            result = RTP_PACER_RESULT_FULL;
+            break;
+
+        case RTP_PACKET_QUEUE_RESULT_PACKET_DELETED:
+            result = RTP_PACER_RESULT_PACKET_DELETED;
+            break;
+
+        case RTP_PACKET_QUEUE_RESULT_EMPTY:
+            result = RTP_PACER_RESULT_EMPTY;
+            break;
+
+        default:
+            result = RTP_PACER_RESULT_BAD_PARAM;
+            break;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void UpdateBudget( RtpPacer_t * pPacer,
+                          uint64_t currentTimeUs )
+{
+    uint64_t elapsedTimeUs = 0, missingUnits, timeToFullUs, units;
+
+    if( currentTimeUs > pPacer->lastUpdateTimeUs )
+    {
+        elapsedTimeUs = currentTimeUs - pPacer->lastUpdateTimeUs;
+        pPacer->lastUpdateTimeUs = currentTimeUs;
+    }
+
+    if( pPacer->budgetBytes >= ( int64_t ) pPacer->maxBurstBytes )
+    {
+        pPacer->budgetBytes = ( int64_t ) pPacer->maxBurstBytes;
+        pPacer->budgetRemainder = 0;
+    }
+    else
+    {
+        /* Only the time needed to fill the bucket is accounted for, which
+         * keeps the multiplication below from overflowing. */
+        missingUnits = ( ( uint64_t ) ( ( int64_t ) pPacer->maxBurstBytes - pPacer->budgetBytes ) * BUDGET_UNITS_PER_BYTE ) -
+                       pPacer->budgetRemainder;
+        timeToFullUs = ( missingUnits + pPacer->bitrate - 1U ) / pPacer->bitrate;
+
+        if( elapsedTimeUs >= timeToFullUs )
+        {
+            pPacer->budgetBytes = ( int64_t ) pPacer->maxBurstBytes;
+            pPacer->budgetRemainder = 0;
+        }
+        else
+        {
+            units = ( elapsedTimeUs * pPacer->bitrate ) + pPacer->budgetRemainder;
+            pPacer->budgetBytes += ( int64_t ) ( units / BUDGET_UNITS_PER_BYTE );
+            pPacer->budgetRemainder = units % BUDGET_UNITS_PER_BYTE;
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpPacerResult_t FindNextPacket( RtpPacer_t * pPacer,
+                                        size_t * pPriority,
+                                        RtpPacketInfo_t * pRtpPacketInfo )
+{
+    size_t i;
+    RtpPacketQueueResult_t queueResult = RTP_PACKET_QUEUE_RESULT_EMPTY;
+
+    for( i = 0; ( i < pPacer->queueCount ) && ( queueResult == RTP_PACKET_QUEUE_RESULT_EMPTY ); i++ )
+    {
+        queueResult = RtpPacketQueue_Peek( &( pPacer->pQueues[ i ] ),
+                                           pRtpPacketInfo );
+        *pPriority = i;
+    }
+
+    return ConvertQueueResult( queueResult );
+}
+
+/*-----------------------------------------------------------*/
+
+RtpPacerResult_t RtpPacer_Init( RtpPacer_t * pPacer,
+                                RtpPacketQueue_t * pQueues,
+                                size_t queueCount,
+                                RtpPacerGetCurrentTimeUs_t getCurrentTimeUs,
+                                void * pCustomContext,
+                                uint64_t bitrate,
+                                size_t maxBurstBytes )
+{
+    RtpPacerResult_t result = RTP_PACER_RESULT_OK;
+
+    if( ( pPacer == NULL ) ||
+        ( pQueues == NULL ) ||
+        ( queueCount == 0 ) ||
+        ( getCurrentTimeUs == NULL ) ||
+        ( bitrate == 0 ) ||
+        ( maxBurstBytes > INT32_MAX ) )
+    {
+        result = RTP_PACER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        pPacer->pQueues = pQueues;
+        pPacer->queueCount = queueCount;
+        pPacer->getCurrentTimeUs = getCurrentTimeUs;
+        pPacer->pCustomContext = pCustomContext;
+        pPacer->bitrate = bitrate;
+        pPacer->maxBurstBytes = maxBurstBytes;
+        pPacer->budgetBytes = ( int64_t ) maxBurstBytes;
+        pPacer->budgetRemainder = 0;
+        pPacer->lastUpdateTimeUs = getCurrentTimeUs( pCustomContext );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpPacerResult_t RtpPacer_SetRate( RtpPacer_t * pPacer,
+                                   uint64_t bitrate,
+                                   size_t maxBurstBytes )
+{
+    RtpPacerResult_t result = RTP_PACER_RESULT_OK;
+
+    if( ( pPacer == NULL ) ||
+        ( bitrate == 0 ) ||
+        ( maxBurstBytes > INT32_MAX ) )
+    {
+        result = RTP_PACER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        /* Account for the time elapsed so far at the previous rate. */
+        UpdateBudget( pPacer,
+                      pPacer->getCurrentTimeUs( pPacer->pCustomContext ) );
+
+        pPacer->bitrate = bitrate;
+        pPacer->maxBurstBytes = maxBurstBytes;
+
+        if( pPacer->budgetBytes > ( int64_t ) maxBurstBytes )
+        {
+            pPacer->budgetBytes = ( int64_t ) maxBurstBytes;
+            pPacer->budgetRemainder = 0;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpPacerResult_t RtpPacer_Enqueue( RtpPacer_t * pPacer,
+                                   size_t priority,
+                                   const RtpPacketInfo_t * pRtpPacketInfo )
+{
+    RtpPacerResult_t result = RTP_PACER_RESULT_OK;
+
+    if( ( pPacer == NULL ) ||
+        ( priority >= pPacer->queueCount ) ||
+        ( pRtpPacketInfo == NULL ) )
+    {
+        result = RTP_PACER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        result = ConvertQueueResult( RtpPacketQueue_Enqueue( &( pPacer->pQueues[ priority ] ),
+                                                             pRtpPacketInfo ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpPacerResult_t RtpPacer_EnqueueCopy( RtpPacer_t * pPacer,
+                                       size_t priority,
+                                       uint16_t seqNum,
+                                       const uint8_t * pSerializedRtpPacket,
+                                       size_t serializedPacketLength )
+{
+    RtpPacerResult_t result = RTP_PACER_RESULT_OK;
+
+    if( ( pPacer == NULL ) ||
+        ( priority >= pPacer->queueCount ) )
+    {
+        result = RTP_PACER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        result = ConvertQueueResult( RtpPacketQueue_EnqueueCopy( &( pPacer->pQueues[ priority ] ),
+                                                                 seqNum,
+                                                                 pSerializedRtpPacket,
+                                                                 serializedPacketLength,
+                                                                 pPacer->getCurrentTimeUs( pPacer->pCustomContext ) ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* A packet is released as long as the budget is not negative, and the budget
+ * goes into debt by the part of the packet it does not cover. */
+RtpPacerResult_t RtpPacer_GetNextPacket( RtpPacer_t * pPacer,
+                                         RtpPacketInfo_t * pRtpPacketInfo )
+{
+    size_t priority = 0;
+    RtpPacerResult_t result = RTP_PACER_RESULT_OK;
+
+    if( ( pPacer == NULL ) ||
+        ( pRtpPacketInfo == NULL ) )
+    {
+        result = RTP_PACER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        result = FindNextPacket( pPacer,
+                                 &( priority ),
+                                 pRtpPacketInfo );
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        UpdateBudget( pPacer,
+                      pPacer->getCurrentTimeUs( pPacer->pCustomContext ) );
+
+        if( pPacer->budgetBytes < 0 )
+        {
+            result = RTP_PACER_RESULT_NOT_READY;
+        }
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        ( void ) RtpPacketQueue_Dequeue( &( pPacer->pQueues[ priority ] ),
+                                         pRtpPacketInfo );
+        pPacer->budgetBytes -= ( int64_t ) pRtpPacketInfo->serializedPacketLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpPacerResult_t RtpPacer_GetNextSendTime( RtpPacer_t * pPacer,
+                                           uint64_t * pNextSendTimeUs )
+{
+    size_t priority = 0;
+    uint64_t currentTimeUs, missingUnits;
+    RtpPacketInfo_t rtpPacketInfo;
+    RtpPacerResult_t result = RTP_PACER_RESULT_OK;
+
+    if( ( pPacer == NULL ) ||
+        ( pNextSendTimeUs == NULL ) )
+    {
+        result = RTP_PACER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        result = FindNextPacket( pPacer,
+                                 &( priority ),
+                                 &( rtpPacketInfo ) );
+    }
+
+    if( result == RTP_PACER_RESULT_OK )
+    {
+        currentTimeUs = pPacer->getCurrentTimeUs( pPacer->pCustomContext );
+        UpdateBudget( pPacer,
+                      currentTimeUs );
+
+        if( pPacer->budgetBytes >= 0 )
+        {
+            *pNextSendTimeUs = currentTimeUs;
+        }
+        else
+        {
+            missingUnits = ( ( uint64_t ) ( -pPacer->budgetBytes ) * BUDGET_UNITS_PER_BYTE ) -
+                           pPacer->budgetRemainder;
+            *pNextSendTimeUs = currentTimeUs + ( ( missingUnits + pPacer->bitrate - 1U ) / pPacer->bitrate );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
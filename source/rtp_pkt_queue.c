@@ -6,16 +6,11 @@
 
 /*----------------------------------------------------------------------------*/
 
-#define WRAP( x, n ) \
-    ( ( x ) % ( n ) )
+#define INC_READ_INDEX( pQueue ) \
+    WrapIndex( ( pQueue ), ( pQueue )->readIndex + 1 )
 
-#define INC_READ_INDEX( pQueue )        \
-    WRAP( ( pQueue )->readIndex + 1,    \
-          ( pQueue )->rtpPacketInfoArrayLength )
-
-#define INC_WRITE_INDEX( pQueue )       \
-    WRAP( ( pQueue )->writeIndex + 1,   \
-          ( pQueue )->rtpPacketInfoArrayLength )
+#define INC_WRITE_INDEX( pQueue ) \
+    WrapIndex( ( pQueue ), ( pQueue )->writeIndex + 1 )
 
 #define IS_QUEUE_FULL( pQueue ) \
     ( ( pQueue )->packetCount == ( pQueue )->rtpPacketInfoArrayLength )
@@ -25,6 +20,321 @@
 
 /*----------------------------------------------------------------------------*/
 
+static size_t WrapIndex( const RtpPacketQueue_t * pQueue,
+                         size_t index );
+
+static void UpdateDirectMapping( RtpPacketQueue_t * pQueue,
+                                 const RtpPacketInfo_t * pRtpPacketInfos,
+                                 size_t rtpPacketInfosCount );
+
+static void WritePacketInfo( RtpPacketQueue_t * pQueue,
+                             const RtpPacketInfo_t * pRtpPacketInfo );
+
+static void RemoveOldestPacketInfo( RtpPacketQueue_t * pQueue );
+
+static uint8_t * AllocateStorage( RtpPacketQueue_t * pQueue,
+                                  size_t length );
+
+static void CopyIntoQueue( RtpPacketQueue_t * pQueue,
+                           size_t index,
+                           const RtpPacketInfo_t * pRtpPacketInfos,
+                           size_t rtpPacketInfosCount );
+
+static void CopyFromQueue( const RtpPacketQueue_t * pQueue,
+                           size_t index,
+                           RtpPacketInfo_t * pRtpPacketInfos,
+                           size_t rtpPacketInfosCount );
+
+static uint8_t FindMappedPacketInfo( const RtpPacketQueue_t * pQueue,
+                                     uint16_t seqNum,
+                                     size_t * pIndex );
+
+static RtpPacketQueueResult_t FindPacketInfo( const RtpPacketQueue_t * pQueue,
+                                              uint16_t seqNum,
+                                              size_t * pIndex );
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Wrap an index into the RTP packet info array.
+ *
+ * Power of two lengths use a mask instead of the modulo.
+ */
+static size_t WrapIndex( const RtpPacketQueue_t * pQueue,
+                         size_t index )
+{
+    size_t wrappedIndex;
+
+    if( pQueue->indexMask != 0 )
+    {
+        wrappedIndex = index & pQueue->indexMask;
+    }
+    else
+    {
+        wrappedIndex = index % pQueue->rtpPacketInfoArrayLength;
+    }
+
+    return wrappedIndex;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Track the direct mapping of the RTP packet infos about to be written
+ * at the tail of the queue.
+ *
+ * In the direct mapped mode, an empty queue is re-anchored so that the first
+ * packet lands in the slot selected by its sequence number. A sequence number
+ * gap moves the mapping so that the packets from the gap onwards are found
+ * directly again. The packets before the gap are left to the scan until they
+ * are removed.
+ */
+static void UpdateDirectMapping( RtpPacketQueue_t * pQueue,
+                                 const RtpPacketInfo_t * pRtpPacketInfos,
+                                 size_t rtpPacketInfosCount )
+{
+    size_t i, index;
+
+    if( pQueue->isDirectMapped != 0 )
+    {
+        if( IS_QUEUE_EMPTY( pQueue ) )
+        {
+            pQueue->readIndex = ( size_t ) pRtpPacketInfos[ 0 ].seqNum & pQueue->indexMask;
+            pQueue->writeIndex = pQueue->readIndex;
+            pQueue->mappingOffset = 0;
+            pQueue->unmappedCount = 0;
+        }
+
+        for( i = 0; i < rtpPacketInfosCount; i++ )
+        {
+            index = ( pQueue->writeIndex + i ) & pQueue->indexMask;
+
+            if( ( ( ( size_t ) pRtpPacketInfos[ i ].seqNum + pQueue->mappingOffset ) & pQueue->indexMask ) != index )
+            {
+                pQueue->mappingOffset = ( index - ( size_t ) pRtpPacketInfos[ i ].seqNum ) & pQueue->indexMask;
+                pQueue->unmappedCount = pQueue->packetCount + i;
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Write an RTP packet info at the tail of the queue.
+ *
+ * The caller must ensure that the queue is not full.
+ */
+static void WritePacketInfo( RtpPacketQueue_t * pQueue,
+                             const RtpPacketInfo_t * pRtpPacketInfo )
+{
+    UpdateDirectMapping( pQueue, pRtpPacketInfo, 1 );
+
+    pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].seqNum = pRtpPacketInfo->seqNum;
+    pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].pSerializedRtpPacket = pRtpPacketInfo->pSerializedRtpPacket;
+    pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].serializedPacketLength = pRtpPacketInfo->serializedPacketLength;
+    pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].insertionTime = pRtpPacketInfo->insertionTime;
+
+    pQueue->writeIndex = INC_WRITE_INDEX( pQueue );
+    pQueue->packetCount += 1;
+    pQueue->totalBytes += pRtpPacketInfo->serializedPacketLength;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Remove the oldest RTP packet info from the queue.
+ *
+ * The caller must ensure that the queue is not empty.
+ */
+static void RemoveOldestPacketInfo( RtpPacketQueue_t * pQueue )
+{
+    pQueue->totalBytes -= pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].serializedPacketLength;
+    pQueue->readIndex = INC_READ_INDEX( pQueue );
+    pQueue->packetCount -= 1;
+
+    if( pQueue->unmappedCount > 0 )
+    {
+        pQueue->unmappedCount -= 1;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Find room for length contiguous bytes in the storage.
+ *
+ * The storage is used as a ring of bytes in which the serialized packets are
+ * laid out in the same order as the packet infos, so the oldest serialized
+ * packet always marks the start of the used region. A serialized packet is
+ * never split - if it does not fit before the end of the storage, it is
+ * placed at the start. Return NULL if there is no room without removing
+ * packet infos.
+ */
+static uint8_t * AllocateStorage( RtpPacketQueue_t * pQueue,
+                                  size_t length )
+{
+    size_t usedStartOffset;
+    uint8_t * pBuffer = NULL;
+
+    if( IS_QUEUE_EMPTY( pQueue ) )
+    {
+        pQueue->storageWriteOffset = 0;
+        pBuffer = pQueue->pStorage;
+    }
+    else
+    {
+        usedStartOffset = ( size_t ) ( pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].pSerializedRtpPacket - pQueue->pStorage );
+
+        if( pQueue->storageWriteOffset > usedStartOffset )
+        {
+            if( ( pQueue->storageLength - pQueue->storageWriteOffset ) >= length )
+            {
+                pBuffer = &( pQueue->pStorage[ pQueue->storageWriteOffset ] );
+            }
+            else if( usedStartOffset >= length )
+            {
+                pBuffer = pQueue->pStorage;
+            }
+        }
+        else if( ( ( usedStartOffset - pQueue->storageWriteOffset ) >= length ) &&
+                 ( ( pQueue->storageLength - pQueue->storageWriteOffset ) >= length ) )
+        {
+            pBuffer = &( pQueue->pStorage[ pQueue->storageWriteOffset ] );
+        }
+    }
+
+    return pBuffer;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Copy a run of RTP packet infos into the queue starting at the given
+ * array index, wrapping around the end of the array at most once.
+ */
+static void CopyIntoQueue( RtpPacketQueue_t * pQueue,
+                           size_t index,
+                           const RtpPacketInfo_t * pRtpPacketInfos,
+                           size_t rtpPacketInfosCount )
+{
+    size_t firstRunCount;
+
+    firstRunCount = pQueue->rtpPacketInfoArrayLength - index;
+    firstRunCount = ( rtpPacketInfosCount < firstRunCount ) ? rtpPacketInfosCount : firstRunCount;
+
+    memcpy( &( pQueue->pRtpPacketInfoArray[ index ] ),
+            pRtpPacketInfos,
+            sizeof( RtpPacketInfo_t ) * firstRunCount );
+
+    if( rtpPacketInfosCount > firstRunCount )
+    {
+        memcpy( &( pQueue->pRtpPacketInfoArray[ 0 ] ),
+                &( pRtpPacketInfos[ firstRunCount ] ),
+                sizeof( RtpPacketInfo_t ) * ( rtpPacketInfosCount - firstRunCount ) );
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Copy a run of RTP packet infos out of the queue starting at the
+ * given array index, wrapping around the end of the array at most once.
+ */
+static void CopyFromQueue( const RtpPacketQueue_t * pQueue,
+                           size_t index,
+                           RtpPacketInfo_t * pRtpPacketInfos,
+                           size_t rtpPacketInfosCount )
+{
+    size_t firstRunCount;
+
+    firstRunCount = pQueue->rtpPacketInfoArrayLength - index;
+    firstRunCount = ( rtpPacketInfosCount < firstRunCount ) ? rtpPacketInfosCount : firstRunCount;
+
+    memcpy( pRtpPacketInfos,
+            &( pQueue->pRtpPacketInfoArray[ index ] ),
+            sizeof( RtpPacketInfo_t ) * firstRunCount );
+
+    if( rtpPacketInfosCount > firstRunCount )
+    {
+        memcpy( &( pRtpPacketInfos[ firstRunCount ] ),
+                &( pQueue->pRtpPacketInfoArray[ 0 ] ),
+                sizeof( RtpPacketInfo_t ) * ( rtpPacketInfosCount - firstRunCount ) );
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Look up the sequence number in the direct mapped slots.
+ *
+ * A single indexed load, validated against the stored sequence number. Only
+ * the packet infos enqueued since the last sequence number gap are mapped.
+ */
+static uint8_t FindMappedPacketInfo( const RtpPacketQueue_t * pQueue,
+                                     uint16_t seqNum,
+                                     size_t * pIndex )
+{
+    size_t index, position;
+    uint8_t isFound = 0;
+
+    index = ( ( size_t ) seqNum + pQueue->mappingOffset ) & pQueue->indexMask;
+    position = ( index - pQueue->readIndex ) & pQueue->indexMask;
+
+    if( ( position >= pQueue->unmappedCount ) &&
+        ( position < pQueue->packetCount ) &&
+        ( pQueue->pRtpPacketInfoArray[ index ].seqNum == seqNum ) )
+    {
+        *pIndex = index;
+        isFound = 1;
+    }
+
+    return isFound;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Find the array index of the RTP packet info with the matching
+ * sequence number.
+ *
+ * A direct mapped queue resolves the sequence number with a single indexed
+ * load and only scans the packets enqueued before the last sequence number
+ * gap. Otherwise, the whole queue is scanned from the oldest packet.
+ */
+static RtpPacketQueueResult_t FindPacketInfo( const RtpPacketQueue_t * pQueue,
+                                              uint16_t seqNum,
+                                              size_t * pIndex )
+{
+    size_t i, index, scanCount = pQueue->packetCount;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND;
+
+    if( pQueue->isDirectMapped != 0 )
+    {
+        if( FindMappedPacketInfo( pQueue, seqNum, pIndex ) != 0U )
+        {
+            result = RTP_PACKET_QUEUE_RESULT_OK;
+        }
+
+        scanCount = pQueue->unmappedCount;
+    }
+
+    for( i = 0; ( result == RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND ) && ( i < scanCount ); i++ )
+    {
+        index = WrapIndex( pQueue, pQueue->readIndex + i );
+
+        if( pQueue->pRtpPacketInfoArray[ index ].seqNum == seqNum )
+        {
+            *pIndex = index;
+            result = RTP_PACKET_QUEUE_RESULT_OK;
+        }
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
 RtpPacketQueueResult_t RtpPacketQueue_Init( RtpPacketQueue_t * pQueue,
                                             RtpPacketInfo_t * pRtpPacketInfoArray,
                                             size_t rtpPacketInfoArrayLength )
@@ -50,6 +360,62 @@ RtpPacketQueueResult_t RtpPacketQueue_Init( RtpPacketQueue_t * pQueue,
         pQueue->readIndex = 0;
         pQueue->writeIndex = 0;
         pQueue->packetCount = 0;
+        pQueue->totalBytes = 0;
+        pQueue->maxBytes = 0;
+        pQueue->maxAge = 0;
+        pQueue->pStorage = NULL;
+        pQueue->storageLength = 0;
+        pQueue->storageWriteOffset = 0;
+        pQueue->pReservedBuffer = NULL;
+        pQueue->reservedLength = 0;
+        pQueue->isDirectMapped = 0;
+        pQueue->mappingOffset = 0;
+        pQueue->unmappedCount = 0;
+
+        if( ( rtpPacketInfoArrayLength & ( rtpPacketInfoArrayLength - 1 ) ) == 0 )
+        {
+            pQueue->indexMask = rtpPacketInfoArrayLength - 1;
+        }
+        else
+        {
+            pQueue->indexMask = 0;
+        }
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initialize a queue in which packet infos are direct mapped by
+ * sequence number.
+ *
+ * The RTP packet info array length must be a power of two. A packet info is
+ * stored in the slot seqNum & ( length - 1 ), so that the retrieval by
+ * sequence number does not need to scan the queue.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_InitDirectMapped( RtpPacketQueue_t * pQueue,
+                                                        RtpPacketInfo_t * pRtpPacketInfoArray,
+                                                        size_t rtpPacketInfoArrayLength )
+{
+    RtpPacketQueueResult_t result;
+
+    result = RtpPacketQueue_Init( pQueue,
+                                  pRtpPacketInfoArray,
+                                  rtpPacketInfoArrayLength );
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        if( pQueue->indexMask == 0 )
+        {
+            result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        pQueue->isDirectMapped = 1;
     }
 
     return result;
@@ -66,7 +432,8 @@ RtpPacketQueueResult_t RtpPacketQueue_Enqueue( RtpPacketQueue_t * pQueue,
     RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
 
     if( ( pQueue == NULL ) ||
-        ( pRtpPacketInfo == NULL ) )
+        ( pRtpPacketInfo == NULL ) ||
+        ( pQueue->pStorage != NULL ) )
     {
         result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
     }
@@ -81,12 +448,7 @@ RtpPacketQueueResult_t RtpPacketQueue_Enqueue( RtpPacketQueue_t * pQueue,
 
     if( result == RTP_PACKET_QUEUE_RESULT_OK )
     {
-        pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].seqNum = pRtpPacketInfo->seqNum;
-        pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].pSerializedRtpPacket = pRtpPacketInfo->pSerializedRtpPacket;
-        pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].serializedPacketLength = pRtpPacketInfo->serializedPacketLength;
-
-        pQueue->writeIndex = INC_WRITE_INDEX( pQueue );
-        pQueue->packetCount += 1;
+        WritePacketInfo( pQueue, pRtpPacketInfo );
     }
 
     return result;
@@ -107,7 +469,8 @@ RtpPacketQueueResult_t RtpPacketQueue_ForceEnqueue( RtpPacketQueue_t * pQueue,
 
     if( ( pQueue == NULL ) ||
         ( pRtpPacketInfo == NULL ) ||
-        ( pDeletedRtpPacketInfo == NULL ) )
+        ( pDeletedRtpPacketInfo == NULL ) ||
+        ( pQueue->pStorage != NULL ) )
     {
         result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
     }
@@ -119,18 +482,13 @@ RtpPacketQueueResult_t RtpPacketQueue_ForceEnqueue( RtpPacketQueue_t * pQueue,
             pDeletedRtpPacketInfo->seqNum = pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].seqNum;
             pDeletedRtpPacketInfo->pSerializedRtpPacket = pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].pSerializedRtpPacket;
             pDeletedRtpPacketInfo->serializedPacketLength = pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].serializedPacketLength;
+            pDeletedRtpPacketInfo->insertionTime = pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].insertionTime;
 
-            pQueue->readIndex = INC_READ_INDEX( pQueue );
-            pQueue->packetCount -= 1;
+            RemoveOldestPacketInfo( pQueue );
             result = RTP_PACKET_QUEUE_RESULT_PACKET_DELETED;
         }
 
-        pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].seqNum = pRtpPacketInfo->seqNum;
-        pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].pSerializedRtpPacket = pRtpPacketInfo->pSerializedRtpPacket;
-        pQueue->pRtpPacketInfoArray[ pQueue->writeIndex ].serializedPacketLength = pRtpPacketInfo->serializedPacketLength;
-
-        pQueue->writeIndex = INC_WRITE_INDEX( pQueue );
-        pQueue->packetCount += 1;
+        WritePacketInfo( pQueue, pRtpPacketInfo );
     }
 
     return result;
@@ -150,8 +508,7 @@ RtpPacketQueueResult_t RtpPacketQueue_Dequeue( RtpPacketQueue_t * pQueue,
 
     if( result == RTP_PACKET_QUEUE_RESULT_OK )
     {
-        pQueue->readIndex = INC_READ_INDEX( pQueue );
-        pQueue->packetCount -= 1;
+        RemoveOldestPacketInfo( pQueue );
     }
 
     return result;
@@ -186,6 +543,7 @@ RtpPacketQueueResult_t RtpPacketQueue_Peek( RtpPacketQueue_t * pQueue,
         pRtpPacketInfo->seqNum = pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].seqNum;
         pRtpPacketInfo->pSerializedRtpPacket = pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].pSerializedRtpPacket;
         pRtpPacketInfo->serializedPacketLength = pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].serializedPacketLength;
+        pRtpPacketInfo->insertionTime = pQueue->pRtpPacketInfoArray[ pQueue->readIndex ].insertionTime;
     }
 
     return result;
@@ -203,7 +561,7 @@ RtpPacketQueueResult_t RtpPacketQueue_Retrieve( RtpPacketQueue_t * pQueue,
                                                 uint16_t seqNum,
                                                 RtpPacketInfo_t * pRtpPacketInfo )
 {
-    size_t i, readIndex;
+    size_t index = 0;
     RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
 
     if( ( pQueue == NULL ) ||
@@ -222,23 +580,545 @@ RtpPacketQueueResult_t RtpPacketQueue_Retrieve( RtpPacketQueue_t * pQueue,
 
     if( result == RTP_PACKET_QUEUE_RESULT_OK )
     {
-        result = RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND;
+        result = FindPacketInfo( pQueue, seqNum, &( index ) );
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        pRtpPacketInfo->seqNum = pQueue->pRtpPacketInfoArray[ index ].seqNum;
+        pRtpPacketInfo->pSerializedRtpPacket = pQueue->pRtpPacketInfoArray[ index ].pSerializedRtpPacket;
+        pRtpPacketInfo->serializedPacketLength = pQueue->pRtpPacketInfoArray[ index ].serializedPacketLength;
+        pRtpPacketInfo->insertionTime = pQueue->pRtpPacketInfoArray[ index ].insertionTime;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Add up to rtpPacketInfosCount RTP packet infos into the queue.
+ *
+ * The packet infos are copied with at most two memcpy calls. Return
+ * RTP_PACKET_QUEUE_RESULT_FULL if the queue could not take all of them, in
+ * which case pEnqueuedCount holds the number of packet infos enqueued.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_EnqueueBatch( RtpPacketQueue_t * pQueue,
+                                                    const RtpPacketInfo_t * pRtpPacketInfos,
+                                                    size_t rtpPacketInfosCount,
+                                                    size_t * pEnqueuedCount )
+{
+    size_t i, count = 0;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pRtpPacketInfos == NULL ) ||
+        ( pEnqueuedCount == NULL ) ||
+        ( pQueue->pStorage != NULL ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        count = pQueue->rtpPacketInfoArrayLength - pQueue->packetCount;
+
+        if( rtpPacketInfosCount > count )
+        {
+            result = RTP_PACKET_QUEUE_RESULT_FULL;
+        }
+        else
+        {
+            count = rtpPacketInfosCount;
+        }
+
+        if( count > 0 )
+        {
+            UpdateDirectMapping( pQueue, pRtpPacketInfos, count );
+            CopyIntoQueue( pQueue, pQueue->writeIndex, pRtpPacketInfos, count );
+
+            pQueue->writeIndex = WrapIndex( pQueue, pQueue->writeIndex + count );
+            pQueue->packetCount += count;
+
+            for( i = 0; i < count; i++ )
+            {
+                pQueue->totalBytes += pRtpPacketInfos[ i ].serializedPacketLength;
+            }
+        }
+
+        *pEnqueuedCount = count;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Read and remove up to rtpPacketInfosLength oldest RTP packet infos
+ * from the queue.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_DequeueBatch( RtpPacketQueue_t * pQueue,
+                                                    RtpPacketInfo_t * pRtpPacketInfos,
+                                                    size_t rtpPacketInfosLength,
+                                                    size_t * pDequeuedCount )
+{
+    size_t i;
+    RtpPacketQueueResult_t result;
+
+    result = RtpPacketQueue_PeekBatch( pQueue,
+                                       pRtpPacketInfos,
+                                       rtpPacketInfosLength,
+                                       pDequeuedCount );
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        pQueue->readIndex = WrapIndex( pQueue, pQueue->readIndex + *pDequeuedCount );
+        pQueue->packetCount -= *pDequeuedCount;
+        pQueue->unmappedCount = ( pQueue->unmappedCount > *pDequeuedCount ) ?
+                                ( pQueue->unmappedCount - *pDequeuedCount ) : 0;
+
+        for( i = 0; i < *pDequeuedCount; i++ )
+        {
+            pQueue->totalBytes -= pRtpPacketInfos[ i ].serializedPacketLength;
+        }
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Read up to rtpPacketInfosLength oldest RTP packet infos from the
+ * queue without removing them.
+ *
+ * The packet infos are copied with at most two memcpy calls.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_PeekBatch( RtpPacketQueue_t * pQueue,
+                                                 RtpPacketInfo_t * pRtpPacketInfos,
+                                                 size_t rtpPacketInfosLength,
+                                                 size_t * pPeekedCount )
+{
+    size_t count;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pRtpPacketInfos == NULL ) ||
+        ( rtpPacketInfosLength == 0 ) ||
+        ( pPeekedCount == NULL ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        if( IS_QUEUE_EMPTY( pQueue ) )
+        {
+            *pPeekedCount = 0;
+            result = RTP_PACKET_QUEUE_RESULT_EMPTY;
+        }
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        count = ( rtpPacketInfosLength < pQueue->packetCount ) ? rtpPacketInfosLength :
+                                                                 pQueue->packetCount;
+
+        CopyFromQueue( pQueue, pQueue->readIndex, pRtpPacketInfos, count );
+
+        *pPeekedCount = count;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Set the limits enforced by RtpPacketQueue_Evict.
+ *
+ * A limit of 0 disables the corresponding check.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_SetLimits( RtpPacketQueue_t * pQueue,
+                                                 size_t maxBytes,
+                                                 uint64_t maxAge )
+{
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
 
-        for( i = 0; i < pQueue->packetCount; i++ )
+    if( pQueue == NULL )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        pQueue->maxBytes = maxBytes;
+        pQueue->maxAge = maxAge;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Remove the oldest RTP packet infos while the total serialized packet
+ * length exceeds maxBytes or the oldest packet info is older than maxAge.
+ *
+ * The removed packet infos are returned in pEvictedRtpPacketInfos so that the
+ * caller can release the serialized packets. If pEvictedCount is equal to
+ * evictedRtpPacketInfosLength, the caller should call this function again as
+ * more packet infos may need to be evicted. currentTime must be in the same
+ * unit as the insertionTime of the packet infos and maxAge.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_Evict( RtpPacketQueue_t * pQueue,
+                                             uint64_t currentTime,
+                                             RtpPacketInfo_t * pEvictedRtpPacketInfos,
+                                             size_t evictedRtpPacketInfosLength,
+                                             size_t * pEvictedCount )
+{
+    size_t count = 0;
+    uint8_t evict = 1;
+    const RtpPacketInfo_t * pOldest;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pEvictedRtpPacketInfos == NULL ) ||
+        ( pEvictedCount == NULL ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        while( ( evict != 0 ) &&
+               ( count < evictedRtpPacketInfosLength ) &&
+               ( !IS_QUEUE_EMPTY( pQueue ) ) )
         {
-            readIndex = WRAP( ( pQueue->readIndex + i ),
-                              pQueue->rtpPacketInfoArrayLength );
+            pOldest = &( pQueue->pRtpPacketInfoArray[ pQueue->readIndex ] );
 
-            if( pQueue->pRtpPacketInfoArray[ readIndex ].seqNum == seqNum )
+            if( ( ( pQueue->maxBytes != 0 ) &&
+                  ( pQueue->totalBytes > pQueue->maxBytes ) ) ||
+                ( ( pQueue->maxAge != 0 ) &&
+                  ( currentTime > pOldest->insertionTime ) &&
+                  ( ( currentTime - pOldest->insertionTime ) > pQueue->maxAge ) ) )
+            {
+                pEvictedRtpPacketInfos[ count ].seqNum = pOldest->seqNum;
+                pEvictedRtpPacketInfos[ count ].pSerializedRtpPacket = pOldest->pSerializedRtpPacket;
+                pEvictedRtpPacketInfos[ count ].serializedPacketLength = pOldest->serializedPacketLength;
+                pEvictedRtpPacketInfos[ count ].insertionTime = pOldest->insertionTime;
+
+                RemoveOldestPacketInfo( pQueue );
+                count++;
+            }
+            else
             {
-                pRtpPacketInfo->seqNum = pQueue->pRtpPacketInfoArray[ readIndex ].seqNum;
-                pRtpPacketInfo->pSerializedRtpPacket = pQueue->pRtpPacketInfoArray[ readIndex ].pSerializedRtpPacket;
-                pRtpPacketInfo->serializedPacketLength = pQueue->pRtpPacketInfoArray[ readIndex ].serializedPacketLength;
+                evict = 0;
+            }
+        }
+
+        *pEvictedCount = count;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Read the RTP packet infos requested by an RTCP generic NACK, without
+ * removing them from the queue.
+ *
+ * The requested sequence numbers are pid and, for every bit i set in blp,
+ * pid + i + 1. All of them are resolved in a single pass over the queue (or
+ * with one indexed load each in a direct mapped queue, scanning only the
+ * packets enqueued before the last sequence number gap) and returned in
+ * sequence number order. pMissingMask reports the requested packets that
+ * are not in the queue - bit 0 for pid and bit i + 1 for bit i of blp.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_RetrieveMask( RtpPacketQueue_t * pQueue,
+                                                    uint16_t pid,
+                                                    uint16_t blp,
+                                                    RtpPacketInfo_t * pRtpPacketInfos,
+                                                    size_t rtpPacketInfosLength,
+                                                    size_t * pRetrievedCount,
+                                                    uint32_t * pMissingMask )
+{
+    size_t i, index, scanCount, count = 0, requestedCount = 0;
+    size_t indices[ RTP_PACKET_QUEUE_NACK_MAX_PACKETS ];
+    uint16_t delta;
+    uint32_t requestedMask, foundMask = 0;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    requestedMask = 1U | ( ( uint32_t ) blp << 1 );
+
+    for( i = 0; i < RTP_PACKET_QUEUE_NACK_MAX_PACKETS; i++ )
+    {
+        requestedCount += ( requestedMask >> i ) & 1U;
+    }
 
-                result = RTP_PACKET_QUEUE_RESULT_OK;
-                break;
+    if( ( pQueue == NULL ) ||
+        ( pRtpPacketInfos == NULL ) ||
+        ( rtpPacketInfosLength < requestedCount ) ||
+        ( pRetrievedCount == NULL ) ||
+        ( pMissingMask == NULL ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        if( IS_QUEUE_EMPTY( pQueue ) )
+        {
+            *pRetrievedCount = 0;
+            *pMissingMask = requestedMask;
+            result = RTP_PACKET_QUEUE_RESULT_EMPTY;
+        }
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        scanCount = pQueue->packetCount;
+
+        if( pQueue->isDirectMapped != 0 )
+        {
+            for( i = 0; i < RTP_PACKET_QUEUE_NACK_MAX_PACKETS; i++ )
+            {
+                if( ( ( ( requestedMask >> i ) & 1U ) != 0 ) &&
+                    ( FindMappedPacketInfo( pQueue, ( uint16_t ) ( pid + i ), &( index ) ) != 0U ) )
+                {
+                    indices[ i ] = index;
+                    foundMask |= ( 1U << i );
+                }
             }
+
+            scanCount = pQueue->unmappedCount;
         }
+
+        for( i = 0; ( i < scanCount ) && ( foundMask != requestedMask ); i++ )
+        {
+            index = WrapIndex( pQueue, pQueue->readIndex + i );
+            delta = ( uint16_t ) ( pQueue->pRtpPacketInfoArray[ index ].seqNum - pid );
+
+            if( ( delta < RTP_PACKET_QUEUE_NACK_MAX_PACKETS ) &&
+                ( ( ( ( requestedMask & ~foundMask ) >> delta ) & 1U ) != 0 ) )
+            {
+                indices[ delta ] = index;
+                foundMask |= ( 1U << delta );
+            }
+        }
+
+        for( i = 0; i < RTP_PACKET_QUEUE_NACK_MAX_PACKETS; i++ )
+        {
+            if( ( ( foundMask >> i ) & 1U ) != 0 )
+            {
+                index = indices[ i ];
+                pRtpPacketInfos[ count ].seqNum = pQueue->pRtpPacketInfoArray[ index ].seqNum;
+                pRtpPacketInfos[ count ].pSerializedRtpPacket = pQueue->pRtpPacketInfoArray[ index ].pSerializedRtpPacket;
+                pRtpPacketInfos[ count ].serializedPacketLength = pQueue->pRtpPacketInfoArray[ index ].serializedPacketLength;
+                pRtpPacketInfos[ count ].insertionTime = pQueue->pRtpPacketInfoArray[ index ].insertionTime;
+                count++;
+            }
+        }
+
+        *pRetrievedCount = count;
+        *pMissingMask = requestedMask & ~foundMask;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Give the queue a byte storage to keep the serialized packets in.
+ *
+ * Once set, packets must be added with RtpPacketQueue_EnqueueCopy or
+ * RtpPacketQueue_Reserve/RtpPacketQueue_Commit - RtpPacketQueue_Enqueue,
+ * RtpPacketQueue_ForceEnqueue and RtpPacketQueue_EnqueueBatch return
+ * RTP_PACKET_QUEUE_RESULT_BAD_PARAM. The space of the serialized
+ * packets is reclaimed in FIFO order, so the serialized packet of a packet
+ * info removed from the queue is only valid until the next packet is added.
+ * The queue must be empty.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_SetStorage( RtpPacketQueue_t * pQueue,
+                                                  uint8_t * pStorage,
+                                                  size_t storageLength )
+{
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pStorage == NULL ) ||
+        ( storageLength == 0 ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        if( !IS_QUEUE_EMPTY( pQueue ) )
+        {
+            result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        pQueue->pStorage = pStorage;
+        pQueue->storageLength = storageLength;
+        pQueue->storageWriteOffset = 0;
+        pQueue->pReservedBuffer = NULL;
+        pQueue->reservedLength = 0;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Reserve length contiguous bytes in the storage for the next packet,
+ * so that it can be serialized in place.
+ *
+ * The oldest packet infos are removed until both a packet info slot and the
+ * bytes are available, in which case RTP_PACKET_QUEUE_RESULT_PACKET_DELETED
+ * is returned. The packet is added by RtpPacketQueue_Commit, and no other
+ * packet must be added in between.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_Reserve( RtpPacketQueue_t * pQueue,
+                                               size_t length,
+                                               uint8_t ** ppBuffer )
+{
+    uint8_t * pBuffer = NULL;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pQueue->pStorage == NULL ) ||
+        ( length == 0 ) ||
+        ( ppBuffer == NULL ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        if( length > pQueue->storageLength )
+        {
+            result = RTP_PACKET_QUEUE_RESULT_FULL;
+        }
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        if( IS_QUEUE_FULL( pQueue ) )
+        {
+            RemoveOldestPacketInfo( pQueue );
+            result = RTP_PACKET_QUEUE_RESULT_PACKET_DELETED;
+        }
+
+        pBuffer = AllocateStorage( pQueue, length );
+
+        while( pBuffer == NULL )
+        {
+            RemoveOldestPacketInfo( pQueue );
+            result = RTP_PACKET_QUEUE_RESULT_PACKET_DELETED;
+
+            pBuffer = AllocateStorage( pQueue, length );
+        }
+
+        pQueue->pReservedBuffer = pBuffer;
+        pQueue->reservedLength = length;
+        *ppBuffer = pBuffer;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Add the packet serialized in the buffer returned by the last
+ * RtpPacketQueue_Reserve call.
+ *
+ * serializedPacketLength can be smaller than the reserved length, in which
+ * case the remaining bytes are given back to the storage.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_Commit( RtpPacketQueue_t * pQueue,
+                                              uint16_t seqNum,
+                                              size_t serializedPacketLength,
+                                              uint64_t insertionTime )
+{
+    RtpPacketInfo_t rtpPacketInfo;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pQueue->pReservedBuffer == NULL ) ||
+        ( serializedPacketLength == 0 ) ||
+        ( serializedPacketLength > pQueue->reservedLength ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        rtpPacketInfo.seqNum = seqNum;
+        rtpPacketInfo.pSerializedRtpPacket = pQueue->pReservedBuffer;
+        rtpPacketInfo.serializedPacketLength = serializedPacketLength;
+        rtpPacketInfo.insertionTime = insertionTime;
+
+        WritePacketInfo( pQueue, &( rtpPacketInfo ) );
+
+        pQueue->storageWriteOffset = ( size_t ) ( pQueue->pReservedBuffer - pQueue->pStorage ) +
+                                     serializedPacketLength;
+        pQueue->pReservedBuffer = NULL;
+        pQueue->reservedLength = 0;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Copy a serialized packet into the storage and add it to the queue.
+ *
+ * The queued packet info points into the storage, not at
+ * pSerializedRtpPacket, which can be reused as soon as this returns. Use
+ * RtpPacketQueue_Retrieve with seqNum to get the stored copy. Return
+ * RTP_PACKET_QUEUE_RESULT_PACKET_DELETED if older packet infos were removed
+ * to make room.
+ */
+RtpPacketQueueResult_t RtpPacketQueue_EnqueueCopy( RtpPacketQueue_t * pQueue,
+                                                   uint16_t seqNum,
+                                                   const uint8_t * pSerializedRtpPacket,
+                                                   size_t serializedPacketLength,
+                                                   uint64_t insertionTime )
+{
+    uint8_t * pBuffer = NULL;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( pSerializedRtpPacket == NULL )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        result = RtpPacketQueue_Reserve( pQueue,
+                                         serializedPacketLength,
+                                         &( pBuffer ) );
+    }
+
+    if( ( result == RTP_PACKET_QUEUE_RESULT_OK ) ||
+        ( result == RTP_PACKET_QUEUE_RESULT_PACKET_DELETED ) )
+    {
+        memcpy( pBuffer, pSerializedRtpPacket, serializedPacketLength );
+
+        ( void ) RtpPacketQueue_Commit( pQueue,
+                                        seqNum,
+                                        serializedPacketLength,
+                                        insertionTime );
     }
 
     return result;
@@ -0,0 +1,279 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtp_playout_delay.h"
+
+/*-----------------------------------------------------------*/
+
+#if ( RTP_PLAYOUT_DELAY_BUCKET_COUNT > 256 )
+    #error "RTP_PLAYOUT_DELAY_BUCKET_COUNT must fit the uint8_t window entries."
+#endif
+
+#define RTP_TIMESTAMP_MOD           ( ( uint64_t ) 1U << 32 )
+#define RTP_TIMESTAMP_HALF          ( 1U << 31 )
+
+#define MS_PER_SECOND               1000U
+
+/*-----------------------------------------------------------*/
+
+static uint64_t GetExtendedRtpTimestamp( const RtpPlayoutDelay_t * pPlayoutDelay,
+                                         uint32_t rtpTimestamp );
+
+static int64_t RtpTimestampToMs( const RtpPlayoutDelay_t * pPlayoutDelay,
+                                 uint64_t extendedRtpTimestamp );
+
+static void AddToWindow( RtpPlayoutDelay_t * pPlayoutDelay,
+                         int64_t delayMs );
+
+/*-----------------------------------------------------------*/
+
+static uint64_t GetExtendedRtpTimestamp( const RtpPlayoutDelay_t * pPlayoutDelay,
+                                         uint32_t rtpTimestamp )
+{
+    uint64_t extendedRtpTimestamp;
+    uint32_t delta = rtpTimestamp - pPlayoutDelay->lastRtpTimestamp;
+
+    if( delta < RTP_TIMESTAMP_HALF )
+    {
+        extendedRtpTimestamp = pPlayoutDelay->extendedRtpTimestamp + delta;
+    }
+    else
+    {
+        extendedRtpTimestamp = pPlayoutDelay->extendedRtpTimestamp - ( RTP_TIMESTAMP_MOD - delta );
+    }
+
+    return extendedRtpTimestamp;
+}
+
+/*-----------------------------------------------------------*/
+
+static int64_t RtpTimestampToMs( const RtpPlayoutDelay_t * pPlayoutDelay,
+                                 uint64_t extendedRtpTimestamp )
+{
+    return ( int64_t ) ( ( extendedRtpTimestamp * MS_PER_SECOND ) / pPlayoutDelay->clockRate );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Replaces the oldest delay of the window, keeping the histogram in sync. */
+static void AddToWindow( RtpPlayoutDelay_t * pPlayoutDelay,
+                         int64_t delayMs )
+{
+    uint8_t bucket;
+
+    bucket = ( delayMs >= ( ( int64_t ) RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS * RTP_PLAYOUT_DELAY_BUCKET_COUNT ) ) ?
+             ( uint8_t ) ( RTP_PLAYOUT_DELAY_BUCKET_COUNT - 1 ) :
+             ( uint8_t ) ( delayMs / RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS );
+
+    if( pPlayoutDelay->windowCount == pPlayoutDelay->windowLength )
+    {
+        pPlayoutDelay->histogram[ pPlayoutDelay->pWindow[ pPlayoutDelay->windowIndex ] ] -= 1;
+    }
+    else
+    {
+        pPlayoutDelay->windowCount += 1;
+    }
+
+    pPlayoutDelay->pWindow[ pPlayoutDelay->windowIndex ] = bucket;
+    pPlayoutDelay->histogram[ bucket ] += 1;
+
+    pPlayoutDelay->windowIndex += 1;
+
+    if( pPlayoutDelay->windowIndex == pPlayoutDelay->windowLength )
+    {
+        pPlayoutDelay->windowIndex = 0;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+RtpPlayoutDelayResult_t RtpPlayoutDelay_Init( RtpPlayoutDelay_t * pPlayoutDelay,
+                                              uint8_t * pWindow,
+                                              size_t windowLength,
+                                              uint32_t clockRate,
+                                              uint8_t percentile,
+                                              uint32_t minDelayMs,
+                                              uint32_t maxDelayMs )
+{
+    RtpPlayoutDelayResult_t result = RTP_PLAYOUT_DELAY_RESULT_OK;
+
+    if( ( pPlayoutDelay == NULL ) ||
+        ( pWindow == NULL ) ||
+        ( windowLength == 0 ) ||
+        ( windowLength > UINT16_MAX ) ||
+        ( clockRate == 0 ) ||
+        ( percentile == 0 ) ||
+        ( percentile > 100 ) ||
+        ( minDelayMs > maxDelayMs ) )
+    {
+        result = RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PLAYOUT_DELAY_RESULT_OK )
+    {
+        memset( pPlayoutDelay, 0, sizeof( RtpPlayoutDelay_t ) );
+
+        pPlayoutDelay->pWindow = pWindow;
+        pPlayoutDelay->windowLength = windowLength;
+        pPlayoutDelay->clockRate = clockRate;
+        pPlayoutDelay->percentile = percentile;
+        pPlayoutDelay->minDelayMs = minDelayMs;
+        pPlayoutDelay->maxDelayMs = maxDelayMs;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpPlayoutDelayResult_t RtpPlayoutDelay_Update( RtpPlayoutDelay_t * pPlayoutDelay,
+                                                uint32_t rtpTimestamp,
+                                                uint64_t arrivalTimeMs )
+{
+    int64_t transitMs, delta;
+    RtpPlayoutDelayResult_t result = RTP_PLAYOUT_DELAY_RESULT_OK;
+
+    if( pPlayoutDelay == NULL )
+    {
+        result = RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PLAYOUT_DELAY_RESULT_OK )
+    {
+        if( pPlayoutDelay->isStarted == 0 )
+        {
+            /* Start one cycle in so that a packet reordered back across the
+             * wrap does not take the extended timestamp below zero. */
+            pPlayoutDelay->extendedRtpTimestamp = RTP_TIMESTAMP_MOD + rtpTimestamp;
+        }
+        else
+        {
+            pPlayoutDelay->extendedRtpTimestamp = GetExtendedRtpTimestamp( pPlayoutDelay, rtpTimestamp );
+        }
+
+        pPlayoutDelay->lastRtpTimestamp = rtpTimestamp;
+        transitMs = ( int64_t ) arrivalTimeMs - RtpTimestampToMs( pPlayoutDelay, pPlayoutDelay->extendedRtpTimestamp );
+
+        if( pPlayoutDelay->isStarted == 0 )
+        {
+            pPlayoutDelay->previousTransitMs = transitMs;
+            pPlayoutDelay->baseTransitMs = transitMs;
+            pPlayoutDelay->windowMinTransitMs = transitMs;
+            pPlayoutDelay->isStarted = 1;
+        }
+
+        /* RFC 3550, section 6.4.1. */
+        delta = transitMs - pPlayoutDelay->previousTransitMs;
+        delta = ( delta < 0 ) ? -delta : delta;
+        pPlayoutDelay->jitter += ( uint32_t ) delta - ( ( pPlayoutDelay->jitter + 8 ) >> 4 );
+        pPlayoutDelay->previousTransitMs = transitMs;
+
+        /* The zero delay reference is the minimum transit time. It is
+         * re-estimated every window so that it follows the clock drift. */
+        if( transitMs < pPlayoutDelay->windowMinTransitMs )
+        {
+            pPlayoutDelay->windowMinTransitMs = transitMs;
+        }
+
+        if( transitMs < pPlayoutDelay->baseTransitMs )
+        {
+            pPlayoutDelay->baseTransitMs = transitMs;
+        }
+
+        pPlayoutDelay->windowMinCount += 1;
+
+        if( pPlayoutDelay->windowMinCount == pPlayoutDelay->windowLength )
+        {
+            pPlayoutDelay->baseTransitMs = pPlayoutDelay->windowMinTransitMs;
+            pPlayoutDelay->windowMinTransitMs = INT64_MAX;
+            pPlayoutDelay->windowMinCount = 0;
+        }
+
+        AddToWindow( pPlayoutDelay, transitMs - pPlayoutDelay->baseTransitMs );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* The jitter term reacts within a few packets to the start of a burst, while
+ * the percentile keeps the delay up for the length of the window. */
+RtpPlayoutDelayResult_t RtpPlayoutDelay_GetTargetDelay( const RtpPlayoutDelay_t * pPlayoutDelay,
+                                                        uint32_t * pTargetDelayMs )
+{
+    size_t i, threshold, cumulativeCount = 0;
+    uint32_t targetDelayMs = 0, jitterDelayMs;
+    RtpPlayoutDelayResult_t result = RTP_PLAYOUT_DELAY_RESULT_OK;
+
+    if( ( pPlayoutDelay == NULL ) ||
+        ( pTargetDelayMs == NULL ) )
+    {
+        result = RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PLAYOUT_DELAY_RESULT_OK )
+    {
+        if( pPlayoutDelay->isStarted == 0 )
+        {
+            result = RTP_PLAYOUT_DELAY_RESULT_NO_DATA;
+        }
+    }
+
+    if( result == RTP_PLAYOUT_DELAY_RESULT_OK )
+    {
+        threshold = ( ( pPlayoutDelay->windowCount * pPlayoutDelay->percentile ) + 99U ) / 100U;
+
+        for( i = 0; cumulativeCount < threshold; i++ )
+        {
+            cumulativeCount += pPlayoutDelay->histogram[ i ];
+            targetDelayMs = ( uint32_t ) ( i + 1U ) * RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS;
+        }
+
+        jitterDelayMs = ( pPlayoutDelay->jitter >> 4 ) * RTP_PLAYOUT_DELAY_JITTER_FACTOR;
+
+        targetDelayMs = ( jitterDelayMs > targetDelayMs ) ? jitterDelayMs : targetDelayMs;
+        targetDelayMs = ( targetDelayMs < pPlayoutDelay->minDelayMs ) ? pPlayoutDelay->minDelayMs : targetDelayMs;
+        targetDelayMs = ( targetDelayMs > pPlayoutDelay->maxDelayMs ) ? pPlayoutDelay->maxDelayMs : targetDelayMs;
+
+        *pTargetDelayMs = targetDelayMs;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpPlayoutDelayResult_t RtpPlayoutDelay_GetReleaseTime( const RtpPlayoutDelay_t * pPlayoutDelay,
+                                                        uint32_t rtpTimestamp,
+                                                        uint64_t * pReleaseTimeMs )
+{
+    int64_t releaseTimeMs;
+    uint32_t targetDelayMs = 0;
+    RtpPlayoutDelayResult_t result;
+
+    if( pReleaseTimeMs == NULL )
+    {
+        result = RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM;
+    }
+    else
+    {
+        result = RtpPlayoutDelay_GetTargetDelay( pPlayoutDelay, &( targetDelayMs ) );
+    }
+
+    if( result == RTP_PLAYOUT_DELAY_RESULT_OK )
+    {
+        /* Arrival time of the frame over the fastest path, plus the target delay. */
+        releaseTimeMs = RtpTimestampToMs( pPlayoutDelay,
+                                          GetExtendedRtpTimestamp( pPlayoutDelay, rtpTimestamp ) ) +
+                        pPlayoutDelay->baseTransitMs +
+                        ( int64_t ) targetDelayMs;
+
+        *pReleaseTimeMs = ( releaseTimeMs > 0 ) ? ( uint64_t ) releaseTimeMs : 0U;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,287 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtp_receive_stats.h"
+
+/*-----------------------------------------------------------*/
+
+#define RTP_SEQUENCE_NUMBER_MOD         ( 1U << 16 )
+
+#define RTP_CUMULATIVE_LOST_MAX         0x7FFFFF
+#define RTP_CUMULATIVE_LOST_MIN         ( -0x800000 )
+
+/*-----------------------------------------------------------*/
+
+static void InitSequence( RtpReceiveStats_t * pStats,
+                          uint16_t sequenceNumber );
+
+static RtpReceiveStatsResult_t UpdateSequence( RtpReceiveStats_t * pStats,
+                                               uint16_t sequenceNumber );
+
+static void UpdateJitter( RtpReceiveStats_t * pStats,
+                          uint32_t rtpTimestamp,
+                          uint32_t arrivalTime );
+
+/*-----------------------------------------------------------*/
+
+static void InitSequence( RtpReceiveStats_t * pStats,
+                          uint16_t sequenceNumber )
+{
+    pStats->baseSequenceNumber = sequenceNumber;
+    pStats->maxSequenceNumber = sequenceNumber;
+    pStats->badSequenceNumber = RTP_SEQUENCE_NUMBER_MOD + 1; /* So seq == bad_seq is false. */
+    pStats->cycles = 0;
+    pStats->received = 0;
+    pStats->receivedPrior = 0;
+    pStats->expectedPrior = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+/* RFC 3550, Appendix A.1. */
+static RtpReceiveStatsResult_t UpdateSequence( RtpReceiveStats_t * pStats,
+                                               uint16_t sequenceNumber )
+{
+    RtpReceiveStatsResult_t result = RTP_RECEIVE_STATS_RESULT_OK;
+    uint16_t delta = ( uint16_t ) ( sequenceNumber - pStats->maxSequenceNumber );
+
+    if( pStats->probation > 0 )
+    {
+        /* Packet is in sequence. */
+        if( sequenceNumber == ( uint16_t ) ( pStats->maxSequenceNumber + 1 ) )
+        {
+            pStats->probation -= 1;
+            pStats->maxSequenceNumber = sequenceNumber;
+
+            if( pStats->probation == 0 )
+            {
+                InitSequence( pStats, sequenceNumber );
+            }
+            else
+            {
+                result = RTP_RECEIVE_STATS_RESULT_PROBATION;
+            }
+        }
+        else
+        {
+            pStats->probation = RTP_RECEIVE_STATS_MIN_SEQUENTIAL - 1;
+            pStats->maxSequenceNumber = sequenceNumber;
+            result = RTP_RECEIVE_STATS_RESULT_PROBATION;
+        }
+    }
+    else if( delta < RTP_RECEIVE_STATS_MAX_DROPOUT )
+    {
+        /* In order, with permissible gap. */
+        if( sequenceNumber < pStats->maxSequenceNumber )
+        {
+            /* Sequence number wrapped - count another 64K cycle. */
+            pStats->cycles += RTP_SEQUENCE_NUMBER_MOD;
+        }
+
+        pStats->maxSequenceNumber = sequenceNumber;
+    }
+    else if( delta <= ( RTP_SEQUENCE_NUMBER_MOD - RTP_RECEIVE_STATS_MAX_MISORDER ) )
+    {
+        /* The sequence number made a very large jump. */
+        if( sequenceNumber == pStats->badSequenceNumber )
+        {
+            /* Two sequential packets - assume that the other side restarted
+             * without telling us so just re-sync (i.e., pretend this was the
+             * first packet). */
+            InitSequence( pStats, sequenceNumber );
+        }
+        else
+        {
+            pStats->badSequenceNumber = ( sequenceNumber + 1 ) & ( RTP_SEQUENCE_NUMBER_MOD - 1 );
+            result = RTP_RECEIVE_STATS_RESULT_BAD_SEQUENCE;
+        }
+    }
+    else
+    {
+        /* Duplicate or reordered packet. */
+        pStats->reordered += 1;
+    }
+
+    if( result == RTP_RECEIVE_STATS_RESULT_OK )
+    {
+        pStats->received += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* RFC 3550, Appendix A.8, using the integer form with the jitter kept in Q4
+ * fixed point. */
+static void UpdateJitter( RtpReceiveStats_t * pStats,
+                          uint32_t rtpTimestamp,
+                          uint32_t arrivalTime )
+{
+    uint32_t transit, d;
+
+    transit = arrivalTime - rtpTimestamp;
+
+    if( pStats->isTransitValid != 0 )
+    {
+        d = transit - pStats->transit;
+
+        /* Absolute value of the 32-bit signed difference. */
+        if( ( d & 0x80000000U ) != 0 )
+        {
+            d = ( ~d ) + 1;
+        }
+
+        pStats->jitter += d - ( ( pStats->jitter + 8 ) >> 4 );
+    }
+
+    pStats->transit = transit;
+    pStats->isTransitValid = 1;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpReceiveStatsResult_t RtpReceiveStats_Init( RtpReceiveStats_t * pStats,
+                                              uint16_t sequenceNumber )
+{
+    RtpReceiveStatsResult_t result = RTP_RECEIVE_STATS_RESULT_OK;
+
+    if( pStats == NULL )
+    {
+        result = RTP_RECEIVE_STATS_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RECEIVE_STATS_RESULT_OK )
+    {
+        memset( pStats,
+                0,
+                sizeof( RtpReceiveStats_t ) );
+
+        InitSequence( pStats, sequenceNumber );
+        pStats->maxSequenceNumber = ( uint16_t ) ( sequenceNumber - 1 );
+        pStats->probation = RTP_RECEIVE_STATS_MIN_SEQUENTIAL;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpReceiveStatsResult_t RtpReceiveStats_Update( RtpReceiveStats_t * pStats,
+                                                uint16_t sequenceNumber,
+                                                uint32_t rtpTimestamp,
+                                                uint32_t arrivalTime )
+{
+    RtpReceiveStatsResult_t result = RTP_RECEIVE_STATS_RESULT_OK;
+
+    if( pStats == NULL )
+    {
+        result = RTP_RECEIVE_STATS_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RECEIVE_STATS_RESULT_OK )
+    {
+        result = UpdateSequence( pStats, sequenceNumber );
+    }
+
+    if( result == RTP_RECEIVE_STATS_RESULT_OK )
+    {
+        UpdateJitter( pStats, rtpTimestamp, arrivalTime );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpReceiveStatsResult_t RtpReceiveStats_GetExtendedSequenceNumber( const RtpReceiveStats_t * pStats,
+                                                                   uint16_t sequenceNumber,
+                                                                   uint32_t * pExtendedSequenceNumber )
+{
+    RtpReceiveStatsResult_t result = RTP_RECEIVE_STATS_RESULT_OK;
+    uint16_t delta;
+
+    if( ( pStats == NULL ) ||
+        ( pExtendedSequenceNumber == NULL ) )
+    {
+        result = RTP_RECEIVE_STATS_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RECEIVE_STATS_RESULT_OK )
+    {
+        delta = ( uint16_t ) ( sequenceNumber - pStats->maxSequenceNumber );
+        *pExtendedSequenceNumber = pStats->cycles + pStats->maxSequenceNumber;
+
+        /* Sequence numbers less than half the space behind the highest one are
+         * older packets, possibly from the previous cycle. */
+        if( delta < ( RTP_SEQUENCE_NUMBER_MOD / 2 ) )
+        {
+            *pExtendedSequenceNumber += delta;
+        }
+        else
+        {
+            *pExtendedSequenceNumber -= ( RTP_SEQUENCE_NUMBER_MOD - delta );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* RFC 3550, Appendix A.3. */
+RtpReceiveStatsResult_t RtpReceiveStats_GetReport( RtpReceiveStats_t * pStats,
+                                                   RtpReceiveStatsReport_t * pReport )
+{
+    RtpReceiveStatsResult_t result = RTP_RECEIVE_STATS_RESULT_OK;
+    uint32_t extendedMax, expected, expectedInterval, receivedInterval;
+    int64_t lost, lostInterval;
+
+    if( ( pStats == NULL ) ||
+        ( pReport == NULL ) )
+    {
+        result = RTP_RECEIVE_STATS_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RECEIVE_STATS_RESULT_OK )
+    {
+        extendedMax = pStats->cycles + pStats->maxSequenceNumber;
+        expected = extendedMax - pStats->baseSequenceNumber + 1;
+
+        lost = ( int64_t ) expected - ( int64_t ) pStats->received;
+
+        if( lost > RTP_CUMULATIVE_LOST_MAX )
+        {
+            lost = RTP_CUMULATIVE_LOST_MAX;
+        }
+        else if( lost < RTP_CUMULATIVE_LOST_MIN )
+        {
+            lost = RTP_CUMULATIVE_LOST_MIN;
+        }
+
+        expectedInterval = expected - pStats->expectedPrior;
+        pStats->expectedPrior = expected;
+        receivedInterval = pStats->received - pStats->receivedPrior;
+        pStats->receivedPrior = pStats->received;
+        lostInterval = ( int64_t ) expectedInterval - ( int64_t ) receivedInterval;
+
+        if( ( expectedInterval == 0 ) ||
+            ( lostInterval <= 0 ) )
+        {
+            pReport->fractionLost = 0;
+        }
+        else
+        {
+            pReport->fractionLost = ( uint8_t ) ( ( lostInterval << 8 ) / expectedInterval );
+        }
+
+        pReport->cumulativeLost = ( int32_t ) lost;
+        pReport->extendedHighestSequenceNumber = extendedMax;
+        pReport->jitter = pStats->jitter >> 4;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
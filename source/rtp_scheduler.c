@@ -0,0 +1,240 @@
+/* API includes. */
+#include "rtp_scheduler.h"
+
+/*-----------------------------------------------------------*/
+
+#if ( RTP_SCHEDULER_PRIORITY_LEVELS > 32 )
+    #error "RTP_SCHEDULER_PRIORITY_LEVELS must fit in the active mask."
+#endif
+
+/*-----------------------------------------------------------*/
+
+static void ActivateClass( RtpScheduler_t * pScheduler,
+                           RtpSchedulerClass_t * pClass );
+
+static void DeactivateHeadClass( RtpScheduler_t * pScheduler,
+                                 uint8_t priority );
+
+/*-----------------------------------------------------------*/
+
+static void ActivateClass( RtpScheduler_t * pScheduler,
+                           RtpSchedulerClass_t * pClass )
+{
+    RtpSchedulerClass_t * pTail = pScheduler->pActiveTails[ pClass->priority ];
+
+    if( pTail == NULL )
+    {
+        pClass->pNext = pClass;
+    }
+    else
+    {
+        pClass->pNext = pTail->pNext;
+        pTail->pNext = pClass;
+    }
+
+    pScheduler->pActiveTails[ pClass->priority ] = pClass;
+    pScheduler->activeMask |= ( 1U << pClass->priority );
+}
+
+/*-----------------------------------------------------------*/
+
+static void DeactivateHeadClass( RtpScheduler_t * pScheduler,
+                                 uint8_t priority )
+{
+    RtpSchedulerClass_t * pTail = pScheduler->pActiveTails[ priority ];
+    RtpSchedulerClass_t * pHead = pTail->pNext;
+
+    if( pHead == pTail )
+    {
+        pScheduler->pActiveTails[ priority ] = NULL;
+        pScheduler->activeMask &= ~( 1U << priority );
+    }
+    else
+    {
+        pTail->pNext = pHead->pNext;
+    }
+
+    pHead->pNext = NULL;
+    pHead->deficit = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpSchedulerResult_t RtpScheduler_Init( RtpScheduler_t * pScheduler,
+                                        size_t maxBytes )
+{
+    size_t i;
+    RtpSchedulerResult_t result = RTP_SCHEDULER_RESULT_OK;
+
+    if( pScheduler == NULL )
+    {
+        result = RTP_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_SCHEDULER_RESULT_OK )
+    {
+        for( i = 0; i < RTP_SCHEDULER_PRIORITY_LEVELS; i++ )
+        {
+            pScheduler->pActiveTails[ i ] = NULL;
+        }
+
+        pScheduler->activeMask = 0;
+        pScheduler->totalBytes = 0;
+        pScheduler->maxBytes = maxBytes;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpSchedulerResult_t RtpScheduler_InitClass( RtpSchedulerClass_t * pClass,
+                                             RtpPacketInfo_t * pRtpPacketInfoArray,
+                                             size_t rtpPacketInfoArrayLength,
+                                             uint8_t priority,
+                                             size_t quantum )
+{
+    RtpSchedulerResult_t result = RTP_SCHEDULER_RESULT_OK;
+
+    if( ( pClass == NULL ) ||
+        ( priority >= RTP_SCHEDULER_PRIORITY_LEVELS ) ||
+        ( quantum == 0 ) )
+    {
+        result = RTP_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_SCHEDULER_RESULT_OK )
+    {
+        if( RtpPacketQueue_Init( &( pClass->queue ),
+                                 pRtpPacketInfoArray,
+                                 rtpPacketInfoArrayLength ) != RTP_PACKET_QUEUE_RESULT_OK )
+        {
+            result = RTP_SCHEDULER_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == RTP_SCHEDULER_RESULT_OK )
+    {
+        pClass->priority = priority;
+        pClass->quantum = quantum;
+        pClass->deficit = 0;
+        pClass->pNext = NULL;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RtpSchedulerResult_t RtpScheduler_Enqueue( RtpScheduler_t * pScheduler,
+                                           RtpSchedulerClass_t * pClass,
+                                           const RtpPacketInfo_t * pRtpPacketInfo )
+{
+    RtpSchedulerResult_t result = RTP_SCHEDULER_RESULT_OK;
+
+    if( ( pScheduler == NULL ) ||
+        ( pClass == NULL ) ||
+        ( pRtpPacketInfo == NULL ) )
+    {
+        result = RTP_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_SCHEDULER_RESULT_OK )
+    {
+        if( ( pScheduler->maxBytes != 0 ) &&
+            ( pRtpPacketInfo->serializedPacketLength > ( pScheduler->maxBytes - pScheduler->totalBytes ) ) )
+        {
+            result = RTP_SCHEDULER_RESULT_FULL;
+        }
+    }
+
+    if( result == RTP_SCHEDULER_RESULT_OK )
+    {
+        if( RtpPacketQueue_Enqueue( &( pClass->queue ),
+                                    pRtpPacketInfo ) != RTP_PACKET_QUEUE_RESULT_OK )
+        {
+            result = RTP_SCHEDULER_RESULT_FULL;
+        }
+    }
+
+    if( result == RTP_SCHEDULER_RESULT_OK )
+    {
+        pScheduler->totalBytes += pRtpPacketInfo->serializedPacketLength;
+
+        if( pClass->queue.packetCount == 1 )
+        {
+            ActivateClass( pScheduler, pClass );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Serves the highest priority with queued packets, and the classes of that
+ * priority with deficit round robin. */
+RtpSchedulerResult_t RtpScheduler_Dequeue( RtpScheduler_t * pScheduler,
+                                           RtpPacketInfo_t * pRtpPacketInfo )
+{
+    uint8_t priority = 0, isDequeued = 0;
+    RtpSchedulerClass_t * pHead;
+    RtpSchedulerResult_t result = RTP_SCHEDULER_RESULT_OK;
+
+    if( ( pScheduler == NULL ) ||
+        ( pRtpPacketInfo == NULL ) )
+    {
+        result = RTP_SCHEDULER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_SCHEDULER_RESULT_OK )
+    {
+        if( pScheduler->activeMask == 0 )
+        {
+            result = RTP_SCHEDULER_RESULT_EMPTY;
+        }
+    }
+
+    if( result == RTP_SCHEDULER_RESULT_OK )
+    {
+        while( ( pScheduler->activeMask & ( 1U << priority ) ) == 0 )
+        {
+            priority++;
+        }
+
+        while( isDequeued == 0 )
+        {
+            pHead = pScheduler->pActiveTails[ priority ]->pNext;
+
+            /* An active class always has a packet to peek. */
+            ( void ) RtpPacketQueue_Peek( &( pHead->queue ),
+                                          pRtpPacketInfo );
+
+            if( pRtpPacketInfo->serializedPacketLength <= pHead->deficit )
+            {
+                ( void ) RtpPacketQueue_Dequeue( &( pHead->queue ),
+                                                 pRtpPacketInfo );
+                pHead->deficit -= pRtpPacketInfo->serializedPacketLength;
+                pScheduler->totalBytes -= pRtpPacketInfo->serializedPacketLength;
+
+                if( pHead->queue.packetCount == 0 )
+                {
+                    DeactivateHeadClass( pScheduler, priority );
+                }
+
+                isDequeued = 1;
+            }
+            else
+            {
+                /* Credit the quantum and move the class to the end of the
+                 * round. */
+                pHead->deficit += pHead->quantum;
+                pScheduler->pActiveTails[ priority ] = pHead;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,197 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtp_spsc_pkt_queue.h"
+
+/*----------------------------------------------------------------------------*/
+
+/*
+ * The producer publishes a packet info with a release store of the write
+ * index, and the consumer observes it with an acquire load (and vice versa
+ * for the read index). An index is only ever written by its owner, so the
+ * owner can read it with a relaxed load.
+ */
+#if defined( RTP_SPSC_PACKET_QUEUE_C11_ATOMICS )
+    #define LOAD_RELAXED( pIndex ) \
+    atomic_load_explicit( ( pIndex ), memory_order_relaxed )
+    #define LOAD_ACQUIRE( pIndex ) \
+    atomic_load_explicit( ( pIndex ), memory_order_acquire )
+    #define STORE_RELEASE( pIndex, value ) \
+    atomic_store_explicit( ( pIndex ), ( value ), memory_order_release )
+#elif defined( __GNUC__ )
+    #define LOAD_RELAXED( pIndex ) \
+    __atomic_load_n( ( pIndex ), __ATOMIC_RELAXED )
+    #define LOAD_ACQUIRE( pIndex ) \
+    __atomic_load_n( ( pIndex ), __ATOMIC_ACQUIRE )
+    #define STORE_RELEASE( pIndex, value ) \
+    __atomic_store_n( ( pIndex ), ( value ), __ATOMIC_RELEASE )
+#elif defined( _MSC_VER ) && ( defined( _M_IX86 ) || defined( _M_X64 ) )
+    /* Relies on volatile accesses having acquire/release semantics, which is
+     * the default /volatile:ms behavior of MSVC on x86 and x64 only. */
+    #define LOAD_RELAXED( pIndex ) \
+    ( *( ( volatile size_t * ) ( pIndex ) ) )
+    #define LOAD_ACQUIRE( pIndex ) \
+    ( *( ( volatile size_t * ) ( pIndex ) ) )
+    #define STORE_RELEASE( pIndex, value ) \
+    ( *( ( volatile size_t * ) ( pIndex ) ) = ( value ) )
+#else
+    #error "No atomic operations for this compiler - define RTP_SPSC_PACKET_QUEUE_C11_ATOMICS."
+#endif
+
+/*----------------------------------------------------------------------------*/
+
+RtpPacketQueueResult_t RtpSpscPacketQueue_Init( RtpSpscPacketQueue_t * pQueue,
+                                                RtpPacketInfo_t * pRtpPacketInfoArray,
+                                                size_t rtpPacketInfoArrayLength )
+{
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pRtpPacketInfoArray == NULL ) ||
+        ( rtpPacketInfoArrayLength < 2 ) ||
+        ( ( rtpPacketInfoArrayLength & ( rtpPacketInfoArrayLength - 1 ) ) != 0 ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        memset( pQueue, 0, sizeof( RtpSpscPacketQueue_t ) );
+        memset( pRtpPacketInfoArray,
+                0,
+                sizeof( RtpPacketInfo_t ) * rtpPacketInfoArrayLength );
+
+        pQueue->pRtpPacketInfoArray = pRtpPacketInfoArray;
+        pQueue->indexMask = rtpPacketInfoArrayLength - 1;
+        STORE_RELEASE( &( pQueue->writeIndex ), 0 );
+        STORE_RELEASE( &( pQueue->readIndex ), 0 );
+        pQueue->cachedReadIndex = 0;
+        pQueue->cachedWriteIndex = 0;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Add an RTP packet info into the specified queue.
+ *
+ * Must only be called from the producer thread. The read index is only
+ * re-loaded from the consumer when the queue looks full with the cached one.
+ */
+RtpPacketQueueResult_t RtpSpscPacketQueue_Enqueue( RtpSpscPacketQueue_t * pQueue,
+                                                   const RtpPacketInfo_t * pRtpPacketInfo )
+{
+    size_t writeIndex;
+    RtpPacketInfo_t * pSlot;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pRtpPacketInfo == NULL ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        writeIndex = LOAD_RELAXED( &( pQueue->writeIndex ) );
+
+        if( ( writeIndex - pQueue->cachedReadIndex ) > pQueue->indexMask )
+        {
+            pQueue->cachedReadIndex = LOAD_ACQUIRE( &( pQueue->readIndex ) );
+
+            if( ( writeIndex - pQueue->cachedReadIndex ) > pQueue->indexMask )
+            {
+                result = RTP_PACKET_QUEUE_RESULT_FULL;
+            }
+        }
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        pSlot = &( pQueue->pRtpPacketInfoArray[ writeIndex & pQueue->indexMask ] );
+        pSlot->seqNum = pRtpPacketInfo->seqNum;
+        pSlot->pSerializedRtpPacket = pRtpPacketInfo->pSerializedRtpPacket;
+        pSlot->serializedPacketLength = pRtpPacketInfo->serializedPacketLength;
+        pSlot->insertionTime = pRtpPacketInfo->insertionTime;
+
+        STORE_RELEASE( &( pQueue->writeIndex ), writeIndex + 1 );
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Read and remove the oldest RTP packet info from the queue.
+ *
+ * Must only be called from the consumer thread.
+ */
+RtpPacketQueueResult_t RtpSpscPacketQueue_Dequeue( RtpSpscPacketQueue_t * pQueue,
+                                                   RtpPacketInfo_t * pRtpPacketInfo )
+{
+    RtpPacketQueueResult_t result;
+
+    result = RtpSpscPacketQueue_Peek( pQueue, pRtpPacketInfo );
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        STORE_RELEASE( &( pQueue->readIndex ),
+                       LOAD_RELAXED( &( pQueue->readIndex ) ) + 1 );
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Read the oldest RTP packet info from the queue without removing it.
+ *
+ * Must only be called from the consumer thread. The write index is only
+ * re-loaded from the producer when the queue looks empty with the cached one.
+ */
+RtpPacketQueueResult_t RtpSpscPacketQueue_Peek( RtpSpscPacketQueue_t * pQueue,
+                                                RtpPacketInfo_t * pRtpPacketInfo )
+{
+    size_t readIndex;
+    const RtpPacketInfo_t * pSlot;
+    RtpPacketQueueResult_t result = RTP_PACKET_QUEUE_RESULT_OK;
+
+    if( ( pQueue == NULL ) ||
+        ( pRtpPacketInfo == NULL ) )
+    {
+        result = RTP_PACKET_QUEUE_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        readIndex = LOAD_RELAXED( &( pQueue->readIndex ) );
+
+        if( readIndex == pQueue->cachedWriteIndex )
+        {
+            pQueue->cachedWriteIndex = LOAD_ACQUIRE( &( pQueue->writeIndex ) );
+
+            if( readIndex == pQueue->cachedWriteIndex )
+            {
+                result = RTP_PACKET_QUEUE_RESULT_EMPTY;
+            }
+        }
+    }
+
+    if( result == RTP_PACKET_QUEUE_RESULT_OK )
+    {
+        pSlot = &( pQueue->pRtpPacketInfoArray[ readIndex & pQueue->indexMask ] );
+        pRtpPacketInfo->seqNum = pSlot->seqNum;
+        pRtpPacketInfo->pSerializedRtpPacket = pSlot->pSerializedRtpPacket;
+        pRtpPacketInfo->serializedPacketLength = pSlot->serializedPacketLength;
+        pRtpPacketInfo->insertionTime = pSlot->insertionTime;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,197 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "annexb_scanner.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define SCAN_BUFFER_LENGTH    256
+
+uint8_t scanBuffer[ SCAN_BUFFER_LENGTH ];
+uint32_t randomState;
+
+void setUp( void )
+{
+    memset( &( scanBuffer[ 0 ] ),
+            0xAA,
+            sizeof( scanBuffer ) );
+    randomState = 0x12345678;
+}
+
+void tearDown( void )
+{
+}
+
+/*-----------------------------------------------------------*/
+
+/* Small deterministic generator so that failures are reproducible. */
+static uint32_t NextRandom( void )
+{
+    randomState = ( randomState * 1103515245U ) + 12345U;
+
+    return randomState >> 16;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Byte by byte reference scan, checking the 4-byte start code first. */
+static size_t ReferenceFindStartCode( const uint8_t * pBuffer,
+                                      size_t bufferLength,
+                                      size_t * pStartCodeLength )
+{
+    const uint8_t startCode1[] = { 0x00, 0x00, 0x00, 0x01 };
+    const uint8_t startCode2[] = { 0x00, 0x00, 0x01 };
+    size_t index = 0, startCodeIndex = bufferLength;
+
+    *pStartCodeLength = 0;
+
+    while( ( startCodeIndex == bufferLength ) && ( index < bufferLength ) )
+    {
+        if( ( bufferLength - index >= sizeof( startCode1 ) ) &&
+            ( memcmp( &( pBuffer[ index ] ), &( startCode1[ 0 ] ), sizeof( startCode1 ) ) == 0 ) )
+        {
+            startCodeIndex = index;
+            *pStartCodeLength = sizeof( startCode1 );
+        }
+        else if( ( bufferLength - index >= sizeof( startCode2 ) ) &&
+                 ( memcmp( &( pBuffer[ index ] ), &( startCode2[ 0 ] ), sizeof( startCode2 ) ) == 0 ) )
+        {
+            startCodeIndex = index;
+            *pStartCodeLength = sizeof( startCode2 );
+        }
+        else
+        {
+            index++;
+        }
+    }
+
+    return startCodeIndex;
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate start code detection for both start code lengths.
+ */
+void test_AnnexB_FindStartCode( void )
+{
+    size_t startCodeLength = 0;
+
+    /* 4-byte start code at the beginning. */
+    scanBuffer[ 0 ] = 0x00;
+    scanBuffer[ 1 ] = 0x00;
+    scanBuffer[ 2 ] = 0x00;
+    scanBuffer[ 3 ] = 0x01;
+    TEST_ASSERT_EQUAL( 0,
+                       AnnexB_FindStartCode( &( scanBuffer[ 0 ] ), SCAN_BUFFER_LENGTH, &( startCodeLength ) ) );
+    TEST_ASSERT_EQUAL( 4,
+                       startCodeLength );
+
+    /* 3-byte start code at the beginning. */
+    TEST_ASSERT_EQUAL( 0,
+                       AnnexB_FindStartCode( &( scanBuffer[ 1 ] ), SCAN_BUFFER_LENGTH - 1, &( startCodeLength ) ) );
+    TEST_ASSERT_EQUAL( 3,
+                       startCodeLength );
+
+    /* 3-byte start code past the first SIMD block. */
+    memset( &( scanBuffer[ 0 ] ),
+            0xAA,
+            4 );
+    scanBuffer[ 100 ] = 0x00;
+    scanBuffer[ 101 ] = 0x00;
+    scanBuffer[ 102 ] = 0x01;
+    TEST_ASSERT_EQUAL( 100,
+                       AnnexB_FindStartCode( &( scanBuffer[ 0 ] ), SCAN_BUFFER_LENGTH, &( startCodeLength ) ) );
+    TEST_ASSERT_EQUAL( 3,
+                       startCodeLength );
+
+    /* Preceding zero byte makes it a 4-byte start code. */
+    scanBuffer[ 99 ] = 0x00;
+    TEST_ASSERT_EQUAL( 99,
+                       AnnexB_FindStartCode( &( scanBuffer[ 0 ] ), SCAN_BUFFER_LENGTH, &( startCodeLength ) ) );
+    TEST_ASSERT_EQUAL( 4,
+                       startCodeLength );
+
+    /* Start code truncated by the buffer end. */
+    TEST_ASSERT_EQUAL( 102,
+                       AnnexB_FindStartCode( &( scanBuffer[ 0 ] ), 102, &( startCodeLength ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       startCodeLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that no start code is reported when there is none.
+ */
+void test_AnnexB_FindStartCode_NotFound( void )
+{
+    size_t startCodeLength = 5;
+
+    memset( &( scanBuffer[ 0 ] ),
+            0x00,
+            sizeof( scanBuffer ) );
+
+    TEST_ASSERT_EQUAL( SCAN_BUFFER_LENGTH,
+                       AnnexB_FindStartCode( &( scanBuffer[ 0 ] ), SCAN_BUFFER_LENGTH, &( startCodeLength ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       startCodeLength );
+
+    TEST_ASSERT_EQUAL( 2,
+                       AnnexB_FindStartCode( &( scanBuffer[ 0 ] ), 2, &( startCodeLength ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       AnnexB_FindStartCode( &( scanBuffer[ 0 ] ), 0, NULL ) );
+    TEST_ASSERT_EQUAL( 10,
+                       AnnexB_FindStartCode( NULL, 10, &( startCodeLength ) ) );
+    TEST_ASSERT_EQUAL( 0,
+                       startCodeLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the scanner against a byte by byte scan on random data
+ * with varying density of zero and one bytes.
+ */
+void test_AnnexB_FindStartCode_MatchesReference( void )
+{
+    size_t i, offset, length, index, expectedIndex, startCodeLength, expectedStartCodeLength;
+    uint32_t iteration;
+
+    for( iteration = 0; iteration < 16; iteration++ )
+    {
+        for( i = 0; i < SCAN_BUFFER_LENGTH; i++ )
+        {
+            /* Zero and one bytes get denser with every iteration. */
+            scanBuffer[ i ] = ( uint8_t ) ( NextRandom() % 64U );
+            scanBuffer[ i ] = ( scanBuffer[ i ] < ( iteration * 2U ) ) ? 0U :
+                              ( ( scanBuffer[ i ] < ( iteration * 3U ) ) ? 1U : 0x55U );
+        }
+
+        for( offset = 0; offset < 40; offset++ )
+        {
+            for( length = 0; length + offset <= SCAN_BUFFER_LENGTH; length += 7 )
+            {
+                expectedIndex = ReferenceFindStartCode( &( scanBuffer[ offset ] ),
+                                                        length,
+                                                        &( expectedStartCodeLength ) );
+                index = AnnexB_FindStartCode( &( scanBuffer[ offset ] ),
+                                              length,
+                                              &( startCodeLength ) );
+
+                TEST_ASSERT_EQUAL( expectedIndex,
+                                   index );
+                TEST_ASSERT_EQUAL( expectedStartCodeLength,
+                                   startCodeLength );
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
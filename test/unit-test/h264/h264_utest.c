@@ -2029,3 +2029,1341 @@ void test_H264_Depacketizer_GetFrame_OutOfMemory( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 packetization happy path with adding a length prefixed
+ * frame for all length sizes.
+ */
+void test_H264_Packetizer_AddFrameLengthPrefixed( void )
+{
+    uint8_t pFrame4[] =
+    {
+        0x00, 0x00, 0x00, 0x02, 0x09, 0x10,
+        0x00, 0x00, 0x00, 0x04, 0x68, 0xce, 0x3c, 0x80
+    };
+    uint8_t pFrame2[] =
+    {
+        0x00, 0x02, 0x09, 0x10,
+        0x00, 0x04, 0x68, 0xce, 0x3c, 0x80
+    };
+    uint8_t pFrame1[] =
+    {
+        0x02, 0x09, 0x10,
+        0x04, 0x68, 0xce, 0x3c, 0x80
+    };
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    Frame_t frame;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t pktBuffer[ MAX_H264_PACKET_LENGTH ];
+    uint8_t * pFrames[] = { pFrame1, pFrame2, pFrame4 };
+    size_t frameLengths[] = { sizeof( pFrame1 ), sizeof( pFrame2 ), sizeof( pFrame4 ) };
+    size_t naluLengthSizes[] = { 1, 2, 4 };
+    uint8_t expectedPacket[] =
+    {
+        0x78,                   /* STAP-A header: NRI=3. */
+        0x00, 0x02, 0x09, 0x10,
+        0x00, 0x04, 0x68, 0xce, 0x3c, 0x80
+    };
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    for( size_t i = 0; i < sizeof( naluLengthSizes ) / sizeof( size_t ); i++ )
+    {
+        frame.pFrameData = pFrames[ i ];
+        frame.frameDataLength = frameLengths[ i ];
+
+        result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                        &( frame ),
+                                                        naluLengthSizes[ i ] );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+
+        pkt.pPacketData = &( pktBuffer[ 0 ] );
+        pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+
+        result = H264Packetizer_GetPacket( &( ctx ),
+                                           &( pkt ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( sizeof( expectedPacket ),
+                           pkt.packetDataLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket[ 0 ] ),
+                                       pkt.pPacketData,
+                                       pkt.packetDataLength );
+
+        pkt.pPacketData = &( pktBuffer[ 0 ] );
+        pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+
+        result = H264Packetizer_GetPacket( &( ctx ),
+                                           &( pkt ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_PACKETS,
+                           result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 add length prefixed frame with malformed lengths.
+ */
+void test_H264_Packetizer_AddFrameLengthPrefixed_Malformed( void )
+{
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t frameData[] =
+    {
+        0x00, 0x03, 0x09, 0x10
+    };
+    Frame_t frame =
+    {
+        .pFrameData = &( frameData[ 0 ] ),
+        .frameDataLength = sizeof( frameData )
+    };
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* Length larger than the remaining frame. */
+    result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                    &( frame ),
+                                                    2 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_MALFORMED_PACKET,
+                       result );
+
+    /* Zero length. */
+    frameData[ 1 ] = 0x00;
+
+    result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                    &( frame ),
+                                                    2 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_MALFORMED_PACKET,
+                       result );
+
+    /* Truncated length field. */
+    result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                    &( frame ),
+                                                    4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_MALFORMED_PACKET,
+                       result );
+
+    frame.frameDataLength = 1;
+
+    result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                    &( frame ),
+                                                    2 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_MALFORMED_PACKET,
+                       result );
+
+    TEST_ASSERT_EQUAL( 0,
+                       ctx.naluCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264_Packetizer_AddFrameLengthPrefixed in case of bad
+ * parameters.
+ */
+void test_H264_Packetizer_AddFrameLengthPrefixed_BadParams( void )
+{
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    Frame_t frame;
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+
+    result = H264Packetizer_AddFrameLengthPrefixed( NULL,
+                                                    &( frame ),
+                                                    4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                    NULL,
+                                                    4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                    &( frame ),
+                                                    3 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    frame.pFrameData = NULL;
+
+    result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                    &( frame ),
+                                                    4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = 0;
+
+    result = H264Packetizer_AddFrameLengthPrefixed( &( ctx ),
+                                                    &( frame ),
+                                                    4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 depacketization into a length prefixed frame for all
+ * length sizes.
+ */
+void test_H264_Depacketizer_GetFrameLengthPrefixed( void )
+{
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    Frame_t frame;
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t packetData1[] = { 0x09, 0x10 };
+    uint8_t packetData2[] = { 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t expectedFrame4[] =
+    {
+        0x00, 0x00, 0x00, 0x02, 0x09, 0x10,
+        0x00, 0x00, 0x00, 0x04, 0x68, 0xce, 0x3c, 0x80
+    };
+    uint8_t expectedFrame2[] =
+    {
+        0x00, 0x02, 0x09, 0x10,
+        0x00, 0x04, 0x68, 0xce, 0x3c, 0x80
+    };
+    uint8_t expectedFrame1[] =
+    {
+        0x02, 0x09, 0x10,
+        0x04, 0x68, 0xce, 0x3c, 0x80
+    };
+    uint8_t * pExpectedFrames[] = { expectedFrame1, expectedFrame2, expectedFrame4 };
+    size_t expectedFrameLengths[] = { sizeof( expectedFrame1 ), sizeof( expectedFrame2 ), sizeof( expectedFrame4 ) };
+    size_t naluLengthSizes[] = { 1, 2, 4 };
+
+    result = H264Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    for( size_t i = 0; i < sizeof( naluLengthSizes ) / sizeof( size_t ); i++ )
+    {
+        pkt.pPacketData = &( packetData1[ 0 ] );
+        pkt.packetDataLength = sizeof( packetData1 );
+
+        result = H264Depacketizer_AddPacket( &( ctx ),
+                                             &( pkt ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+
+        pkt.pPacketData = &( packetData2[ 0 ] );
+        pkt.packetDataLength = sizeof( packetData2 );
+
+        result = H264Depacketizer_AddPacket( &( ctx ),
+                                             &( pkt ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = MAX_FRAME_LENGTH;
+
+        result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                          &( frame ),
+                                                          naluLengthSizes[ i ] );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( expectedFrameLengths[ i ],
+                           frame.frameDataLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( pExpectedFrames[ i ],
+                                       frame.pFrameData,
+                                       frame.frameDataLength );
+    }
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                      &( frame ),
+                                                      4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_FRAMES,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264_Depacketizer_GetFrameLengthPrefixed when a NALU is too
+ * long for the length field or the frame buffer is too small.
+ */
+void test_H264_Depacketizer_GetFrameLengthPrefixed_Unsupported_And_OutOfMemory( void )
+{
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    Frame_t frame;
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t packetData[ 300 ] = { 0x65 };
+    static uint8_t largePacketData[ UINT16_MAX + 1 ] = { 0x65 };
+    static uint8_t largeFrameBuffer[ UINT16_MAX + 3 ];
+
+    result = H264Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData );
+
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                      &( frame ),
+                                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_UNSUPPORTED_PACKET,
+                       result );
+
+    pkt.pPacketData = &( largePacketData[ 0 ] );
+    pkt.packetDataLength = sizeof( largePacketData );
+
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( largeFrameBuffer[ 0 ] );
+    frame.frameDataLength = sizeof( largeFrameBuffer );
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                      &( frame ),
+                                                      2 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_UNSUPPORTED_PACKET,
+                       result );
+
+    pkt.pPacketData = &( packetData[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData );
+
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = 4;
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                      &( frame ),
+                                                      4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OUT_OF_MEMORY,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264_Depacketizer_GetFrameLengthPrefixed in case of bad
+ * parameters.
+ */
+void test_H264_Depacketizer_GetFrameLengthPrefixed_BadParams( void )
+{
+    H264Result_t result;
+    H264DepacketizerContext_t ctx = { 0 };
+    Frame_t frame;
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( NULL,
+                                                      &( frame ),
+                                                      4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                      NULL,
+                                                      4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                      &( frame ),
+                                                      8 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    frame.pFrameData = NULL;
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                      &( frame ),
+                                                      4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = 0;
+
+    result = H264Depacketizer_GetFrameLengthPrefixed( &( ctx ),
+                                                      &( frame ),
+                                                      4 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that adding a frame in chunks of any size produces the same
+ * NALUs as adding the whole frame.
+ */
+void test_H264_Packetizer_AddChunk( void )
+{
+    uint8_t pFrame[] =
+    {
+        0x00, 0x00, 0x00, 0x01, 0x09, 0x10,
+        0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0xc0, 0x1f, 0xda,
+        0x01, 0x40, 0x16, 0xec, 0x05,
+        0xa8, 0x08,
+        0x00, 0x00, 0x01, 0x68, 0xce, 0x3c, 0x80,
+        0x00, 0x00, 0x00, 0x01, 0x06, 0x05, 0xff, 0xff, 0xb7,
+        0xdc, 0x45, 0xe9, 0xbd, 0xe6,
+        0xd9, 0x48,
+        0x00, 0x00, 0x01, 0x65, 0x00, 0x6e, 0x22, 0x21,
+        0x04, 0xbf, 0xff, 0xff, 0x0f,
+        0x45, 0x00
+    };
+    size_t frameLength = sizeof( pFrame );
+    H264PacketizerContext_t frameCtx = { 0 };
+    H264PacketizerContext_t chunkCtx = { 0 };
+    H264Result_t result;
+    Frame_t frame;
+    Frame_t chunk;
+    Nalu_t frameNalusArray[ MAX_NALUS_IN_A_FRAME ];
+    Nalu_t chunkNalusArray[ MAX_NALUS_IN_A_FRAME ];
+
+    result = H264Packetizer_Init( &( frameCtx ),
+                                  &( frameNalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    frame.pFrameData = pFrame;
+    frame.frameDataLength = frameLength;
+
+    result = H264Packetizer_AddFrame( &( frameCtx ),
+                                      &( frame ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 5,
+                       frameCtx.naluCount );
+
+    for( size_t chunkSize = 1; chunkSize <= frameLength; chunkSize++ )
+    {
+        result = H264Packetizer_Init( &( chunkCtx ),
+                                      &( chunkNalusArray[ 0 ] ),
+                                      MAX_NALUS_IN_A_FRAME );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+
+        for( size_t offset = 0; offset < frameLength; offset += chunkSize )
+        {
+            chunk.pFrameData = &( pFrame[ offset ] );
+            chunk.frameDataLength = H264_MIN( chunkSize, frameLength - offset );
+
+            result = H264Packetizer_AddChunk( &( chunkCtx ),
+                                              &( chunk ),
+                                              ( offset + chunkSize >= frameLength ) ? 1 : 0 );
+
+            TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                               result );
+        }
+
+        TEST_ASSERT_EQUAL( frameCtx.naluCount,
+                           chunkCtx.naluCount );
+
+        for( size_t i = 0; i < frameCtx.naluCount; i++ )
+        {
+            TEST_ASSERT_EQUAL_PTR( frameNalusArray[ i ].pNaluData,
+                                   chunkNalusArray[ i ].pNaluData );
+            TEST_ASSERT_EQUAL( frameNalusArray[ i ].naluDataLength,
+                               chunkNalusArray[ i ].naluDataLength );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that NALUs are available for packetization before the last
+ * chunk is added.
+ */
+void test_H264_Packetizer_AddChunk_PacketsBeforeLastChunk( void )
+{
+    uint8_t pFrame[] =
+    {
+        0x00, 0x00, 0x00, 0x01, 0x09, 0x10,
+        0x00, 0x00, 0x00, 0x01, 0x68, 0xce, 0x3c, 0x80
+    };
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    Frame_t chunk;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t pktBuffer[ MAX_H264_PACKET_LENGTH ];
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* The first chunk ends in the middle of the second start code. */
+    chunk.pFrameData = &( pFrame[ 0 ] );
+    chunk.frameDataLength = 8;
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      0 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       ctx.naluCount );
+
+    chunk.pFrameData = &( pFrame[ 8 ] );
+    chunk.frameDataLength = 3;
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      0 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       ctx.naluCount );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       pkt.packetDataLength );
+
+    chunk.pFrameData = &( pFrame[ 11 ] );
+    chunk.frameDataLength = sizeof( pFrame ) - 11;
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       pkt.packetDataLength );
+
+    /* The next frame starts a new chunk sequence. */
+    chunk.pFrameData = &( pFrame[ 0 ] );
+    chunk.frameDataLength = sizeof( pFrame );
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       ctx.naluCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264_Packetizer_AddChunk with missing start code and
+ * non-consecutive chunks.
+ */
+void test_H264_Packetizer_AddChunk_Malformed( void )
+{
+    uint8_t pFrame[] =
+    {
+        0x09, 0x10, 0x00, 0x00, 0x00, 0x01, 0x09, 0x10
+    };
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    Frame_t chunk;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    chunk.pFrameData = &( pFrame[ 0 ] );
+    chunk.frameDataLength = 2;
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_MALFORMED_PACKET,
+                       result );
+
+    /* Skipping bytes between chunks is rejected. */
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      0 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    chunk.pFrameData = &( pFrame[ 3 ] );
+    chunk.frameDataLength = 5;
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    /* Data before the first start code is ignored. */
+    chunk.pFrameData = &( pFrame[ 0 ] );
+    chunk.frameDataLength = sizeof( pFrame );
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       ctx.naluCount );
+    TEST_ASSERT_EQUAL_PTR( &( pFrame[ 6 ] ),
+                           nalusArray[ 0 ].pNaluData );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264_Packetizer_AddChunk in case of bad parameters.
+ */
+void test_H264_Packetizer_AddChunk_BadParams( void )
+{
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    Frame_t chunk;
+
+    chunk.pFrameData = &( frameBuffer[ 0 ] );
+    chunk.frameDataLength = MAX_FRAME_LENGTH;
+
+    result = H264Packetizer_AddChunk( NULL,
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      NULL,
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    chunk.pFrameData = NULL;
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    /* Only the last chunk can be empty. */
+    chunk.pFrameData = &( frameBuffer[ 0 ] );
+    chunk.frameDataLength = 0;
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      0 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that an empty last chunk ends a frame whose data was
+ * already added.
+ */
+void test_H264_Packetizer_AddChunk_EmptyLastChunk( void )
+{
+    uint8_t pFrame[] =
+    {
+        0x00, 0x00, 0x00, 0x01, 0x09, 0x10,
+        0x00, 0x00, 0x00, 0x01, 0x68, 0xce, 0x3c, 0x80
+    };
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    Frame_t chunk;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    chunk.pFrameData = &( pFrame[ 0 ] );
+    chunk.frameDataLength = sizeof( pFrame );
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      0 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       ctx.naluCount );
+
+    chunk.pFrameData = NULL;
+    chunk.frameDataLength = 0;
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       ctx.naluCount );
+    TEST_ASSERT_EQUAL_PTR( &( pFrame[ 10 ] ),
+                           nalusArray[ 1 ].pNaluData );
+    TEST_ASSERT_EQUAL( 4,
+                       nalusArray[ 1 ].naluDataLength );
+
+    /* An empty last chunk without a frame is malformed. */
+    chunk.pFrameData = &( pFrame[ 0 ] );
+
+    result = H264Packetizer_AddChunk( &( ctx ),
+                                      &( chunk ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_MALFORMED_PACKET,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       ctx.naluCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the NALU array is used as a ring when packets are
+ * fetched while the chunks of a frame are still being added.
+ */
+void test_H264_Packetizer_AddChunk_SmallNaluArray( void )
+{
+    uint8_t pFrame[] =
+    {
+        0x00, 0x00, 0x00, 0x01, 0x61, 0x01, 0x01, 0x01, 0x01,
+        0x00, 0x00, 0x00, 0x01, 0x61, 0x02, 0x02, 0x02, 0x02,
+        0x00, 0x00, 0x00, 0x01, 0x61, 0x03, 0x03, 0x03, 0x03,
+        0x00, 0x00, 0x00, 0x01, 0x61, 0x04, 0x04, 0x04, 0x04
+    };
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    Frame_t chunk;
+    Nalu_t nalusArray[ 2 ];
+    uint8_t pktBuffer[ 8 ];
+    size_t frameIndex, chunkStart, packetCount;
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  2 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* Two frames without re-initializing the packetizer. */
+    for( frameIndex = 0; frameIndex < 2; frameIndex++ )
+    {
+        packetCount = 0;
+
+        for( chunkStart = 0; chunkStart < sizeof( pFrame ); chunkStart += 6 )
+        {
+            chunk.pFrameData = &( pFrame[ chunkStart ] );
+            chunk.frameDataLength = sizeof( pFrame ) - chunkStart;
+            chunk.frameDataLength = ( chunk.frameDataLength < 6 ) ? chunk.frameDataLength : 6;
+
+            result = H264Packetizer_AddChunk( &( ctx ),
+                                              &( chunk ),
+                                              ( chunkStart + 6 >= sizeof( pFrame ) ) ? 1 : 0 );
+
+            TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                               result );
+
+            /* Two NALUs do not fit in a STAP-A packet, so each is sent in a
+             * single NAL unit packet. */
+            do
+            {
+                pkt.pPacketData = &( pktBuffer[ 0 ] );
+                pkt.packetDataLength = sizeof( pktBuffer );
+
+                result = H264Packetizer_GetPacket( &( ctx ),
+                                                   &( pkt ) );
+
+                if( result == H264_RESULT_OK )
+                {
+                    packetCount++;
+
+                    TEST_ASSERT_EQUAL( 5,
+                                       pkt.packetDataLength );
+                    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( pFrame[ ( 9 * packetCount ) - 5 ] ),
+                                                   &( pktBuffer[ 0 ] ),
+                                                   5 );
+                }
+            } while( result == H264_RESULT_OK );
+
+            TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_PACKETS,
+                               result );
+        }
+
+        TEST_ASSERT_EQUAL( 4,
+                           packetCount );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate STAP-A packets and packet descriptors with NALUs that wrap
+ * around the end of the NALU array.
+ */
+void test_H264_Packetizer_NaluArrayWrap( void )
+{
+    uint8_t naluData[ 5 ][ 5 ] =
+    {
+        { 0x61, 0x01, 0x01, 0x01, 0x01 },
+        { 0x61, 0x02, 0x02, 0x02, 0x02 },
+        { 0x61, 0x03, 0x03, 0x03, 0x03 },
+        { 0x61, 0x04, 0x04, 0x04, 0x04 },
+        { 0x61, 0x05, 0x05, 0x05, 0x05 }
+    };
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264PacketDescriptor_t descriptor;
+    Nalu_t nalu;
+    Nalu_t nalusArray[ 3 ];
+    RtpIoVec_t slices[ 8 ];
+    uint8_t pktBuffer[ 32 ];
+    size_t i;
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  3 );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* Move the head and the tail to the last slot. */
+    for( i = 0; i < 2; i++ )
+    {
+        nalu.pNaluData = &( naluData[ i ][ 0 ] );
+        nalu.naluDataLength = 5;
+
+        result = H264Packetizer_AddNalu( &( ctx ),
+                                         &( nalu ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+
+        pkt.pPacketData = &( pktBuffer[ 0 ] );
+        pkt.packetDataLength = sizeof( pktBuffer );
+
+        result = H264Packetizer_GetPacket( &( ctx ),
+                                           &( pkt ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+    }
+
+    /* NALUs 3, 4 and 5 are in slots 2, 0 and 1. */
+    for( i = 2; i < 5; i++ )
+    {
+        nalu.pNaluData = &( naluData[ i ][ 0 ] );
+        nalu.naluDataLength = 5;
+
+        result = H264Packetizer_AddNalu( &( ctx ),
+                                         &( nalu ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+    }
+
+    result = H264Packetizer_AddNalu( &( ctx ),
+                                     &( nalu ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1 + ( 3 * 7 ),
+                       pkt.packetDataLength );
+
+    for( i = 0; i < 3; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( naluData[ i + 2 ][ 0 ] ),
+                                       &( pktBuffer[ 3 + ( 7 * i ) ] ),
+                                       5 );
+    }
+
+    /* The same NALUs again, described instead of copied. */
+    for( i = 2; i < 5; i++ )
+    {
+        nalu.pNaluData = &( naluData[ i ][ 0 ] );
+        nalu.naluDataLength = 5;
+
+        result = H264Packetizer_AddNalu( &( ctx ),
+                                         &( nalu ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+    }
+
+    descriptor.pSlices = &( slices[ 0 ] );
+    descriptor.slicesLength = 8;
+    descriptor.packetDataLength = sizeof( pktBuffer );
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 6,
+                       descriptor.slicesLength );
+
+    for( i = 0; i < 3; i++ )
+    {
+        TEST_ASSERT_EQUAL_PTR( &( naluData[ i + 2 ][ 0 ] ),
+                               slices[ ( 2 * i ) + 1 ].pBase );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 packetization aggregates small NALUs in a STAP-A packet.
+ */
+void test_H264_Packetizer_StapA( void )
+{
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    Nalu_t nalu;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t pktBuffer[ 20 ];
+    uint8_t naluData1[] = { 0x67, 0x42 };                                     /* SPS: NRI=3. */
+    uint8_t naluData2[] = { 0x86, 0x05 };                                     /* SEI: F=1, NRI=0. */
+    uint8_t naluData3[] = { 0x28, 0xce, 0x3c };                               /* PPS: NRI=1. */
+    uint8_t naluData4[] = { 0x65, 0x88, 0x84, 0x12, 0xff, 0xff, 0xfc, 0x3d }; /* IDR slice. */
+    uint8_t * pNaluData[] = { naluData1, naluData2, naluData3, naluData4 };
+    size_t naluDataLength[] = { sizeof( naluData1 ), sizeof( naluData2 ), sizeof( naluData3 ), sizeof( naluData4 ) };
+    uint8_t expectedPacket[] =
+    {
+        0xF8,                   /* STAP-A header: F=1, NRI=3. */
+        0x00, 0x02, 0x67, 0x42,
+        0x00, 0x02, 0x86, 0x05,
+        0x00, 0x03, 0x28, 0xce, 0x3c
+    };
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    for( size_t i = 0; i < sizeof( naluDataLength ) / sizeof( size_t ); i++ )
+    {
+        nalu.pNaluData = pNaluData[ i ];
+        nalu.naluDataLength = naluDataLength[ i ];
+
+        result = H264Packetizer_AddNalu( &( ctx ),
+                                         &( nalu ) );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+    }
+
+    /* The first three NALUs fit in one STAP-A packet, the fourth does not. */
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket[ 0 ] ),
+                                   pkt.pPacketData,
+                                   pkt.packetDataLength );
+
+    /* The last NALU goes in a Single NAL Unit packet. */
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( naluData4 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( naluData4[ 0 ] ),
+                                   pkt.pPacketData,
+                                   pkt.packetDataLength );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_PACKETS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the packets described by H264Packetizer_GetPacketDescriptor
+ * match the packets from H264Packetizer_GetPacket.
+ */
+void test_H264_Packetizer_GetPacketDescriptor( void )
+{
+    H264PacketizerContext_t ctx = { 0 };
+    H264PacketizerContext_t descriptorCtx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264PacketDescriptor_t descriptor;
+    Nalu_t nalu;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    Nalu_t descriptorNalusArray[ MAX_NALUS_IN_A_FRAME ];
+    RtpIoVec_t slices[ 8 ];
+    uint8_t pktBuffer[ 32 ];
+    uint8_t gatheredPacket[ 32 ];
+    size_t gatheredLength;
+    uint8_t naluData1[] = { 0x67, 0x42, 0xc0, 0x1f };
+    uint8_t naluData2[] = { 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t naluData3[] = { 0x86, 0x05, 0xff };
+    uint8_t naluData4[] =
+    {
+        0x65, 0x88, 0x84, 0x12, 0xff, 0xff, 0xfc, 0x3d, 0x14, 0x00,
+        0x04, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae,
+        0xba, 0x00, 0x6e, 0x22, 0x21, 0x04, 0xbf, 0xff, 0xff, 0x0f
+    };
+    uint8_t naluData5[] = { 0x41, 0x9a };
+    uint8_t * pNaluData[] = { naluData1, naluData2, naluData3, naluData4, naluData5 };
+    size_t naluDataLength[] = { sizeof( naluData1 ), sizeof( naluData2 ), sizeof( naluData3 ), sizeof( naluData4 ), sizeof( naluData5 ) };
+
+    for( size_t packetLength = 4; packetLength <= sizeof( pktBuffer ); packetLength++ )
+    {
+        result = H264Packetizer_Init( &( ctx ),
+                                      &( nalusArray[ 0 ] ),
+                                      MAX_NALUS_IN_A_FRAME );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+
+        result = H264Packetizer_Init( &( descriptorCtx ),
+                                      &( descriptorNalusArray[ 0 ] ),
+                                      MAX_NALUS_IN_A_FRAME );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+
+        for( size_t i = 0; i < sizeof( naluDataLength ) / sizeof( size_t ); i++ )
+        {
+            nalu.pNaluData = pNaluData[ i ];
+            nalu.naluDataLength = naluDataLength[ i ];
+
+            result = H264Packetizer_AddNalu( &( ctx ),
+                                             &( nalu ) );
+
+            TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                               result );
+
+            result = H264Packetizer_AddNalu( &( descriptorCtx ),
+                                             &( nalu ) );
+
+            TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                               result );
+        }
+
+        do
+        {
+            pkt.pPacketData = &( pktBuffer[ 0 ] );
+            pkt.packetDataLength = packetLength;
+
+            result = H264Packetizer_GetPacket( &( ctx ),
+                                               &( pkt ) );
+
+            descriptor.pSlices = &( slices[ 0 ] );
+            descriptor.slicesLength = sizeof( slices ) / sizeof( RtpIoVec_t );
+            descriptor.packetDataLength = packetLength;
+
+            TEST_ASSERT_EQUAL( result,
+                               H264Packetizer_GetPacketDescriptor( &( descriptorCtx ),
+                                                                   &( descriptor ) ) );
+
+            if( result == H264_RESULT_OK )
+            {
+                gatheredLength = 0;
+
+                for( size_t i = 0; i < descriptor.slicesLength; i++ )
+                {
+                    memcpy( &( gatheredPacket[ gatheredLength ] ),
+                            slices[ i ].pBase,
+                            slices[ i ].length );
+                    gatheredLength += slices[ i ].length;
+                }
+
+                TEST_ASSERT_EQUAL( pkt.packetDataLength,
+                                   descriptor.packetDataLength );
+                TEST_ASSERT_EQUAL( pkt.packetDataLength,
+                                   gatheredLength );
+                TEST_ASSERT_EQUAL_UINT8_ARRAY( pkt.pPacketData,
+                                               &( gatheredPacket[ 0 ] ),
+                                               gatheredLength );
+            }
+        } while( result == H264_RESULT_OK );
+
+        TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_PACKETS,
+                           result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264_Packetizer_GetPacketDescriptor when the number of
+ * slices limits the packet.
+ */
+void test_H264_Packetizer_GetPacketDescriptor_FewSlices( void )
+{
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264PacketDescriptor_t descriptor;
+    Nalu_t nalu;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    RtpIoVec_t slices[ 2 ];
+    uint8_t naluData1[] = { 0x67, 0x42 };
+    uint8_t naluData2[] = { 0x65, 0x88, 0x84, 0x12, 0xff, 0xff, 0xfc, 0x3d };
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    nalu.pNaluData = &( naluData1[ 0 ] );
+    nalu.naluDataLength = sizeof( naluData1 );
+
+    result = H264Packetizer_AddNalu( &( ctx ),
+                                     &( nalu ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    nalu.pNaluData = &( naluData2[ 0 ] );
+    nalu.naluDataLength = sizeof( naluData2 );
+
+    result = H264Packetizer_AddNalu( &( ctx ),
+                                     &( nalu ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* Both NALUs fit in the packet but two slices are not enough for a
+     * STAP-A packet. */
+    descriptor.pSlices = &( slices[ 0 ] );
+    descriptor.slicesLength = 2;
+    descriptor.packetDataLength = MAX_H264_PACKET_LENGTH + 2;
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       descriptor.slicesLength );
+    TEST_ASSERT_EQUAL_PTR( &( naluData1[ 0 ] ),
+                           slices[ 0 ].pBase );
+    TEST_ASSERT_EQUAL( sizeof( naluData1 ),
+                       slices[ 0 ].length );
+
+    /* One slice is not enough for a FU-A packet. */
+    descriptor.slicesLength = 1;
+    descriptor.packetDataLength = 4;
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    /* No space for FU-A payload. */
+    descriptor.slicesLength = 2;
+    descriptor.packetDataLength = FU_A_HEADER_SIZE;
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OUT_OF_MEMORY,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264_Packetizer_GetPacketDescriptor in case of bad
+ * parameters.
+ */
+void test_H264_Packetizer_GetPacketDescriptor_BadParams( void )
+{
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264PacketDescriptor_t descriptor;
+    RtpIoVec_t slices[ 2 ];
+
+    descriptor.pSlices = &( slices[ 0 ] );
+    descriptor.slicesLength = 2;
+    descriptor.packetDataLength = MAX_H264_PACKET_LENGTH;
+
+    result = H264Packetizer_GetPacketDescriptor( NULL,
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 NULL );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    descriptor.pSlices = NULL;
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    descriptor.pSlices = &( slices[ 0 ] );
+    descriptor.slicesLength = 0;
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    descriptor.slicesLength = 2;
+    descriptor.packetDataLength = 0;
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+
+    /* No NALUs added. */
+    descriptor.packetDataLength = MAX_H264_PACKET_LENGTH;
+
+    result = H264Packetizer_GetPacketDescriptor( &( ctx ),
+                                                 &( descriptor ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_PACKETS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
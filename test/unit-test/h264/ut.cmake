@@ -30,6 +30,7 @@ list(APPEND mock_define_list
 list(APPEND real_source_files
             ${MODULE_ROOT_DIR}/codec_packetizers/h264/h264_depacketizer.c
             ${MODULE_ROOT_DIR}/codec_packetizers/h264/h264_packetizer.c
+            ${MODULE_ROOT_DIR}/codec_packetizers/common/annexb_scanner.c
         )
 # List the directories the module under test includes.
 list(APPEND real_include_directories
@@ -2230,3 +2230,885 @@ void test_H265_Depacketizer_GetPacketProperties_BadParams( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265 packetization AddFrameLengthPrefixed with multiple NAL units.
+ */
+void test_H265_Packetizer_AddFrameLengthPrefixed( void )
+{
+    H265PacketizerContext_t ctx;
+    H265Result_t result;
+    H265Nalu_t naluArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t frameData[] =
+    {
+        0x00, 0x00, 0x00, 0x04, /* NALU1 length. */
+        0x40, 0x01, 0xAA, 0xBB, /* NALU1. Header: Type=32, TID=1. */
+        0x00, 0x00, 0x00, 0x04, /* NALU2 length. */
+        0x42, 0x02, 0xCC, 0xDD, /* NALU2. Header: Type=33, TID=2. */
+        0x00, 0x00, 0x00, 0x04, /* NALU3 length. */
+        0xC4, 0x03, 0xEE, 0xFF  /* NALU3 NAL. Header: F=1, Type=34, TID=3. */
+    };
+    H265Frame_t frame =
+    {
+        .pFrameData         = &( frameData[ 0 ] ),
+        .frameDataLength    = sizeof( frameData )
+    };
+    H265Packet_t packet =
+    {
+        .pPacketData = &( packetBuffer[ 0 ] ),
+        .packetDataLength = MAX_H265_PACKET_LENGTH
+    };
+    /* Expected aggregate packet. */
+    uint8_t expectedPacket[] =
+    {
+        0xE0, 0x01,                 /* Payload header: F=1, Type=48, TID=1. */
+        0x00, 0x04,                 /* NALU1 size. */
+        0x40, 0x01, 0xAA, 0xBB,     /* NALU1 payload. */
+        0x00, 0x04,                 /* NALU2 size. */
+        0x42, 0x02, 0xCC, 0xDD,     /* NALU2 payload. */
+        0x00, 0x04,                 /* NALU3 size. */
+        0xC4, 0x03, 0xEE, 0xFF      /* NALU3 payload. */
+    };
+
+    result = H265Packetizer_Init( &( ctx ),
+                                  &( naluArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, ctx.naluCount );
+
+    result = H265Packetizer_GetPacket( &( ctx ), &( packet ) );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket ), packet.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket[ 0 ] ),
+                                   packet.pPacketData,
+                                   packet.packetDataLength );
+
+    /* Same NAL units with 2-byte lengths. */
+    frameData[ 2 ] = 0x00;
+    frameData[ 3 ] = 0x04;
+    frameData[ 4 ] = 0x40;
+    frameData[ 5 ] = 0x01;
+    frameData[ 6 ] = 0xAA;
+    frameData[ 7 ] = 0xBB;
+    frameData[ 8 ] = 0x00;
+    frameData[ 9 ] = 0x04;
+    frameData[ 10 ] = 0x42;
+    frameData[ 11 ] = 0x02;
+    frameData[ 12 ] = 0xCC;
+    frameData[ 13 ] = 0xDD;
+    frame.pFrameData = &( frameData[ 2 ] );
+    frame.frameDataLength = 12;
+
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 2 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, ctx.naluCount );
+
+    /* Same NAL units with 1-byte lengths. */
+    frameData[ 8 ] = 0x04;
+    frameData[ 9 ] = 0x42;
+    frameData[ 10 ] = 0x02;
+    frameData[ 11 ] = 0xCC;
+    frameData[ 12 ] = 0xDD;
+    frame.pFrameData = &( frameData[ 3 ] );
+    frame.frameDataLength = 10;
+
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, ctx.naluCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265 packetization AddFrameLengthPrefixed with malformed frames.
+ */
+void test_H265_Packetizer_AddFrameLengthPrefixed_Malformed( void )
+{
+    H265PacketizerContext_t ctx;
+    H265Result_t result;
+    H265Nalu_t naluArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t frameData[] =
+    {
+        0x00, 0x05,             /* NALU length, one more than available. */
+        0x40, 0x01, 0xAA, 0xBB  /* NALU. Header: Type=32, TID=1. */
+    };
+    H265Frame_t frame =
+    {
+        .pFrameData         = &( frameData[ 0 ] ),
+        .frameDataLength    = sizeof( frameData )
+    };
+
+    result = H265Packetizer_Init( &( ctx ),
+                                  &( naluArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 2 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_MALFORMED_PACKET, result );
+
+    /* Zero length NALU. */
+    frameData[ 1 ] = 0x00;
+
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 2 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_MALFORMED_PACKET, result );
+
+    /* Truncated length field. */
+    frame.frameDataLength = 3;
+
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_MALFORMED_PACKET, result );
+    TEST_ASSERT_EQUAL( 0, ctx.naluCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265 packetization AddFrameLengthPrefixed with bad parameters.
+ */
+void test_H265_Packetizer_AddFrameLengthPrefixed_BadParams( void )
+{
+    H265PacketizerContext_t ctx;
+    H265Result_t result;
+    H265Frame_t frame =
+    {
+        .pFrameData = &( frameBuffer[ 0 ] ),
+        .frameDataLength = MAX_FRAME_LENGTH
+    };
+
+    result = H265Packetizer_AddFrameLengthPrefixed( NULL, &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), NULL, 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 3 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    frame.pFrameData = NULL;
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = 0;
+    result = H265Packetizer_AddFrameLengthPrefixed( &( ctx ), &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265 depacketization GetFrameLengthPrefixed for all length sizes.
+ */
+void test_H265_Depacketizer_GetFrameLengthPrefixed( void )
+{
+    H265DepacketizerContext_t ctx;
+    H265Result_t result;
+    H265Packet_t packetsArray[ 10 ];
+    H265Frame_t frame;
+    uint8_t singleNaluPacketData[] =
+    {
+        0x26, 0x01,      /* NALU header: Type=19, TID=1. */
+        0xAA, 0xBB, 0xCC /* NALU payload. */
+    };
+    H265Packet_t singleNaluPacket =
+    {
+        .pPacketData = &( singleNaluPacketData[ 0 ] ),
+        .packetDataLength = sizeof( singleNaluPacketData )
+    };
+    uint8_t expectedFrame[] =
+    {
+        /* Length. */
+        0x00, 0x00, 0x00, 0x05,
+        /* Nalu. */
+        0x26, 0x01,
+        0xAA, 0xBB, 0xCC,
+        /* Length. */
+        0x00, 0x00, 0x00, 0x05,
+        /* Nalu. */
+        0x26, 0x01,
+        0xAA, 0xBB, 0xCC
+    };
+    size_t naluLengthSizes[] = { 1, 2, 4 };
+    size_t i, expectedLengthOffset;
+
+    result = H265Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    10 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    for( i = 0; i < sizeof( naluLengthSizes ) / sizeof( naluLengthSizes[ 0 ] ); i++ )
+    {
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = MAX_FRAME_LENGTH;
+        expectedLengthOffset = 4 - naluLengthSizes[ i ];
+
+        result = H265Depacketizer_AddPacket( &( ctx ), &( singleNaluPacket ) );
+
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+        result = H265Depacketizer_AddPacket( &( ctx ), &( singleNaluPacket ) );
+
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+        result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), &( frame ), naluLengthSizes[ i ] );
+
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( 2 * ( naluLengthSizes[ i ] + sizeof( singleNaluPacketData ) ), frame.frameDataLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame[ expectedLengthOffset ] ),
+                                       &( frame.pFrameData[ 0 ] ),
+                                       naluLengthSizes[ i ] + sizeof( singleNaluPacketData ) );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame[ 9 + expectedLengthOffset ] ),
+                                       &( frame.pFrameData[ naluLengthSizes[ i ] + sizeof( singleNaluPacketData ) ] ),
+                                       naluLengthSizes[ i ] + sizeof( singleNaluPacketData ) );
+    }
+
+    result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_NO_MORE_FRAMES, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265 depacketization GetFrameLengthPrefixed when a NALU does not
+ * fit in the length field or the frame buffer.
+ */
+void test_H265_Depacketizer_GetFrameLengthPrefixed_Unsupported_And_OutOfMemory( void )
+{
+    H265DepacketizerContext_t ctx;
+    H265Result_t result;
+    H265Packet_t packetsArray[ 10 ];
+    H265Frame_t frame =
+    {
+        .pFrameData = &( frameBuffer[ 0 ] ),
+        .frameDataLength = MAX_FRAME_LENGTH
+    };
+    uint8_t largeNaluPacketData[ 300 ] = { 0 };
+    H265Packet_t largeNaluPacket =
+    {
+        .pPacketData = &( largeNaluPacketData[ 0 ] ),
+        .packetDataLength = sizeof( largeNaluPacketData )
+    };
+    static uint8_t largerNaluPacketData[ UINT16_MAX + 1 ];
+    H265Packet_t largerNaluPacket =
+    {
+        .pPacketData = &( largerNaluPacketData[ 0 ] ),
+        .packetDataLength = sizeof( largerNaluPacketData )
+    };
+    static uint8_t frameData[ UINT16_MAX + 3 ];
+
+    /* NALU header: Type=19, TID=1. */
+    largeNaluPacketData[ 0 ] = 0x26;
+    largeNaluPacketData[ 1 ] = 0x01;
+    memset( &( largerNaluPacketData[ 0 ] ),
+            0,
+            sizeof( largerNaluPacketData ) );
+    largerNaluPacketData[ 0 ] = 0x26;
+    largerNaluPacketData[ 1 ] = 0x01;
+
+    result = H265Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    10 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    result = H265Depacketizer_AddPacket( &( ctx ), &( largeNaluPacket ) );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), &( frame ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_UNSUPPORTED_PACKET, result );
+
+    result = H265Depacketizer_AddPacket( &( ctx ), &( largerNaluPacket ) );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), &( frame ), 2 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_UNSUPPORTED_PACKET, result );
+
+    /* No space for anything after the length field. */
+    result = H265Depacketizer_AddPacket( &( ctx ), &( largeNaluPacket ) );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    frame.frameDataLength = 4;
+
+    result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265 depacketization GetFrameLengthPrefixed with bad parameters.
+ */
+void test_H265_Depacketizer_GetFrameLengthPrefixed_BadParams( void )
+{
+    H265DepacketizerContext_t ctx;
+    H265Result_t result;
+    H265Frame_t frame =
+    {
+        .pFrameData = &( frameBuffer[ 0 ] ),
+        .frameDataLength = MAX_FRAME_LENGTH
+    };
+
+    result = H265Depacketizer_GetFrameLengthPrefixed( NULL, &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), NULL, 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), &( frame ), 0 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    frame.pFrameData = NULL;
+    result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = 0;
+    result = H265Depacketizer_GetFrameLengthPrefixed( &( ctx ), &( frame ), 4 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265 packetization AddChunk with chunks of every size.
+ */
+void test_H265_Packetizer_AddChunk( void )
+{
+    H265PacketizerContext_t frameCtx;
+    H265PacketizerContext_t chunkCtx;
+    H265Result_t result;
+    H265Nalu_t frameNaluArray[ MAX_NALUS_IN_A_FRAME ];
+    H265Nalu_t chunkNaluArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t frameData[] =
+    {
+        0x00, 0x00, 0x00, 0x01, /* Start code. */
+        0x40, 0x01, 0xAA, 0xBB, /* NALU1. Header: Type=32, TID=1. */
+        0x00, 0x00, 0x01,       /* Start code. */
+        0x42, 0x02, 0xCC, 0xDD, /* NALU2. Header: Type=33, TID=2. */
+        0x00, 0x00, 0x00, 0x01, /* Start code. */
+        0xC4, 0x03, 0xEE, 0xFF  /* NALU3 NAL. Header: F=1, Type=34, TID=3. */
+    };
+    H265Frame_t frame =
+    {
+        .pFrameData         = &( frameData[ 0 ] ),
+        .frameDataLength    = sizeof( frameData )
+    };
+    H265Frame_t chunk;
+    size_t chunkSize, offset, i;
+
+    result = H265Packetizer_Init( &( frameCtx ),
+                                  &( frameNaluArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    result = H265Packetizer_AddFrame( &( frameCtx ), &( frame ) );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, frameCtx.naluCount );
+
+    for( chunkSize = 1; chunkSize <= sizeof( frameData ); chunkSize++ )
+    {
+        result = H265Packetizer_Init( &( chunkCtx ),
+                                      &( chunkNaluArray[ 0 ] ),
+                                      MAX_NALUS_IN_A_FRAME );
+
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+        for( offset = 0; offset < sizeof( frameData ); offset += chunkSize )
+        {
+            chunk.pFrameData = &( frameData[ offset ] );
+            chunk.frameDataLength = ( chunkSize < sizeof( frameData ) - offset ) ? chunkSize : sizeof( frameData ) - offset;
+
+            result = H265Packetizer_AddChunk( &( chunkCtx ),
+                                              &( chunk ),
+                                              ( offset + chunkSize >= sizeof( frameData ) ) ? 1 : 0 );
+
+            TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+        }
+
+        TEST_ASSERT_EQUAL( frameCtx.naluCount, chunkCtx.naluCount );
+
+        for( i = 0; i < frameCtx.naluCount; i++ )
+        {
+            TEST_ASSERT_EQUAL_PTR( frameNaluArray[ i ].pNaluData, chunkNaluArray[ i ].pNaluData );
+            TEST_ASSERT_EQUAL( frameNaluArray[ i ].naluDataLength, chunkNaluArray[ i ].naluDataLength );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265 packetization AddChunk with malformed input.
+ */
+void test_H265_Packetizer_AddChunk_Malformed( void )
+{
+    H265PacketizerContext_t ctx;
+    H265Result_t result;
+    H265Nalu_t naluArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t frameData[] =
+    {
+        0x00, 0x00, 0x01,       /* Start code. */
+        0x40, 0x01, 0xAA, 0xBB, /* NALU1. Header: Type=32, TID=1. */
+        0x00, 0x00, 0x01,       /* Start code. */
+        0x42                    /* Incomplete NALU header. */
+    };
+    H265Frame_t chunk =
+    {
+        .pFrameData         = &( frameData[ 3 ] ),
+        .frameDataLength    = 4
+    };
+
+    result = H265Packetizer_Init( &( ctx ),
+                                  &( naluArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    /* No start code. */
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_MALFORMED_PACKET, result );
+
+    /* Non-consecutive chunks. */
+    chunk.pFrameData = &( frameData[ 0 ] );
+    chunk.frameDataLength = 5;
+
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 0 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    chunk.pFrameData = &( frameData[ 6 ] );
+    chunk.frameDataLength = 5;
+
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    /* Last NALU too short. */
+    chunk.pFrameData = &( frameData[ 0 ] );
+    chunk.frameDataLength = sizeof( frameData );
+
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_MALFORMED_PACKET, result );
+    TEST_ASSERT_EQUAL( 1, ctx.naluCount );
+
+    result = H265Packetizer_AddChunk( NULL, &( chunk ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    result = H265Packetizer_AddChunk( &( ctx ), NULL, 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    chunk.pFrameData = NULL;
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    /* Only the last chunk can be empty. */
+    chunk.pFrameData = &( frameData[ 0 ] );
+    chunk.frameDataLength = 0;
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 0 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    /* An empty last chunk without a frame. */
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_MALFORMED_PACKET, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test that an empty last chunk ends a frame whose data was already
+ * added.
+ */
+void test_H265_Packetizer_AddChunk_EmptyLastChunk( void )
+{
+    H265PacketizerContext_t ctx;
+    H265Result_t result;
+    H265Nalu_t naluArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t frameData[] =
+    {
+        0x00, 0x00, 0x01,       /* Start code. */
+        0x40, 0x01, 0xAA, 0xBB, /* NALU1. Header: Type=32, TID=1. */
+        0x00, 0x00, 0x01,       /* Start code. */
+        0x42, 0x01, 0xCC        /* NALU2. Header: Type=33, TID=1. */
+    };
+    H265Frame_t chunk =
+    {
+        .pFrameData         = &( frameData[ 0 ] ),
+        .frameDataLength    = sizeof( frameData )
+    };
+
+    result = H265Packetizer_Init( &( ctx ),
+                                  &( naluArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 0 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, ctx.naluCount );
+
+    chunk.pFrameData = NULL;
+    chunk.frameDataLength = 0;
+    result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), 1 );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, ctx.naluCount );
+    TEST_ASSERT_EQUAL_PTR( &( frameData[ 10 ] ), naluArray[ 1 ].pNaluData );
+    TEST_ASSERT_EQUAL( 3, naluArray[ 1 ].naluDataLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test that the NALU array is used as a ring when packets are fetched
+ * while the chunks of a frame are still being added.
+ */
+void test_H265_Packetizer_AddChunk_SmallNaluArray( void )
+{
+    H265PacketizerContext_t ctx;
+    H265Result_t result;
+    H265Nalu_t naluArray[ 2 ];
+    H265Packet_t packet;
+    H265Frame_t chunk;
+    uint8_t packetData[ 8 ];
+    size_t frameIndex, chunkStart, packetCount;
+    uint8_t frameData[] =
+    {
+        0x00, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
+        0x00, 0x00, 0x01, 0x02, 0x01, 0x02, 0x02, 0x02,
+        0x00, 0x00, 0x01, 0x02, 0x01, 0x03, 0x03, 0x03,
+        0x00, 0x00, 0x01, 0x02, 0x01, 0x04, 0x04, 0x04
+    };
+
+    result = H265Packetizer_Init( &( ctx ), &( naluArray[ 0 ] ), 2 );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    /* Two frames without re-initializing the packetizer. */
+    for( frameIndex = 0; frameIndex < 2; frameIndex++ )
+    {
+        packetCount = 0;
+
+        for( chunkStart = 0; chunkStart < sizeof( frameData ); chunkStart += 6 )
+        {
+            chunk.pFrameData = &( frameData[ chunkStart ] );
+            chunk.frameDataLength = sizeof( frameData ) - chunkStart;
+            chunk.frameDataLength = ( chunk.frameDataLength < 6 ) ? chunk.frameDataLength : 6;
+
+            result = H265Packetizer_AddChunk( &( ctx ), &( chunk ), ( chunkStart + 6 >= sizeof( frameData ) ) ? 1 : 0 );
+            TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+            /* Two NALUs do not fit in an aggregation packet. */
+            do
+            {
+                packet.pPacketData = &( packetData[ 0 ] );
+                packet.packetDataLength = sizeof( packetData );
+                result = H265Packetizer_GetPacket( &( ctx ), &( packet ) );
+
+                if( result == H265_RESULT_OK )
+                {
+                    packetCount++;
+                    TEST_ASSERT_EQUAL( 5, packet.packetDataLength );
+                    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( frameData[ ( 8 * packetCount ) - 5 ] ), &( packetData[ 0 ] ), 5 );
+                }
+            } while( result == H265_RESULT_OK );
+
+            TEST_ASSERT_EQUAL( H265_RESULT_NO_MORE_PACKETS, result );
+        }
+
+        TEST_ASSERT_EQUAL( 4, packetCount );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test aggregation packets and packet descriptors with NALUs that wrap
+ * around the end of the NALU array.
+ */
+void test_H265_Packetizer_NaluArrayWrap( void )
+{
+    H265PacketizerContext_t ctx;
+    H265Result_t result;
+    H265Nalu_t naluArray[ 3 ];
+    H265Packet_t packet;
+    H265PacketDescriptor_t descriptor;
+    H265Nalu_t nalu;
+    RtpIoVec_t slices[ 8 ];
+    uint8_t packetData[ 32 ];
+    size_t i;
+    uint8_t naluData[ 5 ][ 5 ] =
+    {
+        { 0x02, 0x01, 0x01, 0x01, 0x01 },
+        { 0x02, 0x01, 0x02, 0x02, 0x02 },
+        { 0x02, 0x01, 0x03, 0x03, 0x03 },
+        { 0x02, 0x01, 0x04, 0x04, 0x04 },
+        { 0x02, 0x01, 0x05, 0x05, 0x05 }
+    };
+
+    result = H265Packetizer_Init( &( ctx ), &( naluArray[ 0 ] ), 3 );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    /* Move the head and the tail to the last slot. */
+    for( i = 0; i < 2; i++ )
+    {
+        nalu.pNaluData = &( naluData[ i ][ 0 ] );
+        nalu.naluDataLength = 5;
+        result = H265Packetizer_AddNalu( &( ctx ), &( nalu ) );
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+        packet.pPacketData = &( packetData[ 0 ] );
+        packet.packetDataLength = sizeof( packetData );
+        result = H265Packetizer_GetPacket( &( ctx ), &( packet ) );
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    }
+
+    /* NALUs 3, 4 and 5 are in slots 2, 0 and 1. */
+    for( i = 2; i < 5; i++ )
+    {
+        nalu.pNaluData = &( naluData[ i ][ 0 ] );
+        nalu.naluDataLength = 5;
+        result = H265Packetizer_AddNalu( &( ctx ), &( nalu ) );
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    }
+
+    result = H265Packetizer_AddNalu( &( ctx ), &( nalu ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OUT_OF_MEMORY, result );
+
+    packet.pPacketData = &( packetData[ 0 ] );
+    packet.packetDataLength = sizeof( packetData );
+    result = H265Packetizer_GetPacket( &( ctx ), &( packet ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2 + ( 3 * 7 ), packet.packetDataLength );
+
+    for( i = 0; i < 3; i++ )
+    {
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( naluData[ i + 2 ][ 0 ] ), &( packetData[ 4 + ( 7 * i ) ] ), 5 );
+    }
+
+    /* The same NALUs again, described instead of copied. */
+    for( i = 2; i < 5; i++ )
+    {
+        nalu.pNaluData = &( naluData[ i ][ 0 ] );
+        nalu.naluDataLength = 5;
+        result = H265Packetizer_AddNalu( &( ctx ), &( nalu ) );
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    }
+
+    descriptor.pSlices = &( slices[ 0 ] );
+    descriptor.slicesLength = 8;
+    descriptor.packetDataLength = sizeof( packetData );
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 6, descriptor.slicesLength );
+
+    for( i = 0; i < 3; i++ )
+    {
+        TEST_ASSERT_EQUAL_PTR( &( naluData[ i + 2 ][ 0 ] ), slices[ ( 2 * i ) + 1 ].pBase );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test that the packets described by H265Packetizer_GetPacketDescriptor
+ * match the packets from H265Packetizer_GetPacket.
+ */
+void test_H265_Packetizer_GetPacketDescriptor( void )
+{
+    H265PacketizerContext_t ctx;
+    H265PacketizerContext_t descriptorCtx;
+    H265Result_t result, descriptorResult;
+    H265Nalu_t naluArray[ MAX_NALUS_IN_A_FRAME ];
+    H265Nalu_t descriptorNaluArray[ MAX_NALUS_IN_A_FRAME ];
+    H265Packet_t packet;
+    H265PacketDescriptor_t descriptor;
+    H265Nalu_t nalu;
+    RtpIoVec_t slices[ 8 ];
+    uint8_t gatheredPacket[ 40 ];
+    size_t packetLength, gatheredLength, i;
+    uint8_t naluData1[] = { 0x40, 0x01, 0xAA, 0xBB };       /* VPS: TID=1. */
+    uint8_t naluData2[] = { 0x42, 0x02, 0xCC, 0xDD };       /* SPS: TID=2. */
+    uint8_t naluData3[] = { 0xC4, 0x03, 0xEE };             /* PPS: F=1, TID=3. */
+    uint8_t naluData4[] =                                   /* IDR: TID=1. */
+    {
+        0x26, 0x01, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B
+    };
+    uint8_t naluData5[] = { 0x02, 0x01, 0x55 };             /* TRAIL_R: TID=1. */
+    uint8_t * pNaluData[] = { naluData1, naluData2, naluData3, naluData4, naluData5 };
+    size_t naluDataLength[] = { sizeof( naluData1 ), sizeof( naluData2 ), sizeof( naluData3 ), sizeof( naluData4 ), sizeof( naluData5 ) };
+
+    for( packetLength = 4; packetLength <= sizeof( gatheredPacket ); packetLength++ )
+    {
+        result = H265Packetizer_Init( &( ctx ), &( naluArray[ 0 ] ), MAX_NALUS_IN_A_FRAME );
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+        result = H265Packetizer_Init( &( descriptorCtx ), &( descriptorNaluArray[ 0 ] ), MAX_NALUS_IN_A_FRAME );
+        TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+        for( i = 0; i < sizeof( naluDataLength ) / sizeof( naluDataLength[ 0 ] ); i++ )
+        {
+            nalu.pNaluData = pNaluData[ i ];
+            nalu.naluDataLength = naluDataLength[ i ];
+
+            result = H265Packetizer_AddNalu( &( ctx ), &( nalu ) );
+            TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+            result = H265Packetizer_AddNalu( &( descriptorCtx ), &( nalu ) );
+            TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+        }
+
+        do
+        {
+            packet.pPacketData = &( packetBuffer[ 0 ] );
+            packet.packetDataLength = packetLength;
+            result = H265Packetizer_GetPacket( &( ctx ), &( packet ) );
+
+            descriptor.pSlices = &( slices[ 0 ] );
+            descriptor.slicesLength = sizeof( slices ) / sizeof( slices[ 0 ] );
+            descriptor.packetDataLength = packetLength;
+            descriptorResult = H265Packetizer_GetPacketDescriptor( &( descriptorCtx ), &( descriptor ) );
+
+            TEST_ASSERT_EQUAL( result, descriptorResult );
+
+            if( result == H265_RESULT_OK )
+            {
+                gatheredLength = 0;
+
+                for( i = 0; i < descriptor.slicesLength; i++ )
+                {
+                    memcpy( &( gatheredPacket[ gatheredLength ] ), slices[ i ].pBase, slices[ i ].length );
+                    gatheredLength += slices[ i ].length;
+                }
+
+                TEST_ASSERT_EQUAL( packet.packetDataLength, descriptor.packetDataLength );
+                TEST_ASSERT_EQUAL( packet.packetDataLength, gatheredLength );
+                TEST_ASSERT_EQUAL_UINT8_ARRAY( packet.pPacketData, &( gatheredPacket[ 0 ] ), gatheredLength );
+            }
+        } while( result == H265_RESULT_OK );
+
+        TEST_ASSERT_EQUAL( H265_RESULT_NO_MORE_PACKETS, result );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Test H265Packetizer_GetPacketDescriptor when the number of slices
+ * limits the packet, and for bad parameters.
+ */
+void test_H265_Packetizer_GetPacketDescriptor_FewSlices_And_BadParams( void )
+{
+    H265PacketizerContext_t ctx;
+    H265Result_t result;
+    H265Nalu_t naluArray[ MAX_NALUS_IN_A_FRAME ];
+    H265PacketDescriptor_t descriptor;
+    H265Nalu_t nalu;
+    RtpIoVec_t slices[ 2 ];
+    uint8_t naluData1[] = { 0x40, 0x01, 0xAA, 0xBB };
+    uint8_t naluData2[] = { 0x26, 0x01, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15 };
+
+    result = H265Packetizer_Init( &( ctx ), &( naluArray[ 0 ] ), MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    descriptor.pSlices = &( slices[ 0 ] );
+    descriptor.slicesLength = 2;
+    descriptor.packetDataLength = MAX_H265_PACKET_LENGTH;
+
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_NO_MORE_PACKETS, result );
+
+    nalu.pNaluData = &( naluData1[ 0 ] );
+    nalu.naluDataLength = sizeof( naluData1 );
+    result = H265Packetizer_AddNalu( &( ctx ), &( nalu ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    nalu.pNaluData = &( naluData2[ 0 ] );
+    nalu.naluDataLength = sizeof( naluData2 );
+    result = H265Packetizer_AddNalu( &( ctx ), &( nalu ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+
+    /* Two slices are not enough for an aggregation packet. */
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, descriptor.slicesLength );
+    TEST_ASSERT_EQUAL_PTR( &( naluData1[ 0 ] ), slices[ 0 ].pBase );
+    TEST_ASSERT_EQUAL( sizeof( naluData1 ), slices[ 0 ].length );
+
+    /* One slice is not enough for a fragmentation unit. */
+    descriptor.slicesLength = 1;
+    descriptor.packetDataLength = 4;
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OUT_OF_MEMORY, result );
+
+    /* No space for fragmentation unit payload. */
+    descriptor.slicesLength = 2;
+    descriptor.packetDataLength = FU_PAYLOAD_HEADER_SIZE + FU_HEADER_SIZE;
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OUT_OF_MEMORY, result );
+
+    result = H265Packetizer_GetPacketDescriptor( NULL, &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), NULL );
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    descriptor.pSlices = NULL;
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    descriptor.pSlices = &( slices[ 0 ] );
+    descriptor.slicesLength = 0;
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+
+    descriptor.slicesLength = 2;
+    descriptor.packetDataLength = NALU_HEADER_SIZE;
+    result = H265Packetizer_GetPacketDescriptor( &( ctx ), &( descriptor ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
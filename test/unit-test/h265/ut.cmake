@@ -29,6 +29,7 @@ list(APPEND mock_define_list
 list(APPEND real_source_files
             ${MODULE_ROOT_DIR}/codec_packetizers/h265/h265_packetizer.c   
             ${MODULE_ROOT_DIR}/codec_packetizers/h265/h265_depacketizer.c       
+            ${MODULE_ROOT_DIR}/codec_packetizers/common/annexb_scanner.c
         )
 # List the directories the module under test includes.
 list(APPEND real_include_directories
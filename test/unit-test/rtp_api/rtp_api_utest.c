@@ -1558,3 +1558,1552 @@ void test_Rtp_DeSerialize_MarkerBitSet( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeBatch in case of valid inputs.
+ */
+void test_Rtp_SerializeBatch_Pass( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpSenderContext_t senderCtx = { 0 };
+    RtpHeader_t header = { 0 };
+    RtpBatchPacket_t packets[ 2 ] = { 0 };
+    uint32_t csrcArray[ 1 ] = { 0x11223344 };
+    uint32_t extensionPayload[ 1 ] = { 0x55667788 };
+    uint8_t expectedSerializedPacket1[] =
+    {
+        /* RTP header: V = 2, X = 1, CSRC Count = 1, PT = 0x60, Sequence Number = 0xFFFF. */
+        0x91, 0x60, 0xFF, 0xFF,
+        /* Timestamp. */
+        0x12, 0x34, 0x56, 0x78,
+        /* SSRC. */
+        0x87, 0x65, 0x43, 0x21,
+        /* CSRC identifier. */
+        0x11, 0x22, 0x33, 0x44,
+        /* Extension profile = 0xABCD, Extension length = 1 word. */
+        0xAB, 0xCD, 0x00, 0x01,
+        /* Extension payload.  */
+        0x55, 0x66, 0x77, 0x88,
+        /* RTP payload - "hello ". */
+        0x68, 0x65, 0x6C, 0x6C, 0x6F, 0x20
+    };
+    uint8_t expectedSerializedPacket2[] =
+    {
+        /* RTP header: V = 2, X = 1, CSRC Count = 1, M = 1, PT = 0x60, Sequence Number = 0x0000. */
+        0x91, 0xE0, 0x00, 0x00,
+        /* Timestamp. */
+        0x12, 0x34, 0x56, 0x78,
+        /* SSRC. */
+        0x87, 0x65, 0x43, 0x21,
+        /* CSRC identifier. */
+        0x11, 0x22, 0x33, 0x44,
+        /* Extension profile = 0xABCD, Extension length = 1 word. */
+        0xAB, 0xCD, 0x00, 0x01,
+        /* Extension payload.  */
+        0x55, 0x66, 0x77, 0x88,
+        /* RTP payload - "world!". */
+        0x77, 0x6F, 0x72, 0x6C, 0x64, 0x21
+    };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    /* Marker and padding flags in the template header must be ignored. */
+    header.flags = RTP_HEADER_FLAG_EXTENSION | RTP_HEADER_FLAG_MARKER | RTP_HEADER_FLAG_PADDING;
+    header.payloadType = 0x60;
+    header.sequenceNumber = 0xFFFF;
+    header.ssrc = 0x87654321;
+    header.csrcCount = 1;
+    header.pCsrc = &( csrcArray[ 0 ] );
+    header.extension.extensionProfile = 0xABCD;
+    header.extension.extensionPayloadLength = 1;
+    header.extension.pExtensionPayload = &( extensionPayload[ 0 ] );
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packets[ 0 ].pPayload = ( uint8_t * ) "hello ";
+    packets[ 0 ].payloadLength = 6;
+    packets[ 0 ].pBuffer = pRtpBuffer;
+    packets[ 0 ].bufferLength = sizeof( expectedSerializedPacket1 );
+    packets[ 1 ].pPayload = ( uint8_t * ) "world!";
+    packets[ 1 ].payloadLength = 6;
+    packets[ 1 ].pBuffer = &( pRtpBuffer[ 100 ] );
+    packets[ 1 ].bufferLength = RTP_BUFFER_LENGTH - 100;
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 &( senderCtx ),
+                                 0x12345678,
+                                 RTP_HEADER_FLAG_MARKER,
+                                 &( packets[ 0 ] ),
+                                 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedSerializedPacket1 ),
+                       packets[ 0 ].bufferLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedSerializedPacket1[ 0 ] ),
+                                   packets[ 0 ].pBuffer,
+                                   packets[ 0 ].bufferLength );
+    TEST_ASSERT_EQUAL( sizeof( expectedSerializedPacket2 ),
+                       packets[ 1 ].bufferLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedSerializedPacket2[ 0 ] ),
+                                   packets[ 1 ].pBuffer,
+                                   packets[ 1 ].bufferLength );
+    TEST_ASSERT_EQUAL( 0x0001,
+                       senderCtx.nextSequenceNumber );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Rtp_SerializeBatch produces the same output as
+ * Rtp_Serialize.
+ */
+void test_Rtp_SerializeBatch_MatchesSerialize( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpSenderContext_t senderCtx = { 0 };
+    RtpPacket_t packet = { 0 };
+    RtpBatchPacket_t batchPacket = { 0 };
+    size_t rtpBufferLength = RTP_BUFFER_LENGTH;
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packet.header.payloadType = 0x60;
+    packet.header.sequenceNumber = 0x04D2;
+    packet.header.timestamp = 0x12345678;
+    packet.header.ssrc = 0x87654321;
+    packet.payloadLength = 12;
+    packet.pPayload = ( uint8_t * ) "hello world!";
+
+    result = Rtp_Serialize( &( ctx ),
+                            &( packet ),
+                            pRtpBuffer,
+                            &( rtpBufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( packet.header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    batchPacket.pPayload = packet.pPayload;
+    batchPacket.payloadLength = packet.payloadLength;
+    batchPacket.pBuffer = &( pRtpBuffer[ 1000 ] );
+    batchPacket.bufferLength = RTP_BUFFER_LENGTH - 1000;
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 &( senderCtx ),
+                                 packet.header.timestamp,
+                                 0,
+                                 &( batchPacket ),
+                                 1 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( rtpBufferLength,
+                       batchPacket.bufferLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( pRtpBuffer,
+                                   batchPacket.pBuffer,
+                                   rtpBufferLength );
+    TEST_ASSERT_EQUAL( 0x04D3,
+                       senderCtx.nextSequenceNumber );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeBatch with packets without payload.
+ */
+void test_Rtp_SerializeBatch_NoPayload( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpSenderContext_t senderCtx = { 0 };
+    RtpHeader_t header = { 0 };
+    RtpBatchPacket_t batchPacket = { 0 };
+    uint8_t expectedSerializedPacket[] =
+    {
+        /* RTP header: V = 2, X = 1, PT = 0x60, Sequence Number = 0x04D2. */
+        0x90, 0x60, 0x04, 0xD2,
+        /* Timestamp. */
+        0x12, 0x34, 0x56, 0x78,
+        /* SSRC. */
+        0x87, 0x65, 0x43, 0x21,
+        /* Extension profile = 0xABCD, Extension length = 0 words. */
+        0xAB, 0xCD, 0x00, 0x00
+    };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    header.flags = RTP_HEADER_FLAG_EXTENSION;
+    header.payloadType = 0x60;
+    header.sequenceNumber = 0x04D2;
+    header.ssrc = 0x87654321;
+    header.extension.extensionProfile = 0xABCD;
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    batchPacket.pBuffer = pRtpBuffer;
+    batchPacket.bufferLength = sizeof( expectedSerializedPacket );
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 &( senderCtx ),
+                                 0x12345678,
+                                 0,
+                                 &( batchPacket ),
+                                 1 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedSerializedPacket ),
+                       batchPacket.bufferLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedSerializedPacket[ 0 ] ),
+                                   pRtpBuffer,
+                                   batchPacket.bufferLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_InitSenderContext in case of bad parameters.
+ */
+void test_Rtp_InitSenderContext_BadParams( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpSenderContext_t senderCtx = { 0 };
+    RtpHeader_t header = { 0 };
+    uint32_t csrcArray[ 1 ] = { 0x11223344 };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = Rtp_InitSenderContext( NULL,
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    NULL,
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    /* Too many CSRCs. */
+    header.csrcCount = RTP_HEADER_MAX_CSRC_COUNT + 1;
+    header.pCsrc = &( csrcArray[ 0 ] );
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    /* CSRC count without CSRC identifiers. */
+    header.csrcCount = 1;
+    header.pCsrc = NULL;
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    /* Extension length without extension payload. */
+    header.csrcCount = 0;
+    header.flags = RTP_HEADER_FLAG_EXTENSION;
+    header.extension.extensionPayloadLength = 1;
+    header.extension.pExtensionPayload = NULL;
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_InitSenderContext when the extension does not fit in the
+ * header template.
+ */
+void test_Rtp_InitSenderContext_OutOfMemory( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpSenderContext_t senderCtx = { 0 };
+    RtpHeader_t header = { 0 };
+    uint32_t extensionPayload[ RTP_SENDER_MAX_EXTENSION_PAYLOAD_LENGTH + 1 ] = { 0 };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    header.flags = RTP_HEADER_FLAG_EXTENSION;
+    header.extension.extensionPayloadLength = RTP_SENDER_MAX_EXTENSION_PAYLOAD_LENGTH + 1;
+    header.extension.pExtensionPayload = &( extensionPayload[ 0 ] );
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OUT_OF_MEMORY,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeBatch in case of bad parameters.
+ */
+void test_Rtp_SerializeBatch_BadParams( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpSenderContext_t senderCtx = { 0 };
+    RtpHeader_t header = { 0 };
+    RtpBatchPacket_t packets[ 2 ] = { 0 };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    header.sequenceNumber = 0x04D2;
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packets[ 0 ].pBuffer = pRtpBuffer;
+    packets[ 0 ].bufferLength = RTP_BUFFER_LENGTH / 2;
+    packets[ 1 ].pBuffer = &( pRtpBuffer[ RTP_BUFFER_LENGTH / 2 ] );
+    packets[ 1 ].bufferLength = RTP_BUFFER_LENGTH / 2;
+
+    result = Rtp_SerializeBatch( NULL,
+                                 &( senderCtx ),
+                                 0,
+                                 0,
+                                 &( packets[ 0 ] ),
+                                 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 NULL,
+                                 0,
+                                 0,
+                                 &( packets[ 0 ] ),
+                                 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 &( senderCtx ),
+                                 0,
+                                 0,
+                                 NULL,
+                                 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 &( senderCtx ),
+                                 0,
+                                 0,
+                                 &( packets[ 0 ] ),
+                                 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    /* Second packet has no buffer. */
+    packets[ 1 ].pBuffer = NULL;
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 &( senderCtx ),
+                                 0,
+                                 0,
+                                 &( packets[ 0 ] ),
+                                 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    /* Second packet has payload length but no payload. */
+    packets[ 1 ].pBuffer = &( pRtpBuffer[ RTP_BUFFER_LENGTH / 2 ] );
+    packets[ 1 ].payloadLength = 10;
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 &( senderCtx ),
+                                 0,
+                                 0,
+                                 &( packets[ 0 ] ),
+                                 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    /* Nothing must have been written. */
+    TEST_ASSERT_EQUAL( 0x04D2,
+                       senderCtx.nextSequenceNumber );
+    TEST_ASSERT_EQUAL( 0,
+                       pRtpBuffer[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeBatch in case of out of memory - one of the
+ * buffers is smaller than the serialized packet.
+ */
+void test_Rtp_SerializeBatch_OutOfMemory( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpSenderContext_t senderCtx = { 0 };
+    RtpHeader_t header = { 0 };
+    RtpBatchPacket_t packets[ 2 ] = { 0 };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    header.sequenceNumber = 0x04D2;
+
+    result = Rtp_InitSenderContext( &( ctx ),
+                                    &( senderCtx ),
+                                    &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packets[ 0 ].pPayload = ( uint8_t * ) "hello world!";
+    packets[ 0 ].payloadLength = 12;
+    packets[ 0 ].pBuffer = pRtpBuffer;
+    packets[ 0 ].bufferLength = RTP_BUFFER_LENGTH / 2;
+    packets[ 1 ].pPayload = ( uint8_t * ) "hello world!";
+    packets[ 1 ].payloadLength = 12;
+    packets[ 1 ].pBuffer = &( pRtpBuffer[ RTP_BUFFER_LENGTH / 2 ] );
+    packets[ 1 ].bufferLength = RTP_HEADER_MIN_LENGTH + 11;
+
+    result = Rtp_SerializeBatch( &( ctx ),
+                                 &( senderCtx ),
+                                 0,
+                                 0,
+                                 &( packets[ 0 ] ),
+                                 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OUT_OF_MEMORY,
+                       result );
+    TEST_ASSERT_EQUAL( 0x04D2,
+                       senderCtx.nextSequenceNumber );
+    TEST_ASSERT_EQUAL( 0,
+                       pRtpBuffer[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeIoVec in case of valid inputs.
+ */
+void test_Rtp_SerializeIoVec_Pass( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacket_t packet = { 0 };
+    RtpIoVec_t ioVec[ RTP_IOVEC_COUNT ] = { 0 };
+    uint32_t csrcArray[ 1 ] = { 0x11223344 };
+    uint8_t rtpPayload[] =
+    {
+        0x12, 0x34, 0x56, 0x78,
+        0x9A, 0xBC, 0x00, 0x02
+    };
+    uint8_t expectedSerializedHeader[] =
+    {
+        /* RTP header: V = 2, P = 1, CSRC Count = 1, M = 1, PT = 0x60, Sequence Number = 0x04D2. */
+        0xA1, 0xE0, 0x04, 0xD2,
+        /* Timestamp. */
+        0x12, 0x34, 0x56, 0x78,
+        /* SSRC. */
+        0x87, 0x65, 0x43, 0x21,
+        /* CSRC identifier. */
+        0x11, 0x22, 0x33, 0x44
+    };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packet.header.flags = RTP_HEADER_FLAG_PADDING | RTP_HEADER_FLAG_MARKER;
+    packet.header.payloadType = 0x60;
+    packet.header.sequenceNumber = 0x04D2;
+    packet.header.timestamp = 0x12345678;
+    packet.header.ssrc = 0x87654321;
+    packet.header.csrcCount = 1;
+    packet.header.pCsrc = &( csrcArray[ 0 ] );
+    packet.pPayload = &( rtpPayload[ 0 ] );
+    packet.payloadLength = sizeof( rtpPayload );
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 sizeof( expectedSerializedHeader ),
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( pRtpBuffer,
+                       ioVec[ RTP_IOVEC_HEADER_INDEX ].pBase );
+    TEST_ASSERT_EQUAL( sizeof( expectedSerializedHeader ),
+                       ioVec[ RTP_IOVEC_HEADER_INDEX ].length );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedSerializedHeader[ 0 ] ),
+                                   pRtpBuffer,
+                                   sizeof( expectedSerializedHeader ) );
+    TEST_ASSERT_EQUAL( &( rtpPayload[ 0 ] ),
+                       ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].pBase );
+    TEST_ASSERT_EQUAL( sizeof( rtpPayload ),
+                       ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].length );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the I/O vectors from Rtp_SerializeIoVec contain the same
+ * bytes as the buffer from Rtp_Serialize.
+ */
+void test_Rtp_SerializeIoVec_MatchesSerialize( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacket_t packet = { 0 };
+    RtpIoVec_t ioVec[ RTP_IOVEC_COUNT ] = { 0 };
+    size_t rtpBufferLength = RTP_BUFFER_LENGTH / 2;
+    uint8_t * pHeaderBuffer = &( pRtpBuffer[ RTP_BUFFER_LENGTH / 2 ] );
+    uint32_t extensionPayload[ 2 ] = { 0x11223344, 0x55667788 };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packet.header.flags = RTP_HEADER_FLAG_EXTENSION;
+    packet.header.payloadType = 0x60;
+    packet.header.sequenceNumber = 0x04D2;
+    packet.header.timestamp = 0x12345678;
+    packet.header.ssrc = 0x87654321;
+    packet.header.extension.extensionProfile = 0xABCD;
+    packet.header.extension.extensionPayloadLength = 2;
+    packet.header.extension.pExtensionPayload = &( extensionPayload[ 0 ] );
+    packet.payloadLength = 12;
+    packet.pPayload = ( uint8_t * ) "hello world!";
+
+    result = Rtp_Serialize( &( ctx ),
+                            &( packet ),
+                            pRtpBuffer,
+                            &( rtpBufferLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pHeaderBuffer,
+                                 RTP_BUFFER_LENGTH / 2,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( rtpBufferLength,
+                       ioVec[ RTP_IOVEC_HEADER_INDEX ].length +
+                       ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].length );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( pRtpBuffer,
+                                   ioVec[ RTP_IOVEC_HEADER_INDEX ].pBase,
+                                   ioVec[ RTP_IOVEC_HEADER_INDEX ].length );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( pRtpBuffer[ ioVec[ RTP_IOVEC_HEADER_INDEX ].length ] ),
+                                   ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].pBase,
+                                   ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].length );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeIoVec with no payload data.
+ */
+void test_Rtp_SerializeIoVec_NoPayload( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacket_t packet = { 0 };
+    RtpIoVec_t ioVec[ RTP_IOVEC_COUNT ] = { 0 };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packet.header.payloadType = 0x60;
+    packet.header.sequenceNumber = 0x04D2;
+    packet.header.timestamp = 0x12345678;
+    packet.header.ssrc = 0x87654321;
+    packet.pPayload = ( uint8_t * ) "hello world!";
+    packet.payloadLength = 0;
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 RTP_HEADER_MIN_LENGTH,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_HEADER_MIN_LENGTH,
+                       ioVec[ RTP_IOVEC_HEADER_INDEX ].length );
+    TEST_ASSERT_NULL( ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].pBase );
+    TEST_ASSERT_EQUAL( 0,
+                       ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].length );
+
+    packet.pPayload = NULL;
+    packet.payloadLength = 12;
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 RTP_HEADER_MIN_LENGTH,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_NULL( ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].pBase );
+    TEST_ASSERT_EQUAL( 0,
+                       ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].length );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeIoVec in case of bad parameters.
+ */
+void test_Rtp_SerializeIoVec_BadParams( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacket_t packet = { 0 };
+    RtpIoVec_t ioVec[ RTP_IOVEC_COUNT ] = { 0 };
+
+    result = Rtp_SerializeIoVec( NULL,
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 RTP_BUFFER_LENGTH,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 NULL,
+                                 pRtpBuffer,
+                                 RTP_BUFFER_LENGTH,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 NULL,
+                                 RTP_BUFFER_LENGTH,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 RTP_BUFFER_LENGTH,
+                                 NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeIoVec when the header buffer is too small and
+ * when the padding length is invalid.
+ */
+void test_Rtp_SerializeIoVec_OutOfMemoryAndMalformed( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacket_t packet = { 0 };
+    RtpIoVec_t ioVec[ RTP_IOVEC_COUNT ] = { 0 };
+    uint8_t rtpPayload[] =
+    {
+        /* RTP payload with 3 padding bytes. The last byte contains incorrect
+         * padding length. */
+        0x12, 0x00, 0x00, 0x05
+    };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packet.header.payloadType = 0x60;
+    packet.header.sequenceNumber = 0x04D2;
+    packet.header.timestamp = 0x12345678;
+    packet.header.ssrc = 0x87654321;
+    packet.pPayload = &( rtpPayload[ 0 ] );
+    packet.payloadLength = sizeof( rtpPayload );
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 RTP_HEADER_MIN_LENGTH - 1,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    packet.header.flags = RTP_HEADER_FLAG_PADDING;
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 RTP_HEADER_MIN_LENGTH,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_DeSerializeView with CSRCs, extension and padding, and
+ * verify that the serialized packet is not modified.
+ */
+void test_Rtp_DeSerializeView_Pass( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacketView_t view = { 0 };
+    uint32_t word;
+    const uint8_t serializedPacket[] =
+    {
+        0xB2, 0xE0, 0x04, 0xD2, /* Header: V=2, P=1, X=1, CC=2, M=1, PT=96, SequenceNum=1234. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21, /* SSRC. */
+        0x11, 0x11, 0x11, 0x11, /* CSRC 1. */
+        0x22, 0x22, 0x22, 0x22, /* CSRC 2. */
+        0xBE, 0xDE, 0x00, 0x01, /* Extension header. */
+        0xAA, 0xBB, 0xCC, 0xDD, /* Extension payload. */
+        0x12, 0x34, 0x00, 0x02  /* Payload with 2 padding bytes. */
+    };
+    uint8_t serializedPacketCopy[ sizeof( serializedPacket ) ];
+
+    memcpy( &( serializedPacketCopy[ 0 ] ),
+            &( serializedPacket[ 0 ] ),
+            sizeof( serializedPacket ) );
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( serializedPacket[ 0 ] ),
+                                  sizeof( serializedPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_HEADER_FLAG_PADDING |
+                       RTP_HEADER_FLAG_EXTENSION |
+                       RTP_HEADER_FLAG_MARKER,
+                       view.flags );
+    TEST_ASSERT_EQUAL( 2,
+                       view.csrcCount );
+    TEST_ASSERT_EQUAL( 0x60,
+                       view.payloadType );
+    TEST_ASSERT_EQUAL( 0x04D2,
+                       view.sequenceNumber );
+    TEST_ASSERT_EQUAL( 0x12345678,
+                       view.timestamp );
+    TEST_ASSERT_EQUAL( 0x87654321,
+                       view.ssrc );
+    TEST_ASSERT_EQUAL( 0xBEDE,
+                       view.extensionProfile );
+    TEST_ASSERT_EQUAL( 1,
+                       view.extensionPayloadLength );
+    TEST_ASSERT_EQUAL_PTR( &( serializedPacket[ 28 ] ),
+                           view.pPayload );
+    TEST_ASSERT_EQUAL( 2,
+                       view.payloadLength );
+
+    result = Rtp_GetCsrc( &( ctx ),
+                          &( view ),
+                          0,
+                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0x11111111,
+                       word );
+
+    result = Rtp_GetCsrc( &( ctx ),
+                          &( view ),
+                          1,
+                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0x22222222,
+                       word );
+
+    result = Rtp_GetExtensionPayloadWord( &( ctx ),
+                                          &( view ),
+                                          0,
+                                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0xAABBCCDD,
+                       word );
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( serializedPacketCopy[ 0 ] ),
+                                   &( serializedPacket[ 0 ] ),
+                                   sizeof( serializedPacket ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_DeSerializeView with a header only packet.
+ */
+void test_Rtp_DeSerializeView_NoPayload( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacketView_t view = { 0 };
+    const uint8_t serializedPacket[] =
+    {
+        0x80, 0x60, 0x04, 0xD2, /* Header: V=2, P=0, X=0, CC=0, M=0, PT=96, SequenceNum=1234. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( serializedPacket[ 0 ] ),
+                                  sizeof( serializedPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       view.flags );
+    TEST_ASSERT_EQUAL( 0,
+                       view.csrcCount );
+    TEST_ASSERT_NULL( view.pCsrc );
+    TEST_ASSERT_NULL( view.pExtensionPayload );
+    TEST_ASSERT_NULL( view.pPayload );
+    TEST_ASSERT_EQUAL( 0,
+                       view.payloadLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_DeSerializeView with malformed packets.
+ */
+void test_Rtp_DeSerializeView_Malformed( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacketView_t view = { 0 };
+    const uint8_t wrongVersionPacket[] =
+    {
+        0x40, 0x60, 0x04, 0xD2, /* Header: V=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+    const uint8_t missingCsrcPacket[] =
+    {
+        0x81, 0x60, 0x04, 0xD2, /* Header: V=2, CC=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+    const uint8_t missingExtensionHeaderPacket[] =
+    {
+        0x90, 0x60, 0x04, 0xD2, /* Header: V=2, X=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+    const uint8_t missingExtensionPayloadPacket[] =
+    {
+        0x90, 0x60, 0x04, 0xD2, /* Header: V=2, X=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21, /* SSRC. */
+        0xBE, 0xDE, 0x00, 0x02, /* Extension header. */
+        0xAA, 0xBB, 0xCC, 0xDD  /* Extension payload - one word short. */
+    };
+    const uint8_t wrongPaddingPacket[] =
+    {
+        0xA0, 0x60, 0x04, 0xD2, /* Header: V=2, P=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21, /* SSRC. */
+        0x12, 0x00, 0x00, 0x05  /* Payload - padding length too large. */
+    };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( wrongVersionPacket[ 0 ] ),
+                                  sizeof( wrongVersionPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_WRONG_VERSION,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( missingCsrcPacket[ 0 ] ),
+                                  sizeof( missingCsrcPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( missingExtensionHeaderPacket[ 0 ] ),
+                                  sizeof( missingExtensionHeaderPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( missingExtensionPayloadPacket[ 0 ] ),
+                                  sizeof( missingExtensionPayloadPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( wrongPaddingPacket[ 0 ] ),
+                                  sizeof( wrongPaddingPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_DeSerializeView and the accessors with bad parameters.
+ */
+void test_Rtp_DeSerializeView_BadParams( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacketView_t view = { 0 };
+    uint32_t word;
+    const uint8_t serializedPacket[] =
+    {
+        0x91, 0x60, 0x04, 0xD2, /* Header: V=2, X=1, CC=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21, /* SSRC. */
+        0x11, 0x11, 0x11, 0x11, /* CSRC. */
+        0xBE, 0xDE, 0x00, 0x01, /* Extension header. */
+        0xAA, 0xBB, 0xCC, 0xDD  /* Extension payload. */
+    };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = Rtp_DeSerializeView( NULL,
+                                  &( serializedPacket[ 0 ] ),
+                                  sizeof( serializedPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  NULL,
+                                  sizeof( serializedPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( serializedPacket[ 0 ] ),
+                                  RTP_HEADER_MIN_LENGTH - 1,
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( serializedPacket[ 0 ] ),
+                                  sizeof( serializedPacket ),
+                                  NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_DeSerializeView( &( ctx ),
+                                  &( serializedPacket[ 0 ] ),
+                                  sizeof( serializedPacket ),
+                                  &( view ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = Rtp_GetCsrc( NULL,
+                          &( view ),
+                          0,
+                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_GetCsrc( &( ctx ),
+                          NULL,
+                          0,
+                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_GetCsrc( &( ctx ),
+                          &( view ),
+                          1,
+                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_GetCsrc( &( ctx ),
+                          &( view ),
+                          0,
+                          NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_GetExtensionPayloadWord( NULL,
+                                          &( view ),
+                                          0,
+                                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_GetExtensionPayloadWord( &( ctx ),
+                                          NULL,
+                                          0,
+                                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_GetExtensionPayloadWord( &( ctx ),
+                                          &( view ),
+                                          1,
+                                          &( word ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_GetExtensionPayloadWord( &( ctx ),
+                                          &( view ),
+                                          0,
+                                          NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_SerializeIoVec with padding flag set and no payload.
+ */
+void test_Rtp_SerializeIoVec_PaddingFlagNoPayload( void )
+{
+    RtpResult_t result;
+    RtpContext_t ctx = { 0 };
+    RtpPacket_t packet = { 0 };
+    RtpIoVec_t ioVec[ RTP_IOVEC_COUNT ] = { 0 };
+    uint8_t payload[] = { 0x00 };
+
+    result = Rtp_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    packet.header.flags = RTP_HEADER_FLAG_PADDING;
+    packet.header.payloadType = 0x60;
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 RTP_BUFFER_LENGTH,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_HEADER_MIN_LENGTH,
+                       ioVec[ RTP_IOVEC_HEADER_INDEX ].length );
+    TEST_ASSERT_EQUAL( 0,
+                       ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].length );
+
+    packet.pPayload = &( payload[ 0 ] );
+    packet.payloadLength = 0;
+
+    result = Rtp_SerializeIoVec( &( ctx ),
+                                 &( packet ),
+                                 pRtpBuffer,
+                                 RTP_BUFFER_LENGTH,
+                                 &( ioVec[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       ioVec[ RTP_IOVEC_PAYLOAD_INDEX ].length );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the inline network byte order read/write helpers at
+ * unaligned offsets.
+ */
+void test_Rtp_ReadWriteUint_Unaligned( void )
+{
+    uint8_t buffer[ 9 ] = { 0 };
+    uint8_t expectedUint16[] = { 0x00, 0x12, 0x34 };
+    uint8_t expectedUint32[] = { 0x00, 0x12, 0x34, 0x56, 0x78 };
+    uint8_t expectedUint64[] = { 0x00, 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF };
+
+    Rtp_WriteUint16( &( buffer[ 1 ] ),
+                     0x1234 );
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedUint16[ 0 ] ),
+                                   &( buffer[ 0 ] ),
+                                   sizeof( expectedUint16 ) );
+    TEST_ASSERT_EQUAL( 0x1234,
+                       Rtp_ReadUint16( &( buffer[ 1 ] ) ) );
+
+    Rtp_WriteUint32( &( buffer[ 1 ] ),
+                     0x12345678 );
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedUint32[ 0 ] ),
+                                   &( buffer[ 0 ] ),
+                                   sizeof( expectedUint32 ) );
+    TEST_ASSERT_EQUAL( 0x12345678,
+                       Rtp_ReadUint32( &( buffer[ 1 ] ) ) );
+
+    Rtp_WriteUint64( &( buffer[ 1 ] ),
+                     0x0123456789ABCDEFULL );
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedUint64[ 0 ] ),
+                                   &( buffer[ 0 ] ),
+                                   sizeof( expectedUint64 ) );
+    TEST_ASSERT_TRUE( Rtp_ReadUint64( &( buffer[ 1 ] ) ) == 0x0123456789ABCDEFULL );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the compatibility read/write function table.
+ */
+void test_Rtp_InitReadWriteFunctions( void )
+{
+    RtpReadWriteFunctions_t readWriteFunctions = { 0 };
+    uint8_t buffer[ 5 ] = { 0 };
+    uint8_t expected[] = { 0x00, 0x12, 0x34, 0x56, 0x78 };
+
+    Rtp_InitReadWriteFunctions( &( readWriteFunctions ) );
+
+    readWriteFunctions.writeUint32Fn( &( buffer[ 1 ] ),
+                                      0x12345678 );
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expected[ 0 ] ),
+                                   &( buffer[ 0 ] ),
+                                   sizeof( expected ) );
+    TEST_ASSERT_EQUAL( 0x12345678,
+                       readWriteFunctions.readUint32Fn( &( buffer[ 1 ] ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_PeekHeader, Rtp_PeekPayloadOffset and Rtp_PeekSsrc with
+ * a packet containing CSRCs, extension and padding.
+ */
+void test_Rtp_PeekHeader_Pass( void )
+{
+    RtpResult_t result;
+    RtpFixedHeader_t header = { 0 };
+    size_t payloadOffset = 0, payloadLength = 0;
+    uint32_t ssrc = 0;
+    const uint8_t serializedPacket[] =
+    {
+        0xB1, 0xE0, 0x04, 0xD2, /* Header: V=2, P=1, X=1, CC=1, M=1, PT=96, SequenceNum=1234. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21, /* SSRC. */
+        0x11, 0x11, 0x11, 0x11, /* CSRC. */
+        0xBE, 0xDE, 0x00, 0x01, /* Extension header. */
+        0xAA, 0xBB, 0xCC, 0xDD, /* Extension payload. */
+        0x12, 0x34, 0x00, 0x02  /* Payload with 2 padding bytes. */
+    };
+
+    result = Rtp_PeekHeader( &( serializedPacket[ 0 ] ),
+                             sizeof( serializedPacket ),
+                             &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_HEADER_FLAG_PADDING |
+                       RTP_HEADER_FLAG_EXTENSION |
+                       RTP_HEADER_FLAG_MARKER,
+                       header.flags );
+    TEST_ASSERT_EQUAL( 1,
+                       header.csrcCount );
+    TEST_ASSERT_EQUAL( 0x60,
+                       header.payloadType );
+    TEST_ASSERT_EQUAL( 0x04D2,
+                       header.sequenceNumber );
+    TEST_ASSERT_EQUAL( 0x12345678,
+                       header.timestamp );
+    TEST_ASSERT_EQUAL( 0x87654321,
+                       header.ssrc );
+
+    memset( &( header ),
+            0,
+            sizeof( header ) );
+
+    result = Rtp_PeekPayloadOffset( &( serializedPacket[ 0 ] ),
+                                    sizeof( serializedPacket ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0x87654321,
+                       header.ssrc );
+    TEST_ASSERT_EQUAL( 24,
+                       payloadOffset );
+    TEST_ASSERT_EQUAL( 2,
+                       payloadLength );
+
+    result = Rtp_PeekSsrc( &( serializedPacket[ 0 ] ),
+                           sizeof( serializedPacket ),
+                           &( ssrc ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0x87654321,
+                       ssrc );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_PeekPayloadOffset with packets without payload.
+ */
+void test_Rtp_PeekPayloadOffset_NoPayload( void )
+{
+    RtpResult_t result;
+    RtpFixedHeader_t header = { 0 };
+    size_t payloadOffset = 0, payloadLength = 1;
+    const uint8_t serializedPacket[] =
+    {
+        0xA0, 0x60, 0x04, 0xD2, /* Header: V=2, P=1, X=0, CC=0, M=0, PT=96, SequenceNum=1234. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+    const uint8_t serializedPacketNoPadding[] =
+    {
+        0x80, 0x60, 0x04, 0xD2, /* Header: V=2, P=0, X=0, CC=0, M=0, PT=96, SequenceNum=1234. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+
+    result = Rtp_PeekPayloadOffset( &( serializedPacket[ 0 ] ),
+                                    sizeof( serializedPacket ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_HEADER_FLAG_PADDING,
+                       header.flags );
+    TEST_ASSERT_EQUAL( 12,
+                       payloadOffset );
+    TEST_ASSERT_EQUAL( 0,
+                       payloadLength );
+
+    result = Rtp_PeekPayloadOffset( &( serializedPacketNoPadding[ 0 ] ),
+                                    sizeof( serializedPacketNoPadding ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       header.flags );
+    TEST_ASSERT_EQUAL( 12,
+                       payloadOffset );
+    TEST_ASSERT_EQUAL( 0,
+                       payloadLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_PeekHeader and Rtp_PeekPayloadOffset with malformed
+ * packets.
+ */
+void test_Rtp_PeekHeader_Malformed( void )
+{
+    RtpResult_t result;
+    RtpFixedHeader_t header = { 0 };
+    size_t payloadOffset = 0, payloadLength = 0;
+    const uint8_t wrongVersionPacket[] =
+    {
+        0x40, 0x60, 0x04, 0xD2, /* Header: V=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+    const uint8_t missingCsrcPacket[] =
+    {
+        0x81, 0x60, 0x04, 0xD2, /* Header: V=2, CC=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+    const uint8_t missingExtensionHeaderPacket[] =
+    {
+        0x90, 0x60, 0x04, 0xD2, /* Header: V=2, X=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+    const uint8_t missingExtensionPayloadPacket[] =
+    {
+        0x90, 0x60, 0x04, 0xD2, /* Header: V=2, X=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21, /* SSRC. */
+        0xBE, 0xDE, 0x00, 0x01  /* Extension header without payload. */
+    };
+    const uint8_t wrongPaddingPacket[] =
+    {
+        0xA0, 0x60, 0x04, 0xD2, /* Header: V=2, P=1. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21, /* SSRC. */
+        0x12, 0x00, 0x00, 0x05  /* Payload - padding length too large. */
+    };
+
+    result = Rtp_PeekHeader( &( wrongVersionPacket[ 0 ] ),
+                             sizeof( wrongVersionPacket ),
+                             &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_WRONG_VERSION,
+                       result );
+
+    result = Rtp_PeekPayloadOffset( &( wrongVersionPacket[ 0 ] ),
+                                    sizeof( wrongVersionPacket ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_WRONG_VERSION,
+                       result );
+
+    result = Rtp_PeekPayloadOffset( &( missingCsrcPacket[ 0 ] ),
+                                    sizeof( missingCsrcPacket ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = Rtp_PeekPayloadOffset( &( missingExtensionHeaderPacket[ 0 ] ),
+                                    sizeof( missingExtensionHeaderPacket ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = Rtp_PeekPayloadOffset( &( missingExtensionPayloadPacket[ 0 ] ),
+                                    sizeof( missingExtensionPayloadPacket ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = Rtp_PeekPayloadOffset( &( wrongPaddingPacket[ 0 ] ),
+                                    sizeof( wrongPaddingPacket ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Rtp_PeekHeader, Rtp_PeekPayloadOffset and Rtp_PeekSsrc in
+ * case of bad parameters.
+ */
+void test_Rtp_PeekHeader_BadParams( void )
+{
+    RtpResult_t result;
+    RtpFixedHeader_t header = { 0 };
+    size_t payloadOffset = 0, payloadLength = 0;
+    uint32_t ssrc = 0;
+    const uint8_t serializedPacket[] =
+    {
+        0x80, 0x60, 0x04, 0xD2, /* Header: V=2, P=0, X=0, CC=0, M=0, PT=96, SequenceNum=1234. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21  /* SSRC. */
+    };
+
+    result = Rtp_PeekHeader( NULL,
+                             sizeof( serializedPacket ),
+                             &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_PeekHeader( &( serializedPacket[ 0 ] ),
+                             sizeof( serializedPacket ) - 1,
+                             &( header ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_PeekHeader( &( serializedPacket[ 0 ] ),
+                             sizeof( serializedPacket ),
+                             NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_PeekPayloadOffset( &( serializedPacket[ 0 ] ),
+                                    sizeof( serializedPacket ),
+                                    &( header ),
+                                    NULL,
+                                    &( payloadLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_PeekPayloadOffset( &( serializedPacket[ 0 ] ),
+                                    sizeof( serializedPacket ),
+                                    &( header ),
+                                    &( payloadOffset ),
+                                    NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_PeekSsrc( NULL,
+                           sizeof( serializedPacket ),
+                           &( ssrc ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_PeekSsrc( &( serializedPacket[ 0 ] ),
+                           sizeof( serializedPacket ) - 1,
+                           &( ssrc ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+
+    result = Rtp_PeekSsrc( &( serializedPacket[ 0 ] ),
+                           sizeof( serializedPacket ),
+                           NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,410 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_batch_parser.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_BATCH_PACKETS 8
+
+uint16_t sequenceNumbers[ MAX_BATCH_PACKETS ];
+uint32_t timestamps[ MAX_BATCH_PACKETS ];
+uint32_t ssrcs[ MAX_BATCH_PACKETS ];
+uint8_t payloadTypes[ MAX_BATCH_PACKETS ];
+uint8_t markers[ MAX_BATCH_PACKETS ];
+size_t payloadOffsets[ MAX_BATCH_PACKETS ];
+RtpBatchHeaders_t batchHeaders;
+
+void setUp( void )
+{
+    memset( &( sequenceNumbers[ 0 ] ), 0xFF, sizeof( sequenceNumbers ) );
+    memset( &( timestamps[ 0 ] ), 0xFF, sizeof( timestamps ) );
+    memset( &( ssrcs[ 0 ] ), 0xFF, sizeof( ssrcs ) );
+    memset( &( payloadTypes[ 0 ] ), 0xFF, sizeof( payloadTypes ) );
+    memset( &( markers[ 0 ] ), 0xFF, sizeof( markers ) );
+    memset( &( payloadOffsets[ 0 ] ), 0xFF, sizeof( payloadOffsets ) );
+
+    batchHeaders.pSequenceNumber = &( sequenceNumbers[ 0 ] );
+    batchHeaders.pTimestamp = &( timestamps[ 0 ] );
+    batchHeaders.pSsrc = &( ssrcs[ 0 ] );
+    batchHeaders.pPayloadType = &( payloadTypes[ 0 ] );
+    batchHeaders.pMarker = &( markers[ 0 ] );
+    batchHeaders.pPayloadOffset = &( payloadOffsets[ 0 ] );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpBatchParser_ParseHeaders with a batch of valid packets of
+ * different layouts.
+ */
+void test_RtpBatchParser_ParseHeaders_Pass( void )
+{
+    RtpBatchParserResult_t result;
+    size_t validPacketCount = 0;
+    const uint8_t packet1[] =
+    {
+        0x80, 0xE0, 0x04, 0xD2, /* Header: V=2, P=0, X=0, CC=0, M=1, PT=96, SequenceNum=1234. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x87, 0x65, 0x43, 0x21, /* SSRC. */
+        0xAA, 0xBB, 0xCC, 0xDD  /* Payload. */
+    };
+    const uint8_t packet2[] =
+    {
+        0x81, 0x08, 0xFF, 0xFF, /* Header: V=2, P=0, X=0, CC=1, M=0, PT=8, SequenceNum=65535. */
+        0x00, 0x00, 0x00, 0x01, /* Timestamp. */
+        0x11, 0x22, 0x33, 0x44, /* SSRC. */
+        0x55, 0x55, 0x55, 0x55, /* CSRC. */
+        0xAA                    /* Payload. */
+    };
+    const uint8_t packet3[] =
+    {
+        0x90, 0x6F, 0x00, 0x01, /* Header: V=2, P=0, X=1, CC=0, M=0, PT=111, SequenceNum=1. */
+        0xFF, 0xFF, 0xFF, 0xFF, /* Timestamp. */
+        0x01, 0x02, 0x03, 0x04, /* SSRC. */
+        0xBE, 0xDE, 0x00, 0x01, /* Extension header. */
+        0x10, 0xFF, 0x00, 0x00  /* Extension payload. */
+    };
+    const uint8_t packet4[] =
+    {
+        0x80, 0x60, 0x00, 0x02, /* Header: V=2, P=0, X=0, CC=0, M=0, PT=96, SequenceNum=2. */
+        0x00, 0x00, 0x10, 0x00, /* Timestamp. */
+        0xCA, 0xFE, 0xBA, 0xBE  /* SSRC. */
+    };
+    const uint8_t * packets[] = { &( packet1[ 0 ] ), &( packet2[ 0 ] ), &( packet3[ 0 ] ), &( packet4[ 0 ] ) };
+    size_t packetLengths[] = { sizeof( packet1 ), sizeof( packet2 ), sizeof( packet3 ), sizeof( packet4 ) };
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          4,
+                                          &( batchHeaders ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4,
+                       validPacketCount );
+
+    TEST_ASSERT_EQUAL( 1234,
+                       sequenceNumbers[ 0 ] );
+    TEST_ASSERT_EQUAL( 0x12345678,
+                       timestamps[ 0 ] );
+    TEST_ASSERT_EQUAL( 0x87654321,
+                       ssrcs[ 0 ] );
+    TEST_ASSERT_EQUAL( 96,
+                       payloadTypes[ 0 ] );
+    TEST_ASSERT_EQUAL( 1,
+                       markers[ 0 ] );
+    TEST_ASSERT_EQUAL( 12,
+                       payloadOffsets[ 0 ] );
+
+    TEST_ASSERT_EQUAL( 65535,
+                       sequenceNumbers[ 1 ] );
+    TEST_ASSERT_EQUAL( 1,
+                       timestamps[ 1 ] );
+    TEST_ASSERT_EQUAL( 0x11223344,
+                       ssrcs[ 1 ] );
+    TEST_ASSERT_EQUAL( 8,
+                       payloadTypes[ 1 ] );
+    TEST_ASSERT_EQUAL( 0,
+                       markers[ 1 ] );
+    TEST_ASSERT_EQUAL( 16,
+                       payloadOffsets[ 1 ] );
+
+    TEST_ASSERT_EQUAL( 1,
+                       sequenceNumbers[ 2 ] );
+    TEST_ASSERT_EQUAL( 0xFFFFFFFF,
+                       timestamps[ 2 ] );
+    TEST_ASSERT_EQUAL( 0x01020304,
+                       ssrcs[ 2 ] );
+    TEST_ASSERT_EQUAL( 111,
+                       payloadTypes[ 2 ] );
+    TEST_ASSERT_EQUAL( 0,
+                       markers[ 2 ] );
+    TEST_ASSERT_EQUAL( 20,
+                       payloadOffsets[ 2 ] );
+
+    TEST_ASSERT_EQUAL( 2,
+                       sequenceNumbers[ 3 ] );
+    TEST_ASSERT_EQUAL( 0x1000,
+                       timestamps[ 3 ] );
+    TEST_ASSERT_EQUAL( 0xCAFEBABE,
+                       ssrcs[ 3 ] );
+    TEST_ASSERT_EQUAL( 96,
+                       payloadTypes[ 3 ] );
+    TEST_ASSERT_EQUAL( 0,
+                       markers[ 3 ] );
+    TEST_ASSERT_EQUAL( 12,
+                       payloadOffsets[ 3 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RtpBatchParser_ParseHeaders marks malformed packets
+ * invalid without affecting the valid packets in the same batch.
+ */
+void test_RtpBatchParser_ParseHeaders_InvalidPackets( void )
+{
+    RtpBatchParserResult_t result;
+    size_t i, validPacketCount = 0;
+    const uint8_t validPacket[] =
+    {
+        0x80, 0x60, 0x00, 0x07, /* Header: V=2, P=0, X=0, CC=0, M=0, PT=96, SequenceNum=7. */
+        0x00, 0x00, 0x00, 0x09, /* Timestamp. */
+        0x00, 0x00, 0x00, 0x0A, /* SSRC. */
+        0xAA, 0xBB, 0xCC, 0xDD  /* Payload. */
+    };
+    const uint8_t wrongVersionPacket[] =
+    {
+        0x40, 0x60, 0x00, 0x07, /* Header: V=1. */
+        0x00, 0x00, 0x00, 0x09, /* Timestamp. */
+        0x00, 0x00, 0x00, 0x0A, /* SSRC. */
+        0xAA, 0xBB, 0xCC, 0xDD  /* Payload. */
+    };
+    const uint8_t missingCsrcPacket[] =
+    {
+        0x85, 0x60, 0x00, 0x07, /* Header: V=2, CC=5. */
+        0x00, 0x00, 0x00, 0x09, /* Timestamp. */
+        0x00, 0x00, 0x00, 0x0A, /* SSRC. */
+        0xAA, 0xBB, 0xCC, 0xDD  /* Only one CSRC. */
+    };
+    const uint8_t missingExtensionHeaderPacket[] =
+    {
+        0x91, 0x60, 0x00, 0x07, /* Header: V=2, X=1, CC=1. */
+        0x00, 0x00, 0x00, 0x09, /* Timestamp. */
+        0x00, 0x00, 0x00, 0x0A, /* SSRC. */
+        0xAA, 0xBB, 0xCC, 0xDD  /* CSRC. */
+    };
+    const uint8_t missingExtensionPayloadPacket[] =
+    {
+        0x90, 0x60, 0x00, 0x07, /* Header: V=2, X=1. */
+        0x00, 0x00, 0x00, 0x09, /* Timestamp. */
+        0x00, 0x00, 0x00, 0x0A, /* SSRC. */
+        0xBE, 0xDE, 0x00, 0x02, /* Extension header. */
+        0x10, 0xFF, 0x00, 0x00  /* Only one word of extension payload. */
+    };
+    const uint8_t * packets[] =
+    {
+        &( validPacket[ 0 ] ),
+        &( wrongVersionPacket[ 0 ] ),
+        &( missingCsrcPacket[ 0 ] ),
+        &( missingExtensionHeaderPacket[ 0 ] ),
+        &( missingExtensionPayloadPacket[ 0 ] ),
+        &( validPacket[ 0 ] ),
+        NULL,
+        &( validPacket[ 0 ] )
+    };
+    size_t packetLengths[] =
+    {
+        sizeof( validPacket ),
+        sizeof( wrongVersionPacket ),
+        sizeof( missingCsrcPacket ),
+        sizeof( missingExtensionHeaderPacket ),
+        sizeof( missingExtensionPayloadPacket ),
+        11, /* Shorter than the fixed header. */
+        sizeof( validPacket ),
+        sizeof( validPacket )
+    };
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          MAX_BATCH_PACKETS,
+                                          &( batchHeaders ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       validPacketCount );
+
+    for( i = 0; i < MAX_BATCH_PACKETS; i++ )
+    {
+        if( ( i == 0 ) || ( i == 7 ) )
+        {
+            TEST_ASSERT_EQUAL( 7,
+                               sequenceNumbers[ i ] );
+            TEST_ASSERT_EQUAL( 9,
+                               timestamps[ i ] );
+            TEST_ASSERT_EQUAL( 10,
+                               ssrcs[ i ] );
+            TEST_ASSERT_EQUAL( 96,
+                               payloadTypes[ i ] );
+            TEST_ASSERT_EQUAL( 12,
+                               payloadOffsets[ i ] );
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL( 0,
+                               sequenceNumbers[ i ] );
+            TEST_ASSERT_EQUAL( 0,
+                               timestamps[ i ] );
+            TEST_ASSERT_EQUAL( 0,
+                               ssrcs[ i ] );
+            TEST_ASSERT_EQUAL( 0,
+                               payloadTypes[ i ] );
+            TEST_ASSERT_EQUAL( 0,
+                               markers[ i ] );
+            TEST_ASSERT_EQUAL( 0,
+                               payloadOffsets[ i ] );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpBatchParser_ParseHeaders with an empty batch.
+ */
+void test_RtpBatchParser_ParseHeaders_EmptyBatch( void )
+{
+    RtpBatchParserResult_t result;
+    size_t validPacketCount = 1;
+    const uint8_t * packets[ 1 ] = { NULL };
+    size_t packetLengths[ 1 ] = { 0 };
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          0,
+                                          &( batchHeaders ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       validPacketCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpBatchParser_ParseHeaders in case of bad parameters.
+ */
+void test_RtpBatchParser_ParseHeaders_BadParams( void )
+{
+    RtpBatchParserResult_t result;
+    size_t validPacketCount = 0;
+    const uint8_t * packets[ 1 ] = { NULL };
+    size_t packetLengths[ 1 ] = { 0 };
+    RtpBatchHeaders_t headers;
+
+    result = RtpBatchParser_ParseHeaders( NULL,
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          &( batchHeaders ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          NULL,
+                                          1,
+                                          &( batchHeaders ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          NULL,
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          &( batchHeaders ),
+                                          NULL );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    headers = batchHeaders;
+    headers.pSequenceNumber = NULL;
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          &( headers ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    headers = batchHeaders;
+    headers.pTimestamp = NULL;
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          &( headers ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    headers = batchHeaders;
+    headers.pSsrc = NULL;
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          &( headers ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    headers = batchHeaders;
+    headers.pPayloadType = NULL;
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          &( headers ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    headers = batchHeaders;
+    headers.pMarker = NULL;
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          &( headers ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+
+    headers = batchHeaders;
+    headers.pPayloadOffset = NULL;
+
+    result = RtpBatchParser_ParseHeaders( &( packets[ 0 ] ),
+                                          &( packetLengths[ 0 ] ),
+                                          1,
+                                          &( headers ),
+                                          &( validPacketCount ) );
+
+    TEST_ASSERT_EQUAL( RTP_BATCH_PARSER_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
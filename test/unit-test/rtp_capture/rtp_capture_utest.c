@@ -0,0 +1,965 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_capture.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define CAPTURE_BUFFER_LENGTH    2048
+
+#define RTP_PACKET_LENGTH        20
+
+#define SSRC_A                   0x11223344
+#define SSRC_B                   0x55667788
+
+#define SRC_PORT                 5004
+#define DST_PORT                 6000
+
+RtpCaptureReader_t reader;
+RtpCaptureWriter_t writer;
+RtpCapturePacket_t capturePacket;
+uint8_t captureBuffer[ CAPTURE_BUFFER_LENGTH ];
+uint8_t writerBuffer[ CAPTURE_BUFFER_LENGTH ];
+uint8_t rtpPacketA[ RTP_PACKET_LENGTH ];
+uint8_t rtpPacketB[ RTP_PACKET_LENGTH ];
+size_t captureLength;
+size_t flushCount;
+RtpCaptureResult_t flushResult;
+
+void setUp( void )
+{
+    memset( &( reader ),
+            0,
+            sizeof( reader ) );
+    memset( &( writer ),
+            0,
+            sizeof( writer ) );
+    memset( &( captureBuffer[ 0 ] ),
+            0,
+            sizeof( captureBuffer ) );
+
+    memset( &( rtpPacketA[ 0 ] ),
+            0xA0,
+            sizeof( rtpPacketA ) );
+    rtpPacketA[ 0 ] = 0x80;
+    rtpPacketA[ 8 ] = 0x11;
+    rtpPacketA[ 9 ] = 0x22;
+    rtpPacketA[ 10 ] = 0x33;
+    rtpPacketA[ 11 ] = 0x44;
+
+    memset( &( rtpPacketB[ 0 ] ),
+            0xB0,
+            sizeof( rtpPacketB ) );
+    rtpPacketB[ 0 ] = 0x80;
+    rtpPacketB[ 8 ] = 0x55;
+    rtpPacketB[ 9 ] = 0x66;
+    rtpPacketB[ 10 ] = 0x77;
+    rtpPacketB[ 11 ] = 0x88;
+
+    captureLength = 0;
+    flushCount = 0;
+    flushResult = RTP_CAPTURE_RESULT_OK;
+}
+
+void tearDown( void )
+{
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpCaptureResult_t Flush( void * pCustomContext,
+                                 const uint8_t * pData,
+                                 size_t dataLength )
+{
+    ( void ) pCustomContext;
+
+    if( flushResult == RTP_CAPTURE_RESULT_OK )
+    {
+        TEST_ASSERT_LESS_OR_EQUAL( CAPTURE_BUFFER_LENGTH - captureLength, dataLength );
+        memcpy( &( captureBuffer[ captureLength ] ), pData, dataLength );
+        captureLength += dataLength;
+        flushCount++;
+    }
+
+    return flushResult;
+}
+
+/*-----------------------------------------------------------*/
+
+static void Append16( uint16_t val,
+                      uint8_t isLittleEndian )
+{
+    captureBuffer[ captureLength ] = ( uint8_t ) ( ( isLittleEndian != 0 ) ? val : ( val >> 8 ) );
+    captureBuffer[ captureLength + 1 ] = ( uint8_t ) ( ( isLittleEndian != 0 ) ? ( val >> 8 ) : val );
+    captureLength += 2;
+}
+
+/*-----------------------------------------------------------*/
+
+static void Append32( uint32_t val,
+                      uint8_t isLittleEndian )
+{
+    if( isLittleEndian != 0 )
+    {
+        Append16( ( uint16_t ) val, isLittleEndian );
+        Append16( ( uint16_t ) ( val >> 16 ), isLittleEndian );
+    }
+    else
+    {
+        Append16( ( uint16_t ) ( val >> 16 ), isLittleEndian );
+        Append16( ( uint16_t ) val, isLittleEndian );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendBytes( const uint8_t * pData,
+                         size_t length )
+{
+    memcpy( &( captureBuffer[ captureLength ] ), pData, length );
+    captureLength += length;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Appends an IPv4 (version 4) or IPv6 (version 6) UDP datagram carrying
+ * rtpPacketA. */
+static size_t AppendUdpDatagram( uint8_t version,
+                                 uint8_t protocol,
+                                 uint16_t fragmentOffset,
+                                 uint16_t udpLength )
+{
+    size_t start = captureLength;
+    uint8_t addresses[ 32 ] = { 0 };
+
+    if( version == 4 )
+    {
+        Append16( 0x4500, 0 );
+        Append16( ( uint16_t ) ( 28 + RTP_PACKET_LENGTH ), 0 );
+        Append16( 0, 0 );
+        Append16( fragmentOffset, 0 );
+        Append16( ( uint16_t ) ( ( 64 << 8 ) | protocol ), 0 );
+        Append16( 0, 0 );
+        AppendBytes( &( addresses[ 0 ] ), 8 );
+    }
+    else
+    {
+        Append32( 0x60000000, 0 );
+        Append16( ( uint16_t ) ( 8 + RTP_PACKET_LENGTH ), 0 );
+        Append16( ( uint16_t ) ( ( protocol << 8 ) | 64 ), 0 );
+        AppendBytes( &( addresses[ 0 ] ), 32 );
+    }
+
+    Append16( SRC_PORT, 0 );
+    Append16( DST_PORT, 0 );
+    Append16( udpLength, 0 );
+    Append16( 0, 0 );
+    AppendBytes( &( rtpPacketA[ 0 ] ), RTP_PACKET_LENGTH );
+
+    return captureLength - start;
+}
+
+/*-----------------------------------------------------------*/
+
+static void AppendPcapHeader( uint32_t magic,
+                              uint32_t linkType,
+                              uint8_t isLittleEndian )
+{
+    Append32( magic, isLittleEndian );
+    Append16( 2, isLittleEndian );
+    Append16( 4, isLittleEndian );
+    Append32( 0, isLittleEndian );
+    Append32( 0, isLittleEndian );
+    Append32( 65535, isLittleEndian );
+    Append32( linkType, isLittleEndian );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Appends a pcap record header, to be followed by length bytes of data. */
+static void AppendPcapRecordHeader( uint32_t seconds,
+                                    uint32_t fraction,
+                                    uint32_t length,
+                                    uint8_t isLittleEndian )
+{
+    Append32( seconds, isLittleEndian );
+    Append32( fraction, isLittleEndian );
+    Append32( length, isLittleEndian );
+    Append32( length, isLittleEndian );
+}
+
+/*-----------------------------------------------------------*/
+
+static void AssertPacketA( uint64_t timestampUs )
+{
+    TEST_ASSERT_EQUAL( RTP_PACKET_LENGTH, capturePacket.packetLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( rtpPacketA[ 0 ] ), capturePacket.pPacket, RTP_PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( SRC_PORT, capturePacket.srcPort );
+    TEST_ASSERT_EQUAL( DST_PORT, capturePacket.dstPort );
+    TEST_ASSERT_EQUAL( timestampUs, capturePacket.timestampUs );
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpCaptureReader_Init in case of bad parameters and
+ * unsupported or malformed files.
+ */
+void test_RtpCaptureReader_Init_BadParams( void )
+{
+    RtpCaptureResult_t result;
+    const char rtpdumpWithoutHeader[] = "#!rtpplay1.0 127.0.0.1/5000\n";
+
+    result = RtpCaptureReader_Init( NULL, &( captureBuffer[ 0 ] ), CAPTURE_BUFFER_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureReader_Init( &( reader ), NULL, CAPTURE_BUFFER_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), 3 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT, result );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), CAPTURE_BUFFER_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT, result );
+
+    /* Unsupported link type. */
+    AppendPcapHeader( 0xA1B2C3D4, 105, 1 );
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT, result );
+
+    /* Truncated file header. */
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength - 1 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+
+    result = RtpCaptureReader_Init( &( reader ), ( const uint8_t * ) rtpdumpWithoutHeader, sizeof( rtpdumpWithoutHeader ) - 1 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+
+    result = RtpCaptureReader_SetPortFilter( NULL, SRC_PORT );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureReader_SetSsrcFilter( NULL, SSRC_A );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureReader_GetNextPacket( NULL, &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), NULL );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpCaptureWriter APIs in case of bad parameters and flush
+ * failures.
+ */
+void test_RtpCaptureWriter_BadParams( void )
+{
+    RtpCaptureResult_t result;
+
+    result = RtpCaptureWriter_Init( NULL, RTP_CAPTURE_FORMAT_PCAP, &( writerBuffer[ 0 ] ), CAPTURE_BUFFER_LENGTH, Flush, NULL, SRC_PORT, DST_PORT, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureWriter_Init( &( writer ), RTP_CAPTURE_FORMAT_PCAP, NULL, CAPTURE_BUFFER_LENGTH, Flush, NULL, SRC_PORT, DST_PORT, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureWriter_Init( &( writer ), RTP_CAPTURE_FORMAT_PCAP, &( writerBuffer[ 0 ] ), CAPTURE_BUFFER_LENGTH, NULL, NULL, SRC_PORT, DST_PORT, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureWriter_Init( &( writer ), RTP_CAPTURE_FORMAT_PCAPNG, &( writerBuffer[ 0 ] ), CAPTURE_BUFFER_LENGTH, Flush, NULL, SRC_PORT, DST_PORT, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_UNSUPPORTED_FORMAT, result );
+
+    result = RtpCaptureWriter_Init( &( writer ), RTP_CAPTURE_FORMAT_PCAP, &( writerBuffer[ 0 ] ), 23, Flush, NULL, SRC_PORT, DST_PORT, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OUT_OF_MEMORY, result );
+
+    /* The buffer only holds the file header and one record. */
+    result = RtpCaptureWriter_Init( &( writer ), RTP_CAPTURE_FORMAT_PCAP, &( writerBuffer[ 0 ] ), 24 + 44 + RTP_PACKET_LENGTH, Flush, NULL, SRC_PORT, DST_PORT, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureWriter_WritePacket( NULL, &( rtpPacketA[ 0 ] ), RTP_PACKET_LENGTH, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureWriter_WritePacket( &( writer ), NULL, RTP_PACKET_LENGTH, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketA[ 0 ] ), 65535 - 27, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketA[ 0 ] ), RTP_PACKET_LENGTH, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, flushCount );
+
+    /* The next record does not fit and the flush fails. */
+    flushResult = RTP_CAPTURE_RESULT_BAD_PARAM;
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketA[ 0 ] ), RTP_PACKET_LENGTH, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_FLUSH_FAILED, result );
+
+    flushResult = RTP_CAPTURE_RESULT_OK;
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketA[ 0 ] ), RTP_PACKET_LENGTH + 25, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 1, flushCount );
+
+    result = RtpCaptureWriter_Flush( NULL );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+
+    /* Nothing is buffered. */
+    result = RtpCaptureWriter_Flush( &( writer ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, flushCount );
+
+    result = RtpCaptureWriter_Init( &( writer ), RTP_CAPTURE_FORMAT_RTPDUMP, &( writerBuffer[ 0 ] ), CAPTURE_BUFFER_LENGTH, Flush, NULL, SRC_PORT, DST_PORT, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketA[ 0 ] ), 65535 - 7, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a written pcap capture is read back, with the port
+ * and SSRC filters.
+ */
+void test_RtpCapture_Pcap_WriteRead( void )
+{
+    RtpCaptureResult_t result;
+
+    result = RtpCaptureWriter_Init( &( writer ), RTP_CAPTURE_FORMAT_PCAP, &( writerBuffer[ 0 ] ), CAPTURE_BUFFER_LENGTH, Flush, NULL, SRC_PORT, DST_PORT, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketA[ 0 ] ), RTP_PACKET_LENGTH, 1500000 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketB[ 0 ] ), RTP_PACKET_LENGTH, 1520000 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureWriter_Flush( &( writer ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 24 + ( 2 * ( 44 + RTP_PACKET_LENGTH ) ), captureLength );
+
+    /* IPv4 header checksum. */
+    TEST_ASSERT_EQUAL( 0x3C, captureBuffer[ 24 + 16 + 10 ] );
+    TEST_ASSERT_EQUAL( 0xBB, captureBuffer[ 24 + 16 + 11 ] );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 1500000 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( rtpPacketB[ 0 ] ), capturePacket.pPacket, RTP_PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( 1520000, capturePacket.timestampUs );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* SSRC filter. */
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, RtpCaptureReader_SetSsrcFilter( &( reader ), SSRC_B ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, RtpCaptureReader_SetPortFilter( &( reader ), DST_PORT ) );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( rtpPacketB[ 0 ] ), capturePacket.pPacket, RTP_PACKET_LENGTH );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* Port filter. */
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, RtpCaptureReader_SetPortFilter( &( reader ), SRC_PORT + 1 ) );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* A truncated record. */
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength - 1 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+
+    /* A truncated record header. */
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), 24 + 15 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a written rtpdump capture is read back, with the
+ * buffer flushed in chunks.
+ */
+void test_RtpCapture_Rtpdump_WriteRead( void )
+{
+    RtpCaptureResult_t result;
+    /* Bytes 8 to 11 match SSRC_A, as if it were an RTP header. */
+    uint8_t rtcpPacket[ 12 ] = { 0x80, 0xC8, 0, 2, 0x55, 0x66, 0x77, 0x88, 0x11, 0x22, 0x33, 0x44 };
+    const char fileHeader[] = "#!rtpplay1.0 127.0.0.1/6000\n";
+
+    /* The buffer holds the file header and one record. */
+    result = RtpCaptureWriter_Init( &( writer ), RTP_CAPTURE_FORMAT_RTPDUMP, &( writerBuffer[ 0 ] ), 44 + 28, Flush, NULL, SRC_PORT, DST_PORT, 10000000 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketA[ 0 ] ), RTP_PACKET_LENGTH, 10040000 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, flushCount );
+
+    /* Before the start time. */
+    result = RtpCaptureWriter_WritePacket( &( writer ), &( rtpPacketB[ 0 ] ), RTP_PACKET_LENGTH, 0 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, flushCount );
+
+    result = RtpCaptureWriter_Flush( &( writer ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, flushCount );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( fileHeader, &( captureBuffer[ 0 ] ), sizeof( fileHeader ) - 1 );
+
+    /* An RTCP record, and a record truncated to the RTP header. */
+    Append16( 8 + sizeof( rtcpPacket ), 0 );
+    Append16( 0, 0 );
+    Append32( 80, 0 );
+    AppendBytes( &( rtcpPacket[ 0 ] ), sizeof( rtcpPacket ) );
+    Append16( 8 + 12, 0 );
+    Append16( RTP_PACKET_LENGTH, 0 );
+    Append32( 100, 0 );
+    AppendBytes( &( rtpPacketA[ 0 ] ), 12 );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( RTP_PACKET_LENGTH, capturePacket.packetLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( rtpPacketA[ 0 ] ), capturePacket.pPacket, RTP_PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( 10040000, capturePacket.timestampUs );
+    TEST_ASSERT_EQUAL( SRC_PORT, capturePacket.srcPort );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( rtpPacketB[ 0 ] ), capturePacket.pPacket, RTP_PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( 10000000, capturePacket.timestampUs );
+
+    /* The RTCP record and the truncated record are skipped. */
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* The RTCP record does not reach the SSRC filter. */
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, RtpCaptureReader_SetSsrcFilter( &( reader ), SSRC_A ) );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 10040000, capturePacket.timestampUs );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* Malformed records. */
+    Append16( 7, 0 );
+    Append16( 0, 0 );
+    Append32( 0, 0 );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    reader.offset = captureLength - 8;
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+
+    reader.offset = captureLength - 7;
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the pcap link types and the skipped packets.
+ */
+void test_RtpCapture_Pcap_LinkTypes( void )
+{
+    RtpCaptureResult_t result;
+    size_t recordStart, datagramLength;
+    uint8_t ethernetAddresses[ 12 ] = { 0 };
+
+    /* Big endian nanosecond capture over Ethernet. */
+    AppendPcapHeader( 0xA1B23C4D, 1, 0 );
+
+    /* IPv4 with two VLAN tags. */
+    recordStart = captureLength;
+    AppendPcapRecordHeader( 2, 500000000, 0, 0 );
+    AppendBytes( &( ethernetAddresses[ 0 ] ), 12 );
+    Append16( 0x88A8, 0 );
+    Append16( 1, 0 );
+    Append16( 0x8100, 0 );
+    Append16( 2, 0 );
+    Append16( 0x0800, 0 );
+    datagramLength = AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+    captureBuffer[ recordStart + 11 ] = ( uint8_t ) ( 22 + datagramLength );
+
+    /* Ethernet padding after the IP packet. */
+    recordStart = captureLength;
+    AppendPcapRecordHeader( 3, 0, 0, 0 );
+    AppendBytes( &( ethernetAddresses[ 0 ] ), 12 );
+    Append16( 0x86DD, 0 );
+    datagramLength = AppendUdpDatagram( 6, 17, 0, 8 + RTP_PACKET_LENGTH );
+    Append32( 0, 0 );
+    captureBuffer[ recordStart + 11 ] = ( uint8_t ) ( 14 + datagramLength + 4 );
+
+    /* ARP. */
+    AppendPcapRecordHeader( 4, 0, 14, 0 );
+    AppendBytes( &( ethernetAddresses[ 0 ] ), 12 );
+    Append16( 0x0806, 0 );
+
+    /* Runt frame. */
+    AppendPcapRecordHeader( 4, 0, 2, 0 );
+    Append16( 0, 0 );
+
+    /* TCP. */
+    recordStart = captureLength;
+    AppendPcapRecordHeader( 4, 0, 0, 0 );
+    AppendBytes( &( ethernetAddresses[ 0 ] ), 12 );
+    Append16( 0x0800, 0 );
+    datagramLength = AppendUdpDatagram( 4, 6, 0, 8 + RTP_PACKET_LENGTH );
+    captureBuffer[ recordStart + 11 ] = ( uint8_t ) ( 14 + datagramLength );
+
+    /* IPv4 fragment. */
+    recordStart = captureLength;
+    AppendPcapRecordHeader( 4, 0, 0, 0 );
+    AppendBytes( &( ethernetAddresses[ 0 ] ), 12 );
+    Append16( 0x0800, 0 );
+    datagramLength = AppendUdpDatagram( 4, 17, 0x2000, 8 + RTP_PACKET_LENGTH );
+    captureBuffer[ recordStart + 11 ] = ( uint8_t ) ( 14 + datagramLength );
+
+    /* UDP datagram truncated by the snap length. */
+    recordStart = captureLength;
+    AppendPcapRecordHeader( 4, 0, 0, 0 );
+    AppendBytes( &( ethernetAddresses[ 0 ] ), 12 );
+    Append16( 0x0800, 0 );
+    datagramLength = AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH + 1 );
+    captureBuffer[ recordStart + 11 ] = ( uint8_t ) ( 14 + datagramLength );
+
+    /* Neither IPv4 nor IPv6. */
+    recordStart = captureLength;
+    AppendPcapRecordHeader( 4, 0, 0, 0 );
+    AppendBytes( &( ethernetAddresses[ 0 ] ), 12 );
+    Append16( 0x0800, 0 );
+    datagramLength = AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+    captureBuffer[ recordStart + 16 + 14 ] = 0x55;
+    captureBuffer[ recordStart + 11 ] = ( uint8_t ) ( 14 + datagramLength );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 2500000 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 3000000 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* Linux cooked capture. */
+    captureLength = 0;
+    AppendPcapHeader( 0xA1B2C3D4, 113, 1 );
+    AppendPcapRecordHeader( 5, 7, 16 + 48 + RTP_PACKET_LENGTH, 1 );
+    captureLength += 14;
+    Append16( 0x86DD, 0 );
+    ( void ) AppendUdpDatagram( 6, 17, 0, 8 + RTP_PACKET_LENGTH );
+    AppendPcapRecordHeader( 5, 8, 15, 1 );
+    captureLength += 15;
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 5000007 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* Loopback capture. */
+    captureLength = 0;
+    AppendPcapHeader( 0xA1B23C4D, 0, 1 );
+    AppendPcapRecordHeader( 6, 9000, 4 + 28 + RTP_PACKET_LENGTH, 1 );
+    Append32( 2, 1 );
+    ( void ) AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+    AppendPcapRecordHeader( 6, 0, 3, 1 );
+    captureLength += 3;
+    AppendPcapRecordHeader( 6, 0, 4 + 48 + RTP_PACKET_LENGTH, 1 );
+    Append32( 30, 1 );
+    ( void ) AppendUdpDatagram( 6, 6, 0, 8 + RTP_PACKET_LENGTH );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 6000009 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* Linux cooked capture of a runt frame, and an IPv4 capture with a bad
+     * header length. */
+    captureLength = 0;
+    AppendPcapHeader( 0xA1B2C3D4, 113, 0 );
+    AppendPcapRecordHeader( 0, 0, 15, 0 );
+    captureLength += 15;
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    captureLength = 0;
+    AppendPcapHeader( 0xA1B2C3D4, 228, 0 );
+    AppendPcapRecordHeader( 0, 0, 28 + RTP_PACKET_LENGTH, 0 );
+    recordStart = captureLength;
+    ( void ) AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+    captureBuffer[ recordStart ] = 0x44;
+    AppendPcapRecordHeader( 0, 0, 28 + RTP_PACKET_LENGTH, 0 );
+    recordStart = captureLength;
+    ( void ) AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+    captureBuffer[ recordStart + 3 ] = 19;
+    AppendPcapRecordHeader( 0, 0, 28 + RTP_PACKET_LENGTH, 0 );
+    recordStart = captureLength;
+    ( void ) AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+    captureBuffer[ recordStart + 3 ] = 29 + RTP_PACKET_LENGTH;
+    AppendPcapRecordHeader( 0, 0, 28 + RTP_PACKET_LENGTH, 0 );
+    ( void ) AppendUdpDatagram( 4, 17, 0, 7 );
+    AppendPcapRecordHeader( 0, 0, 28, 0 );
+    recordStart = captureLength;
+    ( void ) AppendUdpDatagram( 4, 17, 0, 8 );
+    captureLength -= RTP_PACKET_LENGTH;
+    captureBuffer[ recordStart + 3 ] = 27;
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the pcapng blocks, interfaces and timestamp resolutions.
+ */
+void test_RtpCapture_Pcapng( void )
+{
+    RtpCaptureResult_t result;
+    size_t i;
+
+    /* Little endian section. */
+    Append32( 0x0A0D0D0A, 1 );
+    Append32( 28, 1 );
+    Append32( 0x1A2B3C4D, 1 );
+    Append16( 1, 1 );
+    Append16( 0, 1 );
+    Append32( 0xFFFFFFFF, 1 );
+    Append32( 0xFFFFFFFF, 1 );
+    Append32( 28, 1 );
+
+    /* Interface 0, raw IP with a nanosecond resolution after a comment. */
+    Append32( 1, 1 );
+    Append32( 40, 1 );
+    Append16( 101, 1 );
+    Append16( 0, 1 );
+    Append32( 0, 1 );
+    Append16( 1, 1 );
+    Append16( 3, 1 );
+    Append32( 0x00616263, 1 );
+    Append16( 9, 1 );
+    Append16( 1, 1 );
+    Append32( 9, 1 );
+    Append32( 0, 1 );
+    Append32( 40, 1 );
+
+    /* Interface 1, raw IP with the default resolution. */
+    Append32( 1, 1 );
+    Append32( 24, 1 );
+    Append16( 101, 1 );
+    Append16( 0, 1 );
+    Append32( 0, 1 );
+    Append16( 0, 1 );
+    Append16( 0, 1 );
+    Append32( 24, 1 );
+
+    /* Enhanced packet blocks on interface 0, 1 and an unknown interface. */
+    for( i = 0; i < 3; i++ )
+    {
+        Append32( 6, 1 );
+        Append32( 32 + 28 + RTP_PACKET_LENGTH, 1 );
+        Append32( ( i == 2 ) ? 7 : ( uint32_t ) i, 1 );
+        Append32( 0, 1 );
+        Append32( 7000000, 1 );
+        Append32( 28 + RTP_PACKET_LENGTH, 1 );
+        Append32( 28 + RTP_PACKET_LENGTH, 1 );
+        ( void ) AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+        Append32( 32 + 28 + RTP_PACKET_LENGTH, 1 );
+    }
+
+    /* Simple packet block, with a bigger original length. */
+    Append32( 3, 1 );
+    Append32( 16 + 28 + RTP_PACKET_LENGTH, 1 );
+    Append32( 1500, 1 );
+    ( void ) AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+    Append32( 16 + 28 + RTP_PACKET_LENGTH, 1 );
+
+    /* Name resolution block, skipped. */
+    Append32( 4, 1 );
+    Append32( 12, 1 );
+    Append32( 12, 1 );
+
+    /* Big endian section, with a power of two resolution. */
+    Append32( 0x0A0D0D0A, 0 );
+    Append32( 28, 0 );
+    Append32( 0x1A2B3C4D, 0 );
+    Append16( 1, 0 );
+    Append16( 0, 0 );
+    Append32( 0xFFFFFFFF, 0 );
+    Append32( 0xFFFFFFFF, 0 );
+    Append32( 28, 0 );
+
+    Append32( 1, 0 );
+    Append32( 28, 0 );
+    Append16( 228, 0 );
+    Append16( 0, 0 );
+    Append32( 0, 0 );
+    Append16( 9, 0 );
+    Append16( 1, 0 );
+    Append32( 0x8A000000, 0 );
+    Append32( 28, 0 );
+
+    Append32( 6, 0 );
+    Append32( 32 + 28 + RTP_PACKET_LENGTH, 0 );
+    Append32( 0, 0 );
+    Append32( 0, 0 );
+    Append32( 1024 + 512, 0 );
+    Append32( 28 + RTP_PACKET_LENGTH, 0 );
+    Append32( 28 + RTP_PACKET_LENGTH, 0 );
+    ( void ) AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+    Append32( 32 + 28 + RTP_PACKET_LENGTH, 0 );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 7000 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 7000000 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 0 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 1500000 );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate pcapng corner cases.
+ */
+void test_RtpCapture_Pcapng_Malformed( void )
+{
+    RtpCaptureResult_t result;
+    size_t i, blockStart;
+    /* Resolutions and the expected timestamps of 1000000 units. */
+    uint8_t resolutions[] = { 3, 30, 0x80, 0xA8, 0xE0, 0xFF };
+    uint64_t timestamps[] = { 1000000000, 0, 1000000000000, 0, 0, 0 };
+
+    /* Section header block with a bad byte order magic. */
+    Append32( 0x0A0D0D0A, 1 );
+    Append32( 28, 1 );
+    Append32( 0x1A2B3C4E, 1 );
+    captureLength += 16;
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+
+    /* Truncated section header block. */
+    captureBuffer[ 8 ] = 0x4D;
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), 27 );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+
+    /* Interfaces with other resolutions and malformed options. */
+    for( i = 0; i < sizeof( resolutions ); i++ )
+    {
+        Append32( 1, 1 );
+        Append32( 28, 1 );
+        Append16( 101, 1 );
+        Append16( 0, 1 );
+        Append32( 0, 1 );
+        Append16( 9, 1 );
+        Append16( 1, 1 );
+        Append32( resolutions[ i ], 1 );
+        Append32( 28, 1 );
+    }
+
+    Append32( 1, 1 );
+    Append32( 28, 1 );
+    Append16( 101, 1 );
+    Append16( 0, 1 );
+    Append32( 0, 1 );
+    Append16( 9, 1 );
+    Append16( 5, 1 );
+    Append32( 0, 1 );
+    Append32( 28, 1 );
+
+    for( i = 0; i < RTP_CAPTURE_MAX_INTERFACES; i++ )
+    {
+        Append32( 1, 1 );
+        Append32( 20, 1 );
+        Append16( ( i == 0 ) ? 147 : 1, 1 );
+        Append16( 0, 1 );
+        Append32( 0, 1 );
+        Append32( 20, 1 );
+    }
+
+    /* The last one is on the interface with an unsupported link type. */
+    for( i = 0; i <= sizeof( resolutions ) + 1; i++ )
+    {
+        Append32( 6, 1 );
+        Append32( 32 + 28 + RTP_PACKET_LENGTH, 1 );
+        Append32( ( uint32_t ) i, 1 );
+        Append32( 0, 1 );
+        Append32( 1000000, 1 );
+        Append32( 28 + RTP_PACKET_LENGTH, 1 );
+        Append32( 28 + RTP_PACKET_LENGTH, 1 );
+        ( void ) AppendUdpDatagram( 4, 17, 0, 8 + RTP_PACKET_LENGTH );
+        Append32( 32 + 28 + RTP_PACKET_LENGTH, 1 );
+    }
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    for( i = 0; i < sizeof( resolutions ); i++ )
+    {
+        result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+        TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+        AssertPacketA( timestamps[ i ] );
+    }
+
+    /* The malformed option is ignored. */
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+    AssertPacketA( 1000000 );
+
+    TEST_ASSERT_EQUAL( sizeof( resolutions ) + 1 + RTP_CAPTURE_MAX_INTERFACES, reader.interfaceCount );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+
+    /* Blocks too short for their type. */
+    blockStart = captureLength;
+    Append32( 1, 1 );
+    Append32( 16, 1 );
+    captureLength += 8;
+
+    for( i = 0; i < 3; i++ )
+    {
+        reader.offset = blockStart;
+        reader.bufferLength = captureLength;
+        captureBuffer[ blockStart ] = ( uint8_t ) ( ( i == 0 ) ? 1 : ( 3 * i ) );
+        captureBuffer[ blockStart + 4 ] = ( i == 1 ) ? 12 : 16;
+
+        result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+        TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+    }
+
+    /* Bad block lengths. */
+    for( i = 0; i < 3; i++ )
+    {
+        reader.offset = blockStart;
+        reader.bufferLength = ( i == 2 ) ? ( blockStart + 11 ) : captureLength;
+        captureBuffer[ blockStart + 4 ] = ( i == 0 ) ? 8 : 18;
+
+        result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+        TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+    }
+
+    reader.offset = blockStart;
+    reader.bufferLength = captureLength;
+    captureBuffer[ blockStart + 4 ] = 20;
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+
+    /* Enhanced packet block with a captured length beyond the block. */
+    captureLength = blockStart;
+    Append32( 6, 1 );
+    Append32( 32, 1 );
+    Append32( 0, 1 );
+    Append32( 0, 1 );
+    Append32( 0, 1 );
+    Append32( 1, 1 );
+    Append32( 1, 1 );
+    Append32( 32, 1 );
+
+    reader.offset = blockStart;
+    reader.bufferLength = captureLength;
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_MALFORMED, result );
+
+    /* Simple packet block before any interface. */
+    captureLength = 0;
+    Append32( 0x0A0D0D0A, 0 );
+    Append32( 28, 0 );
+    Append32( 0x1A2B3C4D, 0 );
+    captureLength += 16;
+    Append32( 3, 0 );
+    Append32( 16, 0 );
+    Append32( 0, 0 );
+    Append32( 16, 0 );
+
+    result = RtpCaptureReader_Init( &( reader ), &( captureBuffer[ 0 ] ), captureLength );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_OK, result );
+
+    result = RtpCaptureReader_GetNextPacket( &( reader ), &( capturePacket ) );
+    TEST_ASSERT_EQUAL( RTP_CAPTURE_RESULT_END, result );
+}
+
+/*-----------------------------------------------------------*/
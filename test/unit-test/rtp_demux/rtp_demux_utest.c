@@ -0,0 +1,529 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_demux.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define DEMUX_ENTRIES_LENGTH    8
+#define DEMUX_MID_ROUTES_LENGTH 3
+
+RtpDemux_t demux;
+RtpDemuxEntry_t demuxEntries[ DEMUX_ENTRIES_LENGTH ];
+RtpDemuxMidRoute_t demuxMidRoutes[ DEMUX_MID_ROUTES_LENGTH ];
+uint8_t streams[ 10 ];
+uint8_t serializedPacket[ 12 ];
+
+void setUp( void )
+{
+    memset( &( demux ),
+            0,
+            sizeof( demux ) );
+    memset( &( demuxEntries[ 0 ] ),
+            0,
+            sizeof( demuxEntries ) );
+    memset( &( demuxMidRoutes[ 0 ] ),
+            0,
+            sizeof( demuxMidRoutes ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* Creates a packet with the given SSRC and payload type in serializedPacket. */
+static void CreatePacket( uint32_t ssrc,
+                          uint8_t payloadType )
+{
+    serializedPacket[ 0 ] = 0x80;
+    serializedPacket[ 1 ] = payloadType;
+    Rtp_WriteUint16( &( serializedPacket[ 2 ] ), 0x04D2 );
+    Rtp_WriteUint32( &( serializedPacket[ 4 ] ), 0x12345678 );
+    Rtp_WriteUint32( &( serializedPacket[ 8 ] ), ssrc );
+}
+
+/* Routes the packet with the given SSRC and payload type. */
+static RtpDemuxResult_t Route( uint32_t ssrc,
+                               uint8_t payloadType,
+                               void ** ppStream )
+{
+    CreatePacket( ssrc, payloadType );
+
+    return RtpDemux_Route( &( demux ),
+                           &( serializedPacket[ 0 ] ),
+                           sizeof( serializedPacket ),
+                           ppStream );
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpDemux_Init functionality.
+ */
+void test_RtpDemux_Init( void )
+{
+    RtpDemuxResult_t result;
+
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH,
+                            &( demuxMidRoutes[ 0 ] ),
+                            DEMUX_MID_ROUTES_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( demuxEntries[ 0 ] ), demux.pEntries );
+    TEST_ASSERT_EQUAL( DEMUX_ENTRIES_LENGTH - 1, demux.entriesMask );
+    TEST_ASSERT_EQUAL( 0, demux.entryCount );
+    TEST_ASSERT_EQUAL_PTR( &( demuxMidRoutes[ 0 ] ), demux.pMidRoutes );
+    TEST_ASSERT_EQUAL( DEMUX_MID_ROUTES_LENGTH, demux.midRoutesLength );
+    TEST_ASSERT_EQUAL( 0, demux.midRouteCount );
+    TEST_ASSERT_EQUAL( RTP_DEMUX_EXTENSION_ID_NONE, demux.midExtensionId );
+    TEST_ASSERT_EQUAL( RTP_DEMUX_EXTENSION_ID_NONE, demux.ridExtensionId );
+
+    /* MID routes are optional. */
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH,
+                            NULL,
+                            0 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpDemux functions in case of bad parameters.
+ */
+void test_RtpDemux_BadParams( void )
+{
+    RtpDemuxResult_t result;
+    RtpDemuxMidRoute_t midRoute = { 0 };
+    void * pStream;
+
+    result = RtpDemux_Init( NULL,
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH,
+                            NULL,
+                            0 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_Init( &( demux ),
+                            NULL,
+                            DEMUX_ENTRIES_LENGTH,
+                            NULL,
+                            0 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            1,
+                            NULL,
+                            0 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    /* Not a power of 2. */
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH - 1,
+                            NULL,
+                            0 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH,
+                            NULL,
+                            DEMUX_MID_ROUTES_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH,
+                            &( demuxMidRoutes[ 0 ] ),
+                            DEMUX_MID_ROUTES_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    result = RtpDemux_SetExtensionIds( NULL, 1, 2 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_AddSsrc( NULL, 1, 96, &( streams[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_AddSsrc( &( demux ), 1, 96, NULL );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_RemoveSsrc( NULL, 1, 96 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_AddMidRoute( NULL, &( midRoute ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_AddMidRoute( &( demux ), NULL );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    midRoute.pStream = &( streams[ 0 ] );
+
+    result = RtpDemux_AddMidRoute( &( demux ), &( midRoute ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    midRoute.pMid = ( const uint8_t * ) "0";
+    midRoute.midLength = 1;
+    midRoute.pStream = NULL;
+
+    result = RtpDemux_AddMidRoute( &( demux ), &( midRoute ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    CreatePacket( 1, 96 );
+
+    result = RtpDemux_Route( NULL,
+                             &( serializedPacket[ 0 ] ),
+                             sizeof( serializedPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_Route( &( demux ),
+                             NULL,
+                             sizeof( serializedPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+
+    result = RtpDemux_Route( &( demux ),
+                             &( serializedPacket[ 0 ] ),
+                             sizeof( serializedPacket ),
+                             NULL );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate SSRC routing with colliding SSRCs, a full table and removal
+ * of entries from the middle of a probe sequence.
+ */
+void test_RtpDemux_Route_Ssrc( void )
+{
+    RtpDemuxResult_t result;
+    void * pStream = NULL;
+    size_t i;
+    /* With 8 entries, SSRCs 5, 6, 18 and 19 have home index 3, 8 has home index
+     * 4, 12 has home index 7 and 40 has home index 0. So they occupy the
+     * indices 3, 4, 5, 1, 6, 7 and 0 respectively. */
+    uint32_t ssrcs[] = { 5, 6, 18, 8, 12, 40, 19 };
+
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH,
+                            NULL,
+                            0 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    for( i = 0; i < sizeof( ssrcs ) / sizeof( ssrcs[ 0 ] ); i++ )
+    {
+        result = RtpDemux_AddSsrc( &( demux ), ssrcs[ i ], 96, &( streams[ i ] ) );
+
+        TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+    }
+
+    TEST_ASSERT_EQUAL( 7, demux.entryCount );
+    TEST_ASSERT_EQUAL( 19, demuxEntries[ 1 ].ssrc );
+
+    /* One entry is always left empty. */
+    result = RtpDemux_AddSsrc( &( demux ), 100, 96, &( streams[ 9 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_FULL, result );
+
+    /* Replacing an existing entry is allowed when the table is full. */
+    result = RtpDemux_AddSsrc( &( demux ), 5, 96, &( streams[ 9 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    result = Route( 5, 96, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( streams[ 9 ] ), pStream );
+
+    /* Different payload type. */
+    result = Route( 5, 97, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    /* Unknown SSRC which probes the whole cluster. */
+    result = Route( 100, 96, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    /* Remove from the start of the cluster - the following entries move back. */
+    result = RtpDemux_RemoveSsrc( &( demux ), 5, 96 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    /* Remove an entry which wraps around. */
+    result = RtpDemux_RemoveSsrc( &( demux ), 12, 96 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    result = RtpDemux_RemoveSsrc( &( demux ), 12, 96 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    TEST_ASSERT_EQUAL( 5, demux.entryCount );
+
+    result = Route( 5, 96, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    result = Route( 12, 96, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    for( i = 1; i < sizeof( ssrcs ) / sizeof( ssrcs[ 0 ] ); i++ )
+    {
+        if( ssrcs[ i ] != 12 )
+        {
+            result = Route( ssrcs[ i ], 96, &( pStream ) );
+
+            TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+            TEST_ASSERT_EQUAL_PTR( &( streams[ i ] ), pStream );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate routing with wildcard payload type entries.
+ */
+void test_RtpDemux_Route_AnyPayloadType( void )
+{
+    RtpDemuxResult_t result;
+    void * pStream = NULL;
+
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH,
+                            NULL,
+                            0 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    result = RtpDemux_AddSsrc( &( demux ), 100, RTP_DEMUX_ANY_PAYLOAD_TYPE, &( streams[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    result = RtpDemux_AddSsrc( &( demux ), 100, 96, &( streams[ 1 ] ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    result = Route( 100, 96, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( streams[ 1 ] ), pStream );
+
+    result = Route( 100, 97, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( streams[ 0 ] ), pStream );
+
+    /* Malformed packet. */
+    serializedPacket[ 0 ] = 0x40;
+
+    result = RtpDemux_Route( &( demux ),
+                             &( serializedPacket[ 0 ] ),
+                             sizeof( serializedPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_MALFORMED_PACKET, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate MID/RID based routing and SSRC learning.
+ */
+void test_RtpDemux_Route_Mid( void )
+{
+    RtpDemuxResult_t result;
+    RtpDemuxMidRoute_t midRoute = { 0 };
+    void * pStream = NULL;
+    uint8_t midRidPacket[] =
+    {
+        0x90, 0x60, 0x04, 0xD2, /* Header: V=2, X=1, PT=96. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x00, 0x00, 0x00, 0xC8, /* SSRC = 200. */
+        0xBE, 0xDE, 0x00, 0x03, /* Extension header. */
+        0x14, 'v', 'i', 'd',    /* MID - ID=1, L=4. */
+        'e', 'o', 0x21, 'l',    /* RID - ID=2, L=1. */
+        'o', 0x00, 0x00, 0x00   /* Padding. */
+    };
+    uint8_t midPacket[] =
+    {
+        0x90, 0x60, 0x04, 0xD2, /* Header: V=2, X=1, PT=96. */
+        0x12, 0x34, 0x56, 0x78, /* Timestamp. */
+        0x00, 0x00, 0x00, 0xC9, /* SSRC = 201. */
+        0xBE, 0xDE, 0x00, 0x02, /* Extension header. */
+        0x14, 'a', 'u', 'd',    /* MID - ID=1, L=4. */
+        'i', 'o', 0x00, 0x00    /* Padding. */
+    };
+
+    result = RtpDemux_Init( &( demux ),
+                            &( demuxEntries[ 0 ] ),
+                            DEMUX_ENTRIES_LENGTH,
+                            &( demuxMidRoutes[ 0 ] ),
+                            DEMUX_MID_ROUTES_LENGTH );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    /* MID routing is disabled until the extension IDs are set. */
+    result = RtpDemux_Route( &( demux ),
+                             &( midRidPacket[ 0 ] ),
+                             sizeof( midRidPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    result = RtpDemux_SetExtensionIds( &( demux ), 1, 2 );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    /* No MID routes. */
+    result = RtpDemux_Route( &( demux ),
+                             &( midRidPacket[ 0 ] ),
+                             sizeof( midRidPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    midRoute.pMid = ( const uint8_t * ) "audio";
+    midRoute.midLength = 5;
+    midRoute.pStream = &( streams[ 0 ] );
+
+    result = RtpDemux_AddMidRoute( &( demux ), &( midRoute ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    midRoute.pMid = ( const uint8_t * ) "video";
+    midRoute.pRid = ( const uint8_t * ) "hi";
+    midRoute.ridLength = 2;
+    midRoute.pStream = &( streams[ 1 ] );
+
+    result = RtpDemux_AddMidRoute( &( demux ), &( midRoute ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    midRoute.pRid = ( const uint8_t * ) "lo";
+    midRoute.pStream = &( streams[ 2 ] );
+
+    result = RtpDemux_AddMidRoute( &( demux ), &( midRoute ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+
+    result = RtpDemux_AddMidRoute( &( demux ), &( midRoute ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_FULL, result );
+
+    result = RtpDemux_Route( &( demux ),
+                             &( midRidPacket[ 0 ] ),
+                             sizeof( midRidPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( streams[ 2 ] ), pStream );
+
+    /* The SSRC is learnt - packets without extension are routed now. */
+    result = Route( 200, 97, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( streams[ 2 ] ), pStream );
+
+    result = RtpDemux_Route( &( demux ),
+                             &( midPacket[ 0 ] ),
+                             sizeof( midPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( streams[ 0 ] ), pStream );
+
+    /* MID "video" without RID does not match any route. */
+    midPacket[ 11 ] = 0xCA;
+    memcpy( &( midPacket[ 17 ] ), "video", 5 );
+
+    result = RtpDemux_Route( &( demux ),
+                             &( midPacket[ 0 ] ),
+                             sizeof( midPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    /* Unknown MID with a different length, followed by padding. */
+    midPacket[ 16 ] = 0x12;
+    memcpy( &( midPacket[ 17 ] ), "vid\0\0", 5 );
+
+    result = RtpDemux_Route( &( demux ),
+                             &( midPacket[ 0 ] ),
+                             sizeof( midPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    /* No MID element. */
+    midPacket[ 16 ] = 0x32;
+
+    result = RtpDemux_Route( &( demux ),
+                             &( midPacket[ 0 ] ),
+                             sizeof( midPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+
+    /* Malformed extension element. */
+    midPacket[ 16 ] = 0x1F;
+
+    result = RtpDemux_Route( &( demux ),
+                             &( midPacket[ 0 ] ),
+                             sizeof( midPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_MALFORMED_PACKET, result );
+
+    /* Extension longer than the packet. */
+    midPacket[ 15 ] = 0x03;
+
+    result = RtpDemux_Route( &( demux ),
+                             &( midPacket[ 0 ] ),
+                             sizeof( midPacket ),
+                             &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_MALFORMED_PACKET, result );
+
+    /* No extension. */
+    result = Route( 300, 96, &( pStream ) );
+
+    TEST_ASSERT_EQUAL( RTP_DEMUX_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
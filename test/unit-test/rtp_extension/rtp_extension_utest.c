@@ -0,0 +1,560 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_extension.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define EXTENSION_PAYLOAD_BUFFER_LENGTH   80000
+#define MAX_ELEMENTS                      1100
+
+RtpExtensionTable_t extensionTable;
+uint32_t extensionPayloadBuffer[ EXTENSION_PAYLOAD_BUFFER_LENGTH ];
+RtpExtensionElement_t elements[ MAX_ELEMENTS ];
+
+void setUp( void )
+{
+    memset( &( extensionTable ),
+            0,
+            sizeof( extensionTable ) );
+    memset( &( extensionPayloadBuffer[ 0 ] ),
+            0xFF,
+            sizeof( extensionPayloadBuffer ) );
+    memset( &( elements[ 0 ] ),
+            0,
+            sizeof( elements ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpExtension_Parse and RtpExtension_Get with the one-byte
+ * header profile.
+ */
+void test_RtpExtension_Parse_OneByte( void )
+{
+    RtpExtensionResult_t result;
+    const uint8_t * pData;
+    uint8_t dataLength;
+    const uint8_t extensionPayload[] =
+    {
+        0x10, 0xAA,             /* ID=1, L=0 (1 byte). */
+        0x00,                   /* Padding. */
+        0x32, 0x01, 0x02, 0x03, /* ID=3, L=2 (3 bytes). */
+        0x51, 0x12, 0x34,       /* ID=5, L=1 (2 bytes). */
+        0xF0, 0x77,             /* ID=15 - Reserved, stop processing. */
+    };
+
+    result = RtpExtension_Parse( RTP_EXTENSION_ONE_BYTE_PROFILE,
+                                 &( extensionPayload[ 0 ] ),
+                                 sizeof( extensionPayload ),
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               1,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_PTR( &( extensionPayload[ 1 ] ),
+                           pData );
+    TEST_ASSERT_EQUAL( 1,
+                       dataLength );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               3,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_PTR( &( extensionPayload[ 4 ] ),
+                           pData );
+    TEST_ASSERT_EQUAL( 3,
+                       dataLength );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               5,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_PTR( &( extensionPayload[ 8 ] ),
+                           pData );
+    TEST_ASSERT_EQUAL( 2,
+                       dataLength );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               2,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_NOT_FOUND,
+                       result );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               15,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_NOT_FOUND,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpExtension_Parse and RtpExtension_Get with the two-byte
+ * header profile.
+ */
+void test_RtpExtension_Parse_TwoByte( void )
+{
+    RtpExtensionResult_t result;
+    const uint8_t * pData;
+    uint8_t dataLength;
+    const uint8_t extensionPayload[] =
+    {
+        0x01, 0x00,             /* ID=1, Length=0. */
+        0x00, 0x00,             /* Padding. */
+        0xFF, 0x03, 0x0A, 0x0B, /* ID=255, Length=3. */
+        0x0C, 0x00, 0x00, 0x00  /* Padding. */
+    };
+
+    /* Application bits in the profile must be ignored. */
+    result = RtpExtension_Parse( RTP_EXTENSION_TWO_BYTE_PROFILE | 0x000F,
+                                 &( extensionPayload[ 0 ] ),
+                                 sizeof( extensionPayload ),
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               1,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       dataLength );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               255,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_PTR( &( extensionPayload[ 6 ] ),
+                           pData );
+    TEST_ASSERT_EQUAL( 3,
+                       dataLength );
+
+    /* Parsing the next extension block must clear the previous IDs. */
+    result = RtpExtension_Parse( RTP_EXTENSION_TWO_BYTE_PROFILE,
+                                 NULL,
+                                 0,
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               255,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_NOT_FOUND,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpExtension_Parse with malformed extension blocks.
+ */
+void test_RtpExtension_Parse_Malformed( void )
+{
+    RtpExtensionResult_t result;
+    const uint8_t oneByteTruncated[] =
+    {
+        0x13, 0x01, 0x02, 0x03 /* ID=1, L=3 (4 bytes) but only 3 bytes. */
+    };
+    const uint8_t twoByteTruncatedData[] =
+    {
+        0x01, 0x04, 0x01, 0x02 /* ID=1, Length=4 but only 2 bytes. */
+    };
+    const uint8_t twoByteTruncatedHeader[] =
+    {
+        0x00, 0x00, 0x00, 0x01 /* Padding and ID=1 with no length. */
+    };
+
+    result = RtpExtension_Parse( RTP_EXTENSION_ONE_BYTE_PROFILE,
+                                 &( oneByteTruncated[ 0 ] ),
+                                 sizeof( oneByteTruncated ),
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_MALFORMED_EXTENSION,
+                       result );
+
+    result = RtpExtension_Parse( RTP_EXTENSION_TWO_BYTE_PROFILE,
+                                 &( twoByteTruncatedData[ 0 ] ),
+                                 sizeof( twoByteTruncatedData ),
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_MALFORMED_EXTENSION,
+                       result );
+
+    result = RtpExtension_Parse( RTP_EXTENSION_TWO_BYTE_PROFILE,
+                                 &( twoByteTruncatedHeader[ 0 ] ),
+                                 sizeof( twoByteTruncatedHeader ),
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_MALFORMED_EXTENSION,
+                       result );
+
+    result = RtpExtension_Parse( 0xABCD,
+                                 &( oneByteTruncated[ 0 ] ),
+                                 sizeof( oneByteTruncated ),
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_UNSUPPORTED_PROFILE,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpExtension_Parse and RtpExtension_Get in case of bad
+ * parameters.
+ */
+void test_RtpExtension_Parse_BadParams( void )
+{
+    RtpExtensionResult_t result;
+    const uint8_t * pData;
+    uint8_t dataLength;
+    const uint8_t extensionPayload[] = { 0x10, 0xAA, 0x00, 0x00 };
+
+    result = RtpExtension_Parse( RTP_EXTENSION_ONE_BYTE_PROFILE,
+                                 NULL,
+                                 sizeof( extensionPayload ),
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpExtension_Parse( RTP_EXTENSION_ONE_BYTE_PROFILE,
+                                 &( extensionPayload[ 0 ] ),
+                                 sizeof( extensionPayload ),
+                                 NULL );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpExtension_Get( NULL,
+                               1,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               1,
+                               NULL,
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               1,
+                               &( pData ),
+                               NULL );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpExtension_Build with elements which fit in the one-byte
+ * header and parse the result back.
+ */
+void test_RtpExtension_Build_OneByte( void )
+{
+    RtpExtensionResult_t result;
+    RtpHeaderExtension_t extension = { 0 };
+    uint8_t audioLevel[] = { 0x85 };
+    uint8_t mid[] = { 'a', 'u', 'd', 'i', 'o' };
+    uint8_t serialized[ 8 ];
+    const uint8_t * pData;
+    uint8_t dataLength;
+    size_t i;
+
+    elements[ 0 ].id = 1;
+    elements[ 0 ].dataLength = sizeof( audioLevel );
+    elements[ 0 ].pData = &( audioLevel[ 0 ] );
+    elements[ 1 ].id = 14;
+    elements[ 1 ].dataLength = sizeof( mid );
+    elements[ 1 ].pData = &( mid[ 0 ] );
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 2,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_ONE_BYTE_PROFILE,
+                       extension.extensionProfile );
+    TEST_ASSERT_EQUAL( 2,
+                       extension.extensionPayloadLength );
+    TEST_ASSERT_EQUAL_PTR( &( extensionPayloadBuffer[ 0 ] ),
+                           extension.pExtensionPayload );
+
+    /* 0x10 0x85 0xE4 'a' 'u' 'd' 'i' 'o'. */
+    TEST_ASSERT_EQUAL( 0x1085E461,
+                       extensionPayloadBuffer[ 0 ] );
+    TEST_ASSERT_EQUAL( 0x7564696F,
+                       extensionPayloadBuffer[ 1 ] );
+
+    for( i = 0; i < extension.extensionPayloadLength; i++ )
+    {
+        Rtp_WriteUint32( &( serialized[ i * 4 ] ),
+                         extensionPayloadBuffer[ i ] );
+    }
+
+    result = RtpExtension_Parse( extension.extensionProfile,
+                                 &( serialized[ 0 ] ),
+                                 sizeof( serialized ),
+                                 &( extensionTable ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+
+    result = RtpExtension_Get( &( extensionTable ),
+                               14,
+                               &( pData ),
+                               &( dataLength ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( mid ),
+                       dataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( mid[ 0 ] ),
+                                   pData,
+                                   sizeof( mid ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that RtpExtension_Build switches to the two-byte header when
+ * an element does not fit in the one-byte header.
+ */
+void test_RtpExtension_Build_TwoByte( void )
+{
+    RtpExtensionResult_t result;
+    RtpHeaderExtension_t extension = { 0 };
+    uint8_t data[ 17 ] = { 0 };
+
+    /* ID larger than 14. */
+    elements[ 0 ].id = 15;
+    elements[ 0 ].dataLength = 1;
+    elements[ 0 ].pData = &( data[ 0 ] );
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 1,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_TWO_BYTE_PROFILE,
+                       extension.extensionProfile );
+    TEST_ASSERT_EQUAL( 1,
+                       extension.extensionPayloadLength );
+    TEST_ASSERT_EQUAL( 0x0F010000,
+                       extensionPayloadBuffer[ 0 ] );
+
+    /* Zero length data. */
+    elements[ 0 ].id = 1;
+    elements[ 0 ].dataLength = 0;
+    elements[ 0 ].pData = NULL;
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 1,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_TWO_BYTE_PROFILE,
+                       extension.extensionProfile );
+    TEST_ASSERT_EQUAL( 0x01000000,
+                       extensionPayloadBuffer[ 0 ] );
+
+    /* Data longer than 16 bytes. */
+    elements[ 0 ].dataLength = sizeof( data );
+    elements[ 0 ].pData = &( data[ 0 ] );
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 1,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_TWO_BYTE_PROFILE,
+                       extension.extensionProfile );
+    TEST_ASSERT_EQUAL( 5,
+                       extension.extensionPayloadLength );
+    TEST_ASSERT_EQUAL( 0x01110000,
+                       extensionPayloadBuffer[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpExtension_Build when the elements do not fit in the
+ * buffer or in the extension length field.
+ */
+void test_RtpExtension_Build_OutOfMemory( void )
+{
+    RtpExtensionResult_t result;
+    RtpHeaderExtension_t extension = { 0 };
+    uint8_t data[ RTP_EXTENSION_TWO_BYTE_MAX_DATA_LENGTH ] = { 0 };
+    size_t i;
+
+    elements[ 0 ].id = 1;
+    elements[ 0 ].dataLength = 4;
+    elements[ 0 ].pData = &( data[ 0 ] );
+
+    /* 5 bytes need 2 words. */
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 1,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 1,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    /* More than UINT16_MAX words. */
+    for( i = 0; i < MAX_ELEMENTS; i++ )
+    {
+        elements[ i ].id = 255;
+        elements[ i ].dataLength = sizeof( data );
+        elements[ i ].pData = &( data[ 0 ] );
+    }
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 MAX_ELEMENTS,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_OUT_OF_MEMORY,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpExtension_Build in case of bad parameters.
+ */
+void test_RtpExtension_Build_BadParams( void )
+{
+    RtpExtensionResult_t result;
+    RtpHeaderExtension_t extension = { 0 };
+    uint8_t data[] = { 0x01 };
+
+    elements[ 0 ].id = 1;
+    elements[ 0 ].dataLength = sizeof( data );
+    elements[ 0 ].pData = &( data[ 0 ] );
+
+    result = RtpExtension_Build( NULL,
+                                 1,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 0,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 1,
+                                 NULL,
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 1,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 NULL );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    /* ID 0 is reserved for padding. */
+    elements[ 0 ].id = 0;
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 1,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+
+    /* Data is NULL but the length is not zero. */
+    elements[ 0 ].id = 1;
+    elements[ 0 ].pData = NULL;
+
+    result = RtpExtension_Build( &( elements[ 0 ] ),
+                                 1,
+                                 &( extensionPayloadBuffer[ 0 ] ),
+                                 EXTENSION_PAYLOAD_BUFFER_LENGTH,
+                                 &( extension ) );
+
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,408 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_jitter_buffer.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define JITTER_BUFFER_SLOTS_LENGTH    8
+
+#define START_PAYLOAD                 'S'
+#define CONTINUATION_PAYLOAD          'C'
+
+RtpJitterBuffer_t jitterBuffer;
+RtpJitterBufferSlot_t jitterBufferSlots[ JITTER_BUFFER_SLOTS_LENGTH ];
+RtpJitterBufferPacket_t poppedPackets[ JITTER_BUFFER_SLOTS_LENGTH ];
+uint8_t startPayload[] = { START_PAYLOAD };
+uint8_t continuationPayload[] = { CONTINUATION_PAYLOAD };
+
+void setUp( void )
+{
+    memset( &( jitterBuffer ),
+            0,
+            sizeof( jitterBuffer ) );
+    memset( &( jitterBufferSlots[ 0 ] ),
+            0,
+            sizeof( jitterBufferSlots ) );
+}
+
+void tearDown( void )
+{
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t GetPacketProperties( const uint8_t * pPayload,
+                                     size_t payloadLength )
+{
+    ( void ) payloadLength;
+
+    return ( pPayload[ 0 ] == START_PAYLOAD ) ? RTP_JITTER_BUFFER_PACKET_PROPERTY_START_PACKET : 0;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpJitterBufferResult_t PushPacket( uint16_t seqNum,
+                                           uint32_t rtpTimestamp,
+                                           uint8_t isMarker,
+                                           uint8_t * pPayload )
+{
+    RtpJitterBufferPacket_t packet;
+
+    packet.seqNum = seqNum;
+    packet.rtpTimestamp = rtpTimestamp;
+    packet.isMarker = isMarker;
+    packet.pPayload = pPayload;
+    packet.payloadLength = 1;
+
+    return RtpJitterBuffer_Push( &( jitterBuffer ), &( packet ) );
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpJitterBuffer_Init functionality.
+ */
+void test_RtpJitterBuffer_Init( void )
+{
+    RtpJitterBufferResult_t result;
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferSlots[ 0 ] ),
+                                   JITTER_BUFFER_SLOTS_LENGTH,
+                                   GetPacketProperties,
+                                   100 );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( JITTER_BUFFER_SLOTS_LENGTH - 1, jitterBuffer.slotsMask );
+    TEST_ASSERT_EQUAL( 100, jitterBuffer.maxLatency );
+    TEST_ASSERT_EQUAL( 0, jitterBuffer.isStarted );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpJitterBuffer_Init functionality in case of bad parameters.
+ */
+void test_RtpJitterBuffer_Init_BadParams( void )
+{
+    RtpJitterBufferResult_t result;
+
+    result = RtpJitterBuffer_Init( NULL, &( jitterBufferSlots[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, NULL, 0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ), NULL, JITTER_BUFFER_SLOTS_LENGTH, NULL, 0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ), &( jitterBufferSlots[ 0 ] ), 1, NULL, 0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ), &( jitterBufferSlots[ 0 ] ), 65536, NULL, 0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ), &( jitterBufferSlots[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH - 1, NULL, 0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Push and PopFrame functionality in case of bad parameters.
+ */
+void test_RtpJitterBuffer_BadParams( void )
+{
+    size_t packetCount;
+    RtpJitterBufferResult_t result;
+    RtpJitterBufferPacket_t packet = { 0 };
+
+    result = RtpJitterBuffer_Push( NULL, &( packet ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    result = RtpJitterBuffer_Push( &( jitterBuffer ), NULL );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    /* NULL payload. */
+    result = RtpJitterBuffer_Push( &( jitterBuffer ), &( packet ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    result = RtpJitterBuffer_PopFrame( NULL, 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, NULL, JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, NULL );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that reordered packets are released as complete frames in
+ * sequence number order, across the sequence number wrap around.
+ */
+void test_RtpJitterBuffer_Reorder( void )
+{
+    size_t packetCount;
+    RtpJitterBufferResult_t result;
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferSlots[ 0 ] ),
+                                   JITTER_BUFFER_SLOTS_LENGTH,
+                                   NULL,
+                                   0 );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+
+    /* Frame 1000: 65534, 65535, 0 (marker). Frame 4000: 1, 2 (marker). */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 65534, 1000, 0, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 0, 1000, 1, continuationPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 2, 4000, 1, continuationPayload ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 1, 4000, 0, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 65535, 1000, 0, continuationPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_DUPLICATE_PACKET, PushPacket( 65535, 1000, 0, continuationPayload ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, packetCount );
+    TEST_ASSERT_EQUAL( 65534, poppedPackets[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 65535, poppedPackets[ 1 ].seqNum );
+    TEST_ASSERT_EQUAL( 0, poppedPackets[ 2 ].seqNum );
+    TEST_ASSERT_EQUAL( 1, poppedPackets[ 2 ].isMarker );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, packetCount );
+    TEST_ASSERT_EQUAL( 1, poppedPackets[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 4000, poppedPackets[ 1 ].rtpTimestamp );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+
+    /* Already released. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_LATE_PACKET, PushPacket( 65535, 1000, 0, continuationPayload ) );
+    TEST_ASSERT_EQUAL( 1, jitterBuffer.latePacketCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a frame without the marker bit ends when the first
+ * packet of the next frame arrives.
+ */
+void test_RtpJitterBuffer_TimestampBoundary( void )
+{
+    size_t packetCount;
+    RtpJitterBufferResult_t result;
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferSlots[ 0 ] ),
+                                   JITTER_BUFFER_SLOTS_LENGTH,
+                                   NULL,
+                                   0 );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 10, 160, 0, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 11, 160, 0, startPayload ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 12, 320, 0, startPayload ) );
+
+    /* The frame does not fit in the output array. */
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), 1, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OUT_OF_MEMORY, result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, packetCount );
+    TEST_ASSERT_EQUAL( 10, poppedPackets[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 11, poppedPackets[ 1 ].seqNum );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that an incomplete frame is dropped after the maximum
+ * latency.
+ */
+void test_RtpJitterBuffer_MaxLatency( void )
+{
+    size_t packetCount;
+    RtpJitterBufferResult_t result;
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferSlots[ 0 ] ),
+                                   JITTER_BUFFER_SLOTS_LENGTH,
+                                   NULL,
+                                   100 );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+
+    /* Sequence number 11 is lost. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 10, 1000, 0, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 12, 1000, 1, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 13, 4000, 1, startPayload ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 1000, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 1100, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+
+    /* A time before the start of the wait does not drop. */
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 1101, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, packetCount );
+    TEST_ASSERT_EQUAL( 13, poppedPackets[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 2, jitterBuffer.droppedPacketCount );
+
+    /* The lost packet arrives too late. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_LATE_PACKET, PushPacket( 11, 1000, 0, startPayload ) );
+
+    /* Nothing buffered, so nothing to wait for. */
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 2000, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+    TEST_ASSERT_EQUAL( 0, jitterBuffer.isWaiting );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the packet properties are used to find the start of a
+ * frame, and that the packets of a partially lost frame are dropped.
+ */
+void test_RtpJitterBuffer_PacketProperties( void )
+{
+    size_t packetCount;
+    RtpJitterBufferResult_t result;
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferSlots[ 0 ] ),
+                                   JITTER_BUFFER_SLOTS_LENGTH,
+                                   GetPacketProperties,
+                                   100 );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+
+    /* Joining in the middle of frame 1000. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 20, 1000, 0, continuationPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 21, 1000, 1, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 22, 2000, 1, startPayload ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, packetCount );
+    TEST_ASSERT_EQUAL( 22, poppedPackets[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 2, jitterBuffer.droppedPacketCount );
+
+    /* Frame 3000 loses its first packet 23, frame 4000 is complete. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 24, 3000, 0, continuationPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 25, 3000, 1, continuationPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 26, 4000, 0, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 27, 4000, 1, continuationPayload ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 101, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, packetCount );
+    TEST_ASSERT_EQUAL( 26, poppedPackets[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 4, jitterBuffer.droppedPacketCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the oldest frames are dropped to make room for a packet
+ * too far ahead.
+ */
+void test_RtpJitterBuffer_Overflow( void )
+{
+    size_t packetCount;
+    RtpJitterBufferResult_t result;
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferSlots[ 0 ] ),
+                                   JITTER_BUFFER_SLOTS_LENGTH,
+                                   NULL,
+                                   0 );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+
+    /* Frame 1000 misses its last packet, frame 2000 starts at 2. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 0, 1000, 0, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 2, 2000, 0, startPayload ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 3, 2000, 0, startPayload ) );
+
+    /* 9 is 9 packets ahead of 0, frame 1000 has to go. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 9, 3000, 1, startPayload ) );
+    TEST_ASSERT_EQUAL( 1, jitterBuffer.droppedPacketCount );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 4, 2000, 1, startPayload ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, packetCount );
+    TEST_ASSERT_EQUAL( 2, poppedPackets[ 0 ].seqNum );
+
+    /* A jump far ahead drops everything and restarts. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( 1000, 9000, 1, startPayload ) );
+    TEST_ASSERT_EQUAL( 2, jitterBuffer.droppedPacketCount );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, packetCount );
+    TEST_ASSERT_EQUAL( 1000, poppedPackets[ 0 ].seqNum );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a frame filling all the slots is not mistaken for a
+ * complete one.
+ */
+void test_RtpJitterBuffer_FullWindow( void )
+{
+    uint16_t i;
+    size_t packetCount;
+    RtpJitterBufferResult_t result;
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferSlots[ 0 ] ),
+                                   JITTER_BUFFER_SLOTS_LENGTH,
+                                   NULL,
+                                   0 );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, result );
+
+    for( i = 0; i < JITTER_BUFFER_SLOTS_LENGTH; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK, PushPacket( i, 1000, 0, startPayload ) );
+    }
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ), 0, &( poppedPackets[ 0 ] ), JITTER_BUFFER_SLOTS_LENGTH, &( packetCount ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME, result );
+    TEST_ASSERT_EQUAL( JITTER_BUFFER_SLOTS_LENGTH - 1, jitterBuffer.scanSeqNum - jitterBuffer.headSeqNum );
+}
+
+/*-----------------------------------------------------------*/
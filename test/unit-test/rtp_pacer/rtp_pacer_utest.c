@@ -0,0 +1,351 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_pacer.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define PACER_QUEUE_COUNT                2
+#define PACER_QUEUE_LENGTH               4
+
+#define PACKET_LENGTH                    1000
+
+/* 10 bytes per millisecond. */
+#define PACER_BITRATE                    80000
+#define PACER_MAX_BURST_BYTES            PACKET_LENGTH
+
+RtpPacer_t pacer;
+RtpPacketQueue_t queues[ PACER_QUEUE_COUNT ];
+RtpPacketInfo_t queueInfos[ PACER_QUEUE_COUNT ][ PACER_QUEUE_LENGTH ];
+uint8_t storage[ 2 * PACKET_LENGTH ];
+uint8_t packet[ PACKET_LENGTH ];
+uint64_t currentTimeUs;
+
+void setUp( void )
+{
+    size_t i;
+
+    memset( &( pacer ),
+            0,
+            sizeof( pacer ) );
+    memset( &( storage[ 0 ] ),
+            0,
+            sizeof( storage ) );
+    memset( &( packet[ 0 ] ),
+            0,
+            sizeof( packet ) );
+    currentTimeUs = 0;
+
+    for( i = 0; i < PACER_QUEUE_COUNT; i++ )
+    {
+        RtpPacketQueue_Init( &( queues[ i ] ),
+                             &( queueInfos[ i ][ 0 ] ),
+                             PACER_QUEUE_LENGTH );
+    }
+}
+
+void tearDown( void )
+{
+}
+
+/*-----------------------------------------------------------*/
+
+static uint64_t GetCurrentTimeUs( void * pCustomContext )
+{
+    ( void ) pCustomContext;
+
+    return currentTimeUs;
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpPacerResult_t EnqueuePacket( size_t priority,
+                                       uint16_t seqNum )
+{
+    RtpPacketInfo_t rtpPacketInfo;
+
+    rtpPacketInfo.seqNum = seqNum;
+    rtpPacketInfo.pSerializedRtpPacket = &( packet[ 0 ] );
+    rtpPacketInfo.serializedPacketLength = PACKET_LENGTH;
+    rtpPacketInfo.insertionTime = currentTimeUs;
+
+    return RtpPacer_Enqueue( &( pacer ), priority, &( rtpPacketInfo ) );
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpPacer_Init and RtpPacer_SetRate in case of bad parameters.
+ */
+void test_RtpPacer_Init_BadParams( void )
+{
+    RtpPacerResult_t result;
+
+    result = RtpPacer_Init( NULL, &( queues[ 0 ] ), PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, PACER_BITRATE, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_Init( &( pacer ), NULL, PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, PACER_BITRATE, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), 0, GetCurrentTimeUs, NULL, PACER_BITRATE, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), PACER_QUEUE_COUNT, NULL, NULL, PACER_BITRATE, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, 0, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, PACER_BITRATE, ( size_t ) INT32_MAX + 1U );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, PACER_BITRATE, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+
+    result = RtpPacer_SetRate( NULL, PACER_BITRATE, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_SetRate( &( pacer ), 0, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_SetRate( &( pacer ), PACER_BITRATE, ( size_t ) INT32_MAX + 1U );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpPacer_Enqueue and RtpPacer_EnqueueCopy.
+ */
+void test_RtpPacer_Enqueue( void )
+{
+    RtpPacerResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+    uint64_t nextSendTimeUs;
+    size_t i;
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, PACER_BITRATE, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+
+    result = RtpPacer_Enqueue( NULL, 0, &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_Enqueue( &( pacer ), PACER_QUEUE_COUNT, &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_Enqueue( &( pacer ), 0, NULL );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_EnqueueCopy( NULL, 0, 0, &( packet[ 0 ] ), PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_EnqueueCopy( &( pacer ), PACER_QUEUE_COUNT, 0, &( packet[ 0 ] ), PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    /* No storage is set on the queue. */
+    result = RtpPacer_EnqueueCopy( &( pacer ), 1, 0, &( packet[ 0 ] ), PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_GetNextPacket( NULL, &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), NULL );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_GetNextSendTime( NULL, &( nextSendTimeUs ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    result = RtpPacer_GetNextSendTime( &( pacer ), NULL );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    for( i = 0; i < PACER_QUEUE_LENGTH; i++ )
+    {
+        result = EnqueuePacket( 0, ( uint16_t ) i );
+        TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    }
+
+    result = EnqueuePacket( 0, PACER_QUEUE_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_FULL, result );
+
+    /* The storage holds two packets. */
+    RtpPacketQueue_SetStorage( &( queues[ 1 ] ), &( storage[ 0 ] ), sizeof( storage ) );
+
+    /* A packet outside the storage is rejected. */
+    rtpPacketInfo.seqNum = 99;
+    rtpPacketInfo.pSerializedRtpPacket = &( packet[ 0 ] );
+    rtpPacketInfo.serializedPacketLength = PACKET_LENGTH;
+    rtpPacketInfo.insertionTime = 0;
+    result = RtpPacer_Enqueue( &( pacer ), 1, &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_BAD_PARAM, result );
+
+    packet[ 0 ] = 0xAA;
+    result = RtpPacer_EnqueueCopy( &( pacer ), 1, 100, &( packet[ 0 ] ), PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0xAA, storage[ 0 ] );
+
+    result = RtpPacer_EnqueueCopy( &( pacer ), 1, 101, &( packet[ 0 ] ), PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+
+    result = RtpPacer_EnqueueCopy( &( pacer ), 1, 102, &( packet[ 0 ] ), PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_PACKET_DELETED, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that packets are released in priority order.
+ */
+void test_RtpPacer_Priority( void )
+{
+    RtpPacerResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+    uint64_t nextSendTimeUs;
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, PACER_BITRATE, 10 * PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_EMPTY, result );
+
+    result = RtpPacer_GetNextSendTime( &( pacer ), &( nextSendTimeUs ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_EMPTY, result );
+
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 1, 10 ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 1, 11 ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 0, 20 ) );
+
+    result = RtpPacer_GetNextSendTime( &( pacer ), &( nextSendTimeUs ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, nextSendTimeUs );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 20, rtpPacketInfo.seqNum );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 10, rtpPacketInfo.seqNum );
+
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 0, 21 ) );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 21, rtpPacketInfo.seqNum );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 11, rtpPacketInfo.seqNum );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_EMPTY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that packets are released at the configured bitrate, with a
+ * bounded burst after an idle period.
+ */
+void test_RtpPacer_Pacing( void )
+{
+    RtpPacerResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+    uint64_t nextSendTimeUs;
+    size_t i;
+
+    currentTimeUs = 1000;
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, PACER_BITRATE, PACER_MAX_BURST_BYTES );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+
+    for( i = 0; i < PACER_QUEUE_LENGTH; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 0, ( uint16_t ) i ) );
+    }
+
+    /* The burst, then one packet in debt. */
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) ) );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_NOT_READY, result );
+
+    /* 1000 bytes at 10 bytes per millisecond. */
+    result = RtpPacer_GetNextSendTime( &( pacer ), &( nextSendTimeUs ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 101000, nextSendTimeUs );
+
+    /* A fraction of a byte is not lost between the updates. */
+    currentTimeUs = 50050;
+    result = RtpPacer_GetNextSendTime( &( pacer ), &( nextSendTimeUs ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 101000, nextSendTimeUs );
+
+    currentTimeUs = 100999;
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_NOT_READY, result );
+
+    currentTimeUs = 101000;
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, rtpPacketInfo.seqNum );
+
+    /* A clock going backwards does not add to the budget. */
+    currentTimeUs = 0;
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_NOT_READY, result );
+
+    /* After a long idle period, the burst is still bounded. */
+    currentTimeUs = 10000000;
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 0, 4 ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 0, 5 ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) ) );
+    TEST_ASSERT_EQUAL( 3, rtpPacketInfo.seqNum );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) ) );
+    TEST_ASSERT_EQUAL( 4, rtpPacketInfo.seqNum );
+
+    result = RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_NOT_READY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a rate change applies from the time of the change.
+ */
+void test_RtpPacer_SetRate( void )
+{
+    RtpPacerResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+    uint64_t nextSendTimeUs;
+
+    result = RtpPacer_Init( &( pacer ), &( queues[ 0 ] ), PACER_QUEUE_COUNT, GetCurrentTimeUs, NULL, PACER_BITRATE, 2 * PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+
+    /* A smaller burst caps the current budget. */
+    result = RtpPacer_SetRate( &( pacer ), PACER_BITRATE, PACKET_LENGTH / 2 );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 0, 0 ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, EnqueuePacket( 0, 1 ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, RtpPacer_GetNextPacket( &( pacer ), &( rtpPacketInfo ) ) );
+
+    /* 500 bytes of debt, half of which are paid at the first rate. */
+    currentTimeUs = 25000;
+    result = RtpPacer_SetRate( &( pacer ), 2 * PACER_BITRATE, PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+
+    result = RtpPacer_GetNextSendTime( &( pacer ), &( nextSendTimeUs ) );
+    TEST_ASSERT_EQUAL( RTP_PACER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 37500, nextSendTimeUs );
+}
+
+/*-----------------------------------------------------------*/
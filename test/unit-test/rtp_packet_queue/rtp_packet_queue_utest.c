@@ -537,3 +537,1222 @@ void test_RtpPacketQueue_Retrieve_BadParams( void )
 
 /*-----------------------------------------------------------*/
 
+
+/**
+ * @brief Validate that a queue with a length that is not a power of two wraps
+ * correctly.
+ */
+void test_RtpPacketQueue_NonPowerOfTwoLength( void )
+{
+    uint16_t i;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t deletedRtpPacketInfo, rtpPacketInfo;
+    uint8_t serializedPacket[] = { 0x80, 0x66, 0xAB, 0x12 };
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  5 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.indexMask );
+
+    for( i = 0; i < 12; i++ )
+    {
+        rtpPacketInfo.seqNum = i;
+        rtpPacketInfo.pSerializedRtpPacket = &( serializedPacket[ 0 ] );
+        rtpPacketInfo.serializedPacketLength = sizeof( serializedPacket );
+
+        ( void ) RtpPacketQueue_ForceEnqueue( &( rtpPacketQueue ),
+                                              &( rtpPacketInfo ),
+                                              &( deletedRtpPacketInfo ) );
+    }
+
+    TEST_ASSERT_EQUAL( 5, rtpPacketQueue.packetCount );
+    TEST_ASSERT_EQUAL( 2, rtpPacketQueue.writeIndex );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      9,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 9, rtpPacketInfo.seqNum );
+
+    for( i = 7; i < 12; i++ )
+    {
+        result = RtpPacketQueue_Dequeue( &( rtpPacketQueue ),
+                                         &( rtpPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( i, rtpPacketInfo.seqNum );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpPacketQueue_InitDirectMapped in case of bad parameters.
+ */
+void test_RtpPacketQueue_InitDirectMapped_BadParams( void )
+{
+    RtpPacketQueueResult_t result;
+
+    result = RtpPacketQueue_InitDirectMapped( NULL,
+                                              &( rtpPacketInfoArray[ 0 ] ),
+                                              MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_InitDirectMapped( &( rtpPacketQueue ),
+                                              &( rtpPacketInfoArray[ 0 ] ),
+                                              MAX_IN_FLIGHT_PKTS - 1 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the retrieval from a direct mapped queue, including the
+ * sequence number wrap around.
+ */
+void test_RtpPacketQueue_DirectMapped_Retrieve( void )
+{
+    uint16_t i, seqNum;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t deletedRtpPacketInfo, rtpPacketInfo;
+    uint8_t serializedPacket[ 200 ];
+
+    result = RtpPacketQueue_InitDirectMapped( &( rtpPacketQueue ),
+                                              &( rtpPacketInfoArray[ 0 ] ),
+                                              MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* Sequence numbers 65436 to 99, wrapping around 65535. */
+    for( i = 0; i < 200; i++ )
+    {
+        seqNum = ( uint16_t ) ( 65436U + i );
+        rtpPacketInfo.seqNum = seqNum;
+        rtpPacketInfo.pSerializedRtpPacket = &( serializedPacket[ i ] );
+        rtpPacketInfo.serializedPacketLength = i;
+
+        ( void ) RtpPacketQueue_ForceEnqueue( &( rtpPacketQueue ),
+                                              &( rtpPacketInfo ),
+                                              &( deletedRtpPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( seqNum & ( MAX_IN_FLIGHT_PKTS - 1 ),
+                           ( rtpPacketQueue.writeIndex - 1 ) & ( MAX_IN_FLIGHT_PKTS - 1 ) );
+    }
+
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.unmappedCount );
+
+    /* Oldest packet still in the queue. */
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      65508,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 65508, rtpPacketInfo.seqNum );
+    TEST_ASSERT_EQUAL( &( serializedPacket[ 72 ] ), rtpPacketInfo.pSerializedRtpPacket );
+    TEST_ASSERT_EQUAL( 72, rtpPacketInfo.serializedPacketLength );
+
+    /* Packet before the wrap around. */
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      65535,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 99, rtpPacketInfo.serializedPacketLength );
+
+    /* Evicted packet. */
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      65507,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND, result );
+
+    /* Same slot as sequence number 50, but a different tag. */
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      50 + MAX_IN_FLIGHT_PKTS,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a direct mapped queue leaves the packets before a
+ * sequence number gap to the scan, and re-anchors once emptied.
+ */
+void test_RtpPacketQueue_DirectMapped_Misaligned( void )
+{
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 };
+
+    result = RtpPacketQueue_InitDirectMapped( &( rtpPacketQueue ),
+                                              &( rtpPacketInfoArray[ 0 ] ),
+                                              MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    rtpPacketInfo.seqNum = 10;
+    result = RtpPacketQueue_Enqueue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 10, rtpPacketQueue.readIndex );
+
+    /* Sequence number 11 is missing. */
+    rtpPacketInfo.seqNum = 12;
+    result = RtpPacketQueue_Enqueue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, rtpPacketQueue.unmappedCount );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      12,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 12, rtpPacketInfo.seqNum );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      10,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 10, rtpPacketInfo.seqNum );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      11,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND, result );
+
+    result = RtpPacketQueue_Dequeue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    result = RtpPacketQueue_Dequeue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* The empty queue is re-anchored on the next packet. */
+    rtpPacketInfo.seqNum = 500;
+    result = RtpPacketQueue_Enqueue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.unmappedCount );
+    TEST_ASSERT_EQUAL( 500 & ( MAX_IN_FLIGHT_PKTS - 1 ), rtpPacketQueue.readIndex );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      500,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 500, rtpPacketInfo.seqNum );
+
+    /* The slot of sequence number 501 is not occupied yet. */
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      501,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a full direct mapped queue, which never empties, keeps
+ * the direct lookup across a sequence number gap.
+ */
+void test_RtpPacketQueue_DirectMapped_Gap( void )
+{
+    size_t i, index;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 }, deletedRtpPacketInfo;
+
+    result = RtpPacketQueue_InitDirectMapped( &( rtpPacketQueue ),
+                                              &( rtpPacketInfoArray[ 0 ] ),
+                                              MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* Sequence number 1100 is skipped once the queue is full. */
+    for( i = 0; i < 200 + MAX_IN_FLIGHT_PKTS; i++ )
+    {
+        rtpPacketInfo.seqNum = ( uint16_t ) ( ( i < 200 ) ? ( 900 + i ) : ( 901 + i ) );
+        rtpPacketInfo.serializedPacketLength = i;
+
+        ( void ) RtpPacketQueue_ForceEnqueue( &( rtpPacketQueue ),
+                                              &( rtpPacketInfo ),
+                                              &( deletedRtpPacketInfo ) );
+
+        if( i == 200 )
+        {
+            TEST_ASSERT_EQUAL( MAX_IN_FLIGHT_PKTS - 1, rtpPacketQueue.unmappedCount );
+
+            /* Packets after the gap are found with the direct lookup. */
+            result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                              1101,
+                                              &( rtpPacketInfo ) );
+
+            TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+            TEST_ASSERT_EQUAL( 200, rtpPacketInfo.serializedPacketLength );
+
+            /* Packets before the gap are found with the scan. */
+            result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                              1099,
+                                              &( rtpPacketInfo ) );
+
+            TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+            TEST_ASSERT_EQUAL( 199, rtpPacketInfo.serializedPacketLength );
+
+            result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                              1100,
+                                              &( rtpPacketInfo ) );
+
+            TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND, result );
+        }
+    }
+
+    /* All the packets before the gap were evicted. */
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.unmappedCount );
+
+    for( i = 200; i < 200 + MAX_IN_FLIGHT_PKTS; i++ )
+    {
+        result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                          ( uint16_t ) ( 901 + i ),
+                                          &( rtpPacketInfo ) );
+
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( i, rtpPacketInfo.serializedPacketLength );
+    }
+
+    /* Move the tag of a packet to the next slot - a scan would still find it,
+     * the direct lookup does not. */
+    index = ( ( size_t ) 1200 + rtpPacketQueue.mappingOffset ) & ( MAX_IN_FLIGHT_PKTS - 1 );
+    rtpPacketQueue.pRtpPacketInfoArray[ index ].seqNum = 1;
+    rtpPacketQueue.pRtpPacketInfoArray[ ( index + 1 ) & ( MAX_IN_FLIGHT_PKTS - 1 ) ].seqNum = ( uint16_t ) 1200;
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      ( uint16_t ) 1200,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate batch enqueue, peek and dequeue across the end of the RTP
+ * packet info array.
+ */
+void test_RtpPacketQueue_Batch( void )
+{
+    uint16_t i;
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfos[ 8 ];
+    uint8_t serializedPacket[ 16 ];
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  10 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    for( i = 0; i < 8; i++ )
+    {
+        rtpPacketInfos[ i ].seqNum = i;
+        rtpPacketInfos[ i ].pSerializedRtpPacket = &( serializedPacket[ i ] );
+        rtpPacketInfos[ i ].serializedPacketLength = i;
+    }
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          8,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 8, count );
+
+    result = RtpPacketQueue_DequeueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          6,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 6, count );
+    TEST_ASSERT_EQUAL( 5, rtpPacketInfos[ 5 ].seqNum );
+    TEST_ASSERT_EQUAL( 2, rtpPacketQueue.packetCount );
+
+    /* The batch wraps around the end of the RTP packet info array. */
+    for( i = 0; i < 8; i++ )
+    {
+        rtpPacketInfos[ i ].seqNum = 8 + i;
+        rtpPacketInfos[ i ].pSerializedRtpPacket = &( serializedPacket[ 8 + i ] );
+        rtpPacketInfos[ i ].serializedPacketLength = 8 + i;
+    }
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          8,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 8, count );
+    TEST_ASSERT_EQUAL( 6, rtpPacketQueue.writeIndex );
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          1,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_FULL, result );
+    TEST_ASSERT_EQUAL( 0, count );
+
+    result = RtpPacketQueue_PeekBatch( &( rtpPacketQueue ),
+                                       &( rtpPacketInfos[ 0 ] ),
+                                       8,
+                                       &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 8, count );
+    TEST_ASSERT_EQUAL( 10, rtpPacketQueue.packetCount );
+
+    for( i = 0; i < 8; i++ )
+    {
+        TEST_ASSERT_EQUAL( 6 + i, rtpPacketInfos[ i ].seqNum );
+        TEST_ASSERT_EQUAL( &( serializedPacket[ 6 + i ] ), rtpPacketInfos[ i ].pSerializedRtpPacket );
+        TEST_ASSERT_EQUAL( 6 + i, rtpPacketInfos[ i ].serializedPacketLength );
+    }
+
+    result = RtpPacketQueue_DequeueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          8,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 8, count );
+
+    result = RtpPacketQueue_DequeueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          8,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, count );
+    TEST_ASSERT_EQUAL( 15, rtpPacketInfos[ 1 ].seqNum );
+
+    result = RtpPacketQueue_DequeueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          8,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_EMPTY, result );
+    TEST_ASSERT_EQUAL( 0, count );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a partially enqueued batch reports the enqueued count.
+ */
+void test_RtpPacketQueue_EnqueueBatch_Partial( void )
+{
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfos[ 4 ] = { 0 };
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  3 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          4,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_FULL, result );
+    TEST_ASSERT_EQUAL( 3, count );
+    TEST_ASSERT_EQUAL( 3, rtpPacketQueue.packetCount );
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.writeIndex );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that batch enqueue keeps a direct mapped queue aligned.
+ */
+void test_RtpPacketQueue_EnqueueBatch_DirectMapped( void )
+{
+    uint16_t i;
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfos[ 4 ] = { 0 }, rtpPacketInfo;
+
+    result = RtpPacketQueue_InitDirectMapped( &( rtpPacketQueue ),
+                                              &( rtpPacketInfoArray[ 0 ] ),
+                                              MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    for( i = 0; i < 4; i++ )
+    {
+        rtpPacketInfos[ i ].seqNum = 1000 + i;
+    }
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          4,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.unmappedCount );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      1003,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1003, rtpPacketInfo.seqNum );
+
+    /* A gap within the batch breaks the alignment. */
+    rtpPacketInfos[ 0 ].seqNum = 1004;
+    rtpPacketInfos[ 1 ].seqNum = 1006;
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          2,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 5, rtpPacketQueue.unmappedCount );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      1006,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1006, rtpPacketInfo.seqNum );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate batch functions in case of bad parameters.
+ */
+void test_RtpPacketQueue_Batch_BadParams( void )
+{
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfos[ 2 ] = { 0 };
+
+    result = RtpPacketQueue_EnqueueBatch( NULL, &( rtpPacketInfos[ 0 ] ), 2, &( count ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ), NULL, 2, &( count ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ), &( rtpPacketInfos[ 0 ] ), 2, NULL );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_DequeueBatch( NULL, &( rtpPacketInfos[ 0 ] ), 2, &( count ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_PeekBatch( &( rtpPacketQueue ), NULL, 2, &( count ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_PeekBatch( &( rtpPacketQueue ), &( rtpPacketInfos[ 0 ] ), 0, &( count ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_PeekBatch( &( rtpPacketQueue ), &( rtpPacketInfos[ 0 ] ), 2, NULL );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the queue tracks the total serialized packet length.
+ */
+void test_RtpPacketQueue_TotalBytes( void )
+{
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfos[ 3 ] = { 0 }, deletedRtpPacketInfo;
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  3 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    rtpPacketInfos[ 0 ].serializedPacketLength = 100;
+    rtpPacketInfos[ 1 ].serializedPacketLength = 200;
+    rtpPacketInfos[ 2 ].serializedPacketLength = 300;
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          3,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 600, rtpPacketQueue.totalBytes );
+
+    rtpPacketInfos[ 0 ].serializedPacketLength = 1000;
+    result = RtpPacketQueue_ForceEnqueue( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          &( deletedRtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_DELETED, result );
+    TEST_ASSERT_EQUAL( 100, deletedRtpPacketInfo.serializedPacketLength );
+    TEST_ASSERT_EQUAL( 1500, rtpPacketQueue.totalBytes );
+
+    result = RtpPacketQueue_Dequeue( &( rtpPacketQueue ),
+                                     &( deletedRtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1300, rtpPacketQueue.totalBytes );
+
+    result = RtpPacketQueue_DequeueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          3,
+                                          &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, count );
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.totalBytes );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the eviction of the oldest packet infos when the byte limit
+ * is exceeded.
+ */
+void test_RtpPacketQueue_Evict_MaxBytes( void )
+{
+    uint16_t i;
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 }, evictedRtpPacketInfos[ 4 ];
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    result = RtpPacketQueue_SetLimits( &( rtpPacketQueue ), 1000, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    for( i = 0; i < 10; i++ )
+    {
+        rtpPacketInfo.seqNum = i;
+        rtpPacketInfo.serializedPacketLength = 150;
+        rtpPacketInfo.insertionTime = i;
+
+        result = RtpPacketQueue_Enqueue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    }
+
+    /* 1500 bytes, 4 packet infos must go to get to 900. Evict in two calls. */
+    result = RtpPacketQueue_Evict( &( rtpPacketQueue ),
+                                   1000000,
+                                   &( evictedRtpPacketInfos[ 0 ] ),
+                                   3,
+                                   &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, count );
+    TEST_ASSERT_EQUAL( 0, evictedRtpPacketInfos[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 2, evictedRtpPacketInfos[ 2 ].seqNum );
+    TEST_ASSERT_EQUAL( 2, evictedRtpPacketInfos[ 2 ].insertionTime );
+
+    result = RtpPacketQueue_Evict( &( rtpPacketQueue ),
+                                   1000000,
+                                   &( evictedRtpPacketInfos[ 0 ] ),
+                                   4,
+                                   &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, count );
+    TEST_ASSERT_EQUAL( 3, evictedRtpPacketInfos[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 900, rtpPacketQueue.totalBytes );
+    TEST_ASSERT_EQUAL( 6, rtpPacketQueue.packetCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the eviction of the packet infos older than the age limit.
+ */
+void test_RtpPacketQueue_Evict_MaxAge( void )
+{
+    uint16_t i;
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 }, evictedRtpPacketInfos[ 8 ];
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* Keep packet infos for 150 ms, e.g. 1.5 x 100 ms RTT. */
+    result = RtpPacketQueue_SetLimits( &( rtpPacketQueue ), 0, 150 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* One packet every 33 ms, starting at t = 1000 ms. */
+    for( i = 0; i < 8; i++ )
+    {
+        rtpPacketInfo.seqNum = i;
+        rtpPacketInfo.serializedPacketLength = 1200;
+        rtpPacketInfo.insertionTime = 1000 + ( 33 * i );
+
+        result = RtpPacketQueue_Enqueue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    }
+
+    /* Packet infos inserted before t = 1100 ms are too old at t = 1250 ms. */
+    result = RtpPacketQueue_Evict( &( rtpPacketQueue ),
+                                   1250,
+                                   &( evictedRtpPacketInfos[ 0 ] ),
+                                   8,
+                                   &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, count );
+    TEST_ASSERT_EQUAL( 3, evictedRtpPacketInfos[ 3 ].seqNum );
+    TEST_ASSERT_EQUAL( 4 * 1200, rtpPacketQueue.totalBytes );
+
+    /* A current time before the insertion time never evicts. */
+    result = RtpPacketQueue_Evict( &( rtpPacketQueue ),
+                                   0,
+                                   &( evictedRtpPacketInfos[ 0 ] ),
+                                   8,
+                                   &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, count );
+
+    /* Everything is too old eventually. */
+    result = RtpPacketQueue_Evict( &( rtpPacketQueue ),
+                                   5000,
+                                   &( evictedRtpPacketInfos[ 0 ] ),
+                                   8,
+                                   &( count ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, count );
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.packetCount );
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.totalBytes );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate SetLimits and Evict functionality in case of bad parameters.
+ */
+void test_RtpPacketQueue_Evict_BadParams( void )
+{
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t evictedRtpPacketInfo;
+
+    result = RtpPacketQueue_SetLimits( NULL, 1000, 150 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Evict( NULL, 0, &( evictedRtpPacketInfo ), 1, &( count ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Evict( &( rtpPacketQueue ), 0, NULL, 1, &( count ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Evict( &( rtpPacketQueue ), 0, &( evictedRtpPacketInfo ), 1, NULL );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the retrieval of the packets requested by a NACK bitmask,
+ * across the sequence number wrap around.
+ */
+void test_RtpPacketQueue_RetrieveMask( void )
+{
+    uint16_t i;
+    size_t count;
+    uint32_t missingMask;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 }, rtpPacketInfos[ RTP_PACKET_QUEUE_NACK_MAX_PACKETS ];
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* Sequence numbers 65530 to 3, without 65533. */
+    for( i = 0; i < 10; i++ )
+    {
+        rtpPacketInfo.seqNum = ( uint16_t ) ( 65530U + i );
+        rtpPacketInfo.serializedPacketLength = i;
+
+        if( rtpPacketInfo.seqNum != 65533 )
+        {
+            result = RtpPacketQueue_Enqueue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+            TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+        }
+    }
+
+    /* Request 65532, 65533, 65535, 2 and 10. */
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ),
+                                          65532,
+                                          0x0001 | 0x0004 | 0x0020 | 0x2000,
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          5,
+                                          &( count ),
+                                          &( missingMask ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, count );
+    TEST_ASSERT_EQUAL( 65532, rtpPacketInfos[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 65535, rtpPacketInfos[ 1 ].seqNum );
+    TEST_ASSERT_EQUAL( 2, rtpPacketInfos[ 2 ].seqNum );
+    TEST_ASSERT_EQUAL( 8, rtpPacketInfos[ 2 ].serializedPacketLength );
+    TEST_ASSERT_EQUAL( ( 1U << 1 ) | ( 1U << 14 ), missingMask );
+    TEST_ASSERT_EQUAL( 9, rtpPacketQueue.packetCount );
+
+    /* Only the PID. */
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ),
+                                          65530,
+                                          0,
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          1,
+                                          &( count ),
+                                          &( missingMask ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, count );
+    TEST_ASSERT_EQUAL( 65530, rtpPacketInfos[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 0, missingMask );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the retrieval of the packets requested by a NACK bitmask from
+ * a direct mapped queue.
+ */
+void test_RtpPacketQueue_RetrieveMask_DirectMapped( void )
+{
+    uint16_t i;
+    size_t count;
+    uint32_t missingMask;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 }, deletedRtpPacketInfo, rtpPacketInfos[ RTP_PACKET_QUEUE_NACK_MAX_PACKETS ];
+
+    result = RtpPacketQueue_InitDirectMapped( &( rtpPacketQueue ),
+                                              &( rtpPacketInfoArray[ 0 ] ),
+                                              MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* Sequence numbers 0 to 99 were evicted. */
+    for( i = 0; i < 100 + MAX_IN_FLIGHT_PKTS; i++ )
+    {
+        rtpPacketInfo.seqNum = i;
+
+        ( void ) RtpPacketQueue_ForceEnqueue( &( rtpPacketQueue ),
+                                              &( rtpPacketInfo ),
+                                              &( deletedRtpPacketInfo ) );
+    }
+
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.unmappedCount );
+
+    /* Request 90 to 106, except 105. */
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ),
+                                          90,
+                                          0xBFFF,
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          RTP_PACKET_QUEUE_NACK_MAX_PACKETS,
+                                          &( count ),
+                                          &( missingMask ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 6, count );
+    TEST_ASSERT_EQUAL( 100, rtpPacketInfos[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 106, rtpPacketInfos[ 5 ].seqNum );
+    TEST_ASSERT_EQUAL( 0x3FF, missingMask );
+
+    /* The packets before a sequence number gap are left to the scan. */
+    rtpPacketInfo.seqNum = 300;
+    ( void ) RtpPacketQueue_ForceEnqueue( &( rtpPacketQueue ),
+                                          &( rtpPacketInfo ),
+                                          &( deletedRtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( MAX_IN_FLIGHT_PKTS - 1, rtpPacketQueue.unmappedCount );
+
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ),
+                                          299,
+                                          0x0001,
+                                          &( rtpPacketInfos[ 0 ] ),
+                                          2,
+                                          &( count ),
+                                          &( missingMask ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, count );
+    TEST_ASSERT_EQUAL( 300, rtpPacketInfos[ 0 ].seqNum );
+    TEST_ASSERT_EQUAL( 0x1, missingMask );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpPacketQueue_RetrieveMask functionality in case of an
+ * empty queue and bad parameters.
+ */
+void test_RtpPacketQueue_RetrieveMask_EmptyAndBadParams( void )
+{
+    size_t count;
+    uint32_t missingMask;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfos[ 2 ];
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ), 10, 0x8000, &( rtpPacketInfos[ 0 ] ), 2, &( count ), &( missingMask ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_EMPTY, result );
+    TEST_ASSERT_EQUAL( 0, count );
+    TEST_ASSERT_EQUAL( 0x10001, missingMask );
+
+    /* Three packets requested, room for two. */
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ), 10, 0x0003, &( rtpPacketInfos[ 0 ] ), 2, &( count ), &( missingMask ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_RetrieveMask( NULL, 10, 0, &( rtpPacketInfos[ 0 ] ), 2, &( count ), &( missingMask ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ), 10, 0, NULL, 2, &( count ), &( missingMask ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ), 10, 0, &( rtpPacketInfos[ 0 ] ), 2, NULL, &( missingMask ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_RetrieveMask( &( rtpPacketQueue ), 10, 0, &( rtpPacketInfos[ 0 ] ), 2, &( count ), NULL );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the serialized packets are copied into the queue
+ * storage and that the storage is reclaimed in FIFO order.
+ */
+void test_RtpPacketQueue_EnqueueCopy( void )
+{
+    uint16_t i;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+    uint8_t storage[ 100 ];
+    uint8_t serializedPacket[ 30 ];
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  8 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    result = RtpPacketQueue_SetStorage( &( rtpPacketQueue ),
+                                        &( storage[ 0 ] ),
+                                        sizeof( storage ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* Packets 0, 1 and 2 take bytes 0 to 89. */
+    for( i = 0; i < 3; i++ )
+    {
+        memset( &( serializedPacket[ 0 ] ), i, sizeof( serializedPacket ) );
+
+        result = RtpPacketQueue_EnqueueCopy( &( rtpPacketQueue ),
+                                             i,
+                                             &( serializedPacket[ 0 ] ),
+                                             sizeof( serializedPacket ),
+                                             i );
+
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    }
+
+    /* Packet 3 does not fit in the last 10 bytes, so it replaces packet 0. */
+    memset( &( serializedPacket[ 0 ] ), 3, sizeof( serializedPacket ) );
+
+    result = RtpPacketQueue_EnqueueCopy( &( rtpPacketQueue ),
+                                         3,
+                                         &( serializedPacket[ 0 ] ),
+                                         sizeof( serializedPacket ),
+                                         3 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_DELETED, result );
+    TEST_ASSERT_EQUAL( 3, rtpPacketQueue.packetCount );
+    TEST_ASSERT_EQUAL( 90, rtpPacketQueue.totalBytes );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      3,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( &( storage[ 0 ] ), rtpPacketInfo.pSerializedRtpPacket );
+    TEST_ASSERT_EACH_EQUAL_UINT8( 3, rtpPacketInfo.pSerializedRtpPacket, 30 );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      2,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( &( storage[ 60 ] ), rtpPacketInfo.pSerializedRtpPacket );
+    TEST_ASSERT_EACH_EQUAL_UINT8( 2, rtpPacketInfo.pSerializedRtpPacket, 30 );
+
+    /* Removing packet 1 frees bytes 30 to 59. */
+    result = RtpPacketQueue_Dequeue( &( rtpPacketQueue ),
+                                     &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, rtpPacketInfo.seqNum );
+
+    result = RtpPacketQueue_EnqueueCopy( &( rtpPacketQueue ),
+                                         4,
+                                         &( serializedPacket[ 0 ] ),
+                                         20,
+                                         4 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* Only 10 bytes left before packet 2, so packet 2 is removed. */
+    result = RtpPacketQueue_EnqueueCopy( &( rtpPacketQueue ),
+                                         5,
+                                         &( serializedPacket[ 0 ] ),
+                                         20,
+                                         5 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_DELETED, result );
+
+    result = RtpPacketQueue_Peek( &( rtpPacketQueue ),
+                                  &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, rtpPacketInfo.seqNum );
+
+    result = RtpPacketQueue_Retrieve( &( rtpPacketQueue ),
+                                      5,
+                                      &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( &( storage[ 50 ] ), rtpPacketInfo.pSerializedRtpPacket );
+    TEST_ASSERT_EQUAL( 5, rtpPacketInfo.insertionTime );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate serializing a packet in place with Reserve and Commit.
+ */
+void test_RtpPacketQueue_ReserveCommit( void )
+{
+    uint16_t i;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+    uint8_t storage[ 1500 ];
+    uint8_t * pBuffer = NULL;
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  2 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    result = RtpPacketQueue_SetStorage( &( rtpPacketQueue ),
+                                        &( storage[ 0 ] ),
+                                        sizeof( storage ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    for( i = 0; i < 3; i++ )
+    {
+        result = RtpPacketQueue_Reserve( &( rtpPacketQueue ),
+                                         200,
+                                         &( pBuffer ) );
+
+        /* The third packet needs a packet info slot. */
+        TEST_ASSERT_EQUAL( ( i < 2 ) ? RTP_PACKET_QUEUE_RESULT_OK : RTP_PACKET_QUEUE_RESULT_PACKET_DELETED,
+                           result );
+
+        memset( pBuffer, 0xA0 + i, 100 );
+
+        result = RtpPacketQueue_Commit( &( rtpPacketQueue ),
+                                        i,
+                                        100,
+                                        0 );
+
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    }
+
+    /* Only the committed length is used. */
+    TEST_ASSERT_EQUAL( 300, rtpPacketQueue.storageWriteOffset );
+    TEST_ASSERT_EQUAL( 200, rtpPacketQueue.totalBytes );
+
+    result = RtpPacketQueue_Peek( &( rtpPacketQueue ),
+                                  &( rtpPacketInfo ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, rtpPacketInfo.seqNum );
+    TEST_ASSERT_EQUAL( &( storage[ 100 ] ), rtpPacketInfo.pSerializedRtpPacket );
+    TEST_ASSERT_EACH_EQUAL_UINT8( 0xA1, rtpPacketInfo.pSerializedRtpPacket, 100 );
+
+    /* Nothing was reserved. */
+    result = RtpPacketQueue_Commit( &( rtpPacketQueue ), 3, 100, 0 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Reserve( &( rtpPacketQueue ), 200, &( pBuffer ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_DELETED, result );
+
+    /* Longer than reserved. */
+    result = RtpPacketQueue_Commit( &( rtpPacketQueue ), 3, 201, 0 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Commit( &( rtpPacketQueue ), 3, 0, 0 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    /* Larger than the storage. */
+    result = RtpPacketQueue_Reserve( &( rtpPacketQueue ), sizeof( storage ) + 1, &( pBuffer ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_FULL, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate storage functions in case of bad parameters.
+ */
+void test_RtpPacketQueue_Storage_BadParams( void )
+{
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 };
+    uint8_t storage[ 100 ];
+    uint8_t * pBuffer = NULL;
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* No storage set. */
+    result = RtpPacketQueue_Reserve( &( rtpPacketQueue ), 10, &( pBuffer ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_SetStorage( NULL, &( storage[ 0 ] ), sizeof( storage ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_SetStorage( &( rtpPacketQueue ), NULL, sizeof( storage ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_SetStorage( &( rtpPacketQueue ), &( storage[ 0 ] ), 0 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Enqueue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* The queue is not empty. */
+    result = RtpPacketQueue_SetStorage( &( rtpPacketQueue ), &( storage[ 0 ] ), sizeof( storage ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Reserve( NULL, 10, &( pBuffer ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    rtpPacketQueue.pStorage = &( storage[ 0 ] );
+
+    result = RtpPacketQueue_Reserve( &( rtpPacketQueue ), 0, &( pBuffer ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Reserve( &( rtpPacketQueue ), 10, NULL );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_Commit( NULL, 0, 10, 0 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_EnqueueCopy( &( rtpPacketQueue ), 0, NULL, 10, 0 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_EnqueueCopy( NULL, 0, &( storage[ 0 ] ), 10, 0 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that packets outside the storage cannot be added once the
+ * storage is set.
+ */
+void test_RtpPacketQueue_Storage_ExternalPackets( void )
+{
+    size_t count;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 }, deletedRtpPacketInfo;
+    uint8_t storage[ 100 ];
+    uint8_t serializedPacket[ 80 ] = { 0 };
+
+    result = RtpPacketQueue_Init( &( rtpPacketQueue ),
+                                  &( rtpPacketInfoArray[ 0 ] ),
+                                  8 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    result = RtpPacketQueue_SetStorage( &( rtpPacketQueue ),
+                                        &( storage[ 0 ] ),
+                                        sizeof( storage ) );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    rtpPacketInfo.pSerializedRtpPacket = &( serializedPacket[ 0 ] );
+    rtpPacketInfo.serializedPacketLength = 20;
+
+    result = RtpPacketQueue_Enqueue( &( rtpPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_ForceEnqueue( &( rtpPacketQueue ),
+                                          &( rtpPacketInfo ),
+                                          &( deletedRtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpPacketQueue_EnqueueBatch( &( rtpPacketQueue ),
+                                          &( rtpPacketInfo ),
+                                          1,
+                                          &( count ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+    TEST_ASSERT_EQUAL( 0, rtpPacketQueue.packetCount );
+
+    /* The second packet replaces the first one in the storage. */
+    result = RtpPacketQueue_EnqueueCopy( &( rtpPacketQueue ),
+                                         0,
+                                         &( serializedPacket[ 0 ] ),
+                                         sizeof( serializedPacket ),
+                                         0 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    result = RtpPacketQueue_EnqueueCopy( &( rtpPacketQueue ),
+                                         1,
+                                         &( serializedPacket[ 0 ] ),
+                                         sizeof( serializedPacket ),
+                                         1 );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_PACKET_DELETED, result );
+    TEST_ASSERT_EQUAL( 1, rtpPacketQueue.packetCount );
+    TEST_ASSERT_EQUAL_PTR( &( storage[ 0 ] ),
+                           rtpPacketQueue.pRtpPacketInfoArray[ rtpPacketQueue.readIndex ].pSerializedRtpPacket );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,312 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_playout_delay.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define PLAYOUT_DELAY_WINDOW_LENGTH    10
+
+/* One RTP tick per millisecond keeps the arithmetic readable. */
+#define CLOCK_RATE                     1000
+#define FRAME_DURATION                 20
+
+RtpPlayoutDelay_t playoutDelay;
+uint8_t window[ PLAYOUT_DELAY_WINDOW_LENGTH ];
+
+void setUp( void )
+{
+    memset( &( playoutDelay ),
+            0,
+            sizeof( playoutDelay ) );
+    memset( &( window[ 0 ] ),
+            0,
+            sizeof( window ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpPlayoutDelay_Init in case of bad parameters.
+ */
+void test_RtpPlayoutDelay_Init_BadParams( void )
+{
+    RtpPlayoutDelayResult_t result;
+
+    result = RtpPlayoutDelay_Init( NULL, &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 90, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), NULL, PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 90, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), 0, CLOCK_RATE, 90, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), ( size_t ) UINT16_MAX + 1U, CLOCK_RATE, 90, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, 0, 90, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 0, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 101, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 90, 1000, 0 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the other APIs in case of bad parameters and before any
+ * packet is received.
+ */
+void test_RtpPlayoutDelay_BadParamsAndNoData( void )
+{
+    RtpPlayoutDelayResult_t result;
+    uint32_t targetDelayMs;
+    uint64_t releaseTimeMs;
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 90, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    result = RtpPlayoutDelay_Update( NULL, 0, 0 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_GetTargetDelay( NULL, &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), NULL );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_GetReleaseTime( NULL, 0, &( releaseTimeMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_GetReleaseTime( &( playoutDelay ), 0, NULL );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_BAD_PARAM, result );
+
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_NO_DATA, result );
+
+    result = RtpPlayoutDelay_GetReleaseTime( &( playoutDelay ), 0, &( releaseTimeMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_NO_DATA, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the target delay and release time of packets arriving with
+ * a constant network delay.
+ */
+void test_RtpPlayoutDelay_ConstantDelay( void )
+{
+    RtpPlayoutDelayResult_t result;
+    uint32_t i, targetDelayMs;
+    uint64_t releaseTimeMs;
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 90, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    for( i = 0; i < 2 * PLAYOUT_DELAY_WINDOW_LENGTH; i++ )
+    {
+        result = RtpPlayoutDelay_Update( &( playoutDelay ), i * FRAME_DURATION, 1000 + ( i * FRAME_DURATION ) );
+        TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    }
+
+    /* Every delay is in the first bucket. */
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS, targetDelayMs );
+
+    result = RtpPlayoutDelay_GetReleaseTime( &( playoutDelay ), 20 * FRAME_DURATION, &( releaseTimeMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1000 + ( 20 * FRAME_DURATION ) + RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS, releaseTimeMs );
+
+    /* A frame older than the last received one. */
+    result = RtpPlayoutDelay_GetReleaseTime( &( playoutDelay ), 10 * FRAME_DURATION, &( releaseTimeMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1000 + ( 10 * FRAME_DURATION ) + RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS, releaseTimeMs );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target delay follows a delay spike and decays once
+ * the spike leaves the window.
+ */
+void test_RtpPlayoutDelay_DelaySpike( void )
+{
+    RtpPlayoutDelayResult_t result;
+    uint32_t i, targetDelayMs;
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 100, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    for( i = 0; i < PLAYOUT_DELAY_WINDOW_LENGTH; i++ )
+    {
+        result = RtpPlayoutDelay_Update( &( playoutDelay ), i * FRAME_DURATION, i * FRAME_DURATION );
+        TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    }
+
+    /* One packet delayed by 52 ms. */
+    result = RtpPlayoutDelay_Update( &( playoutDelay ), i * FRAME_DURATION, ( i * FRAME_DURATION ) + 52 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    i++;
+
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 55, targetDelayMs );
+
+    for( ; i <= 2 * PLAYOUT_DELAY_WINDOW_LENGTH; i++ )
+    {
+        result = RtpPlayoutDelay_Update( &( playoutDelay ), i * FRAME_DURATION, i * FRAME_DURATION );
+        TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    }
+
+    /* Only the decaying jitter estimate is left above the first bucket. */
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( ( ( playoutDelay.jitter >> 4 ) * RTP_PLAYOUT_DELAY_JITTER_FACTOR ), targetDelayMs );
+    TEST_ASSERT_GREATER_THAN( RTP_PLAYOUT_DELAY_BUCKET_WIDTH_MS, targetDelayMs );
+    TEST_ASSERT_LESS_THAN( 55, targetDelayMs );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that delays beyond the histogram range are counted in the
+ * last bucket and that the target delay is clamped.
+ */
+void test_RtpPlayoutDelay_Clamp( void )
+{
+    RtpPlayoutDelayResult_t result;
+    uint32_t targetDelayMs;
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 100, 40, 5000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    result = RtpPlayoutDelay_Update( &( playoutDelay ), 0, 0 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 40, targetDelayMs );
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 100, 0, 100000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    result = RtpPlayoutDelay_Update( &( playoutDelay ), 0, 0 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    result = RtpPlayoutDelay_Update( &( playoutDelay ), FRAME_DURATION, FRAME_DURATION + 1000000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    result = RtpPlayoutDelay_Update( &( playoutDelay ), 2 * FRAME_DURATION, 2 * FRAME_DURATION );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    /* The jitter estimate exceeds the maximum delay. */
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 100000, targetDelayMs );
+
+    /* The 1000 s delay is counted in the last bucket. */
+    TEST_ASSERT_EQUAL( 1, playoutDelay.histogram[ RTP_PLAYOUT_DELAY_BUCKET_COUNT - 1 ] );
+    TEST_ASSERT_EQUAL( 2, playoutDelay.histogram[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the zero delay reference follows the fastest packets
+ * and the clock drift, across an RTP timestamp wrap around.
+ */
+void test_RtpPlayoutDelay_BaseTransit( void )
+{
+    RtpPlayoutDelayResult_t result;
+    uint32_t i, rtpTimestamp, targetDelayMs;
+    uint64_t arrivalTimeMs, releaseTimeMs;
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 100, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    /* The first packet is 30 ms slower than the next ones. */
+    result = RtpPlayoutDelay_Update( &( playoutDelay ), UINT32_MAX - 99U, 130 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    /* The receiver clock runs 1 ms per frame faster than the sender clock. */
+    for( i = 1; i < 5 * PLAYOUT_DELAY_WINDOW_LENGTH; i++ )
+    {
+        rtpTimestamp = ( UINT32_MAX - 99U ) + ( i * FRAME_DURATION );
+        arrivalTimeMs = 100 + ( i * ( FRAME_DURATION + 1 ) );
+
+        result = RtpPlayoutDelay_Update( &( playoutDelay ), rtpTimestamp, arrivalTimeMs );
+        TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    }
+
+    /* Without re-estimating the reference, the drift would add up to 49 ms. */
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_LESS_OR_EQUAL( 2 * PLAYOUT_DELAY_WINDOW_LENGTH, targetDelayMs );
+
+    result = RtpPlayoutDelay_GetReleaseTime( &( playoutDelay ), rtpTimestamp, &( releaseTimeMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_GREATER_OR_EQUAL( arrivalTimeMs, releaseTimeMs );
+    TEST_ASSERT_LESS_OR_EQUAL( arrivalTimeMs + targetDelayMs, releaseTimeMs );
+
+    /* A timestamp far in the past of the arrival time base. */
+    result = RtpPlayoutDelay_GetReleaseTime( &( playoutDelay ), rtpTimestamp - 1000000U, &( releaseTimeMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, releaseTimeMs );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate a packet reordered back across the RTP timestamp wrap
+ * around right after the first packet.
+ */
+void test_RtpPlayoutDelay_ReorderedAcrossWrap( void )
+{
+    RtpPlayoutDelayResult_t result;
+    uint32_t i, targetDelayMs;
+    uint64_t releaseTimeMs;
+
+    result = RtpPlayoutDelay_Init( &( playoutDelay ), &( window[ 0 ] ), PLAYOUT_DELAY_WINDOW_LENGTH, CLOCK_RATE, 100, 0, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    result = RtpPlayoutDelay_Update( &( playoutDelay ), 10, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+
+    /* Sent 20 ms before the first packet, before the wrap around. */
+    result = RtpPlayoutDelay_Update( &( playoutDelay ), ( uint32_t ) -10, 1000 );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 20, playoutDelay.jitter );
+
+    for( i = 1; i < PLAYOUT_DELAY_WINDOW_LENGTH; i++ )
+    {
+        result = RtpPlayoutDelay_Update( &( playoutDelay ), 10 + ( i * FRAME_DURATION ), 1000 + ( i * FRAME_DURATION ) );
+        TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    }
+
+    /* The reordered packet was 20 ms late. */
+    result = RtpPlayoutDelay_GetTargetDelay( &( playoutDelay ), &( targetDelayMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 25, targetDelayMs );
+
+    result = RtpPlayoutDelay_GetReleaseTime( &( playoutDelay ), ( uint32_t ) -10, &( releaseTimeMs ) );
+    TEST_ASSERT_EQUAL( RTP_PLAYOUT_DELAY_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 980 + targetDelayMs, releaseTimeMs );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,309 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_receive_stats.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+RtpReceiveStats_t receiveStats;
+
+void setUp( void )
+{
+    memset( &( receiveStats ),
+            0,
+            sizeof( receiveStats ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpReceiveStats_Init and the source probation.
+ */
+void test_RtpReceiveStats_Probation( void )
+{
+    RtpReceiveStatsResult_t result;
+
+    result = RtpReceiveStats_Init( &( receiveStats ), 100 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 99, receiveStats.maxSequenceNumber );
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_MIN_SEQUENTIAL, receiveStats.probation );
+
+    result = RtpReceiveStats_Update( &( receiveStats ), 100, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_PROBATION, result );
+
+    /* Out of sequence packet restarts the probation. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 200, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_PROBATION, result );
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_MIN_SEQUENTIAL - 1, receiveStats.probation );
+
+    result = RtpReceiveStats_Update( &( receiveStats ), 201, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, receiveStats.probation );
+    TEST_ASSERT_EQUAL( 201, receiveStats.baseSequenceNumber );
+    TEST_ASSERT_EQUAL( 1, receiveStats.received );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate sequence number wrap around, extended sequence numbers,
+ * reordering and loss reporting.
+ */
+void test_RtpReceiveStats_WrapLossAndReorder( void )
+{
+    RtpReceiveStatsResult_t result;
+    RtpReceiveStatsReport_t report;
+    uint32_t extendedSequenceNumber;
+
+    result = RtpReceiveStats_Init( &( receiveStats ), 65534 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+
+    result = RtpReceiveStats_Update( &( receiveStats ), 65534, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_PROBATION, result );
+
+    result = RtpReceiveStats_Update( &( receiveStats ), 65535, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+
+    /* Wrap around with 0 lost. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 1, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1U << 16, receiveStats.cycles );
+
+    result = RtpReceiveStats_GetExtendedSequenceNumber( &( receiveStats ),
+                                                        1,
+                                                        &( extendedSequenceNumber ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0x10001, extendedSequenceNumber );
+
+    /* Sequence number from before the wrap around. */
+    result = RtpReceiveStats_GetExtendedSequenceNumber( &( receiveStats ),
+                                                        65535,
+                                                        &( extendedSequenceNumber ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0xFFFF, extendedSequenceNumber );
+
+    result = RtpReceiveStats_GetExtendedSequenceNumber( &( receiveStats ),
+                                                        5,
+                                                        &( extendedSequenceNumber ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0x10005, extendedSequenceNumber );
+
+    /* 3 packets expected, 2 received. */
+    result = RtpReceiveStats_GetReport( &( receiveStats ), &( report ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0x10001, report.extendedHighestSequenceNumber );
+    TEST_ASSERT_EQUAL( 1, report.cumulativeLost );
+    TEST_ASSERT_EQUAL( 256 / 3, report.fractionLost );
+
+    /* The lost packet arrives late. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 0, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, receiveStats.reordered );
+
+    result = RtpReceiveStats_GetReport( &( receiveStats ), &( report ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, report.cumulativeLost );
+    TEST_ASSERT_EQUAL( 0, report.fractionLost );
+
+    /* Duplicate makes the cumulative loss negative. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 1, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+
+    result = RtpReceiveStats_GetReport( &( receiveStats ), &( report ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( -1, report.cumulativeLost );
+    TEST_ASSERT_EQUAL( 0, report.fractionLost );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the handling of large sequence number jumps.
+ */
+void test_RtpReceiveStats_BadSequence( void )
+{
+    RtpReceiveStatsResult_t result;
+
+    result = RtpReceiveStats_Init( &( receiveStats ), 10 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+
+    ( void ) RtpReceiveStats_Update( &( receiveStats ), 10, 0, 0 );
+    result = RtpReceiveStats_Update( &( receiveStats ), 11, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+
+    result = RtpReceiveStats_Update( &( receiveStats ), 20000, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_BAD_SEQUENCE, result );
+    TEST_ASSERT_EQUAL( 11, receiveStats.maxSequenceNumber );
+
+    /* Not sequential with the bad packet. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 30000, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_BAD_SEQUENCE, result );
+
+    /* Sequential with the last bad packet - the sender restarted. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 30001, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 30001, receiveStats.baseSequenceNumber );
+    TEST_ASSERT_EQUAL( 30001, receiveStats.maxSequenceNumber );
+    TEST_ASSERT_EQUAL( 1, receiveStats.received );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the interarrival jitter calculation.
+ */
+void test_RtpReceiveStats_Jitter( void )
+{
+    RtpReceiveStatsResult_t result;
+    RtpReceiveStatsReport_t report;
+
+    result = RtpReceiveStats_Init( &( receiveStats ), 1 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+
+    ( void ) RtpReceiveStats_Update( &( receiveStats ), 1, 0, 1000 );
+
+    /* First valid packet only records the transit time. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 2, 160, 1160 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, receiveStats.jitter );
+
+    /* Packet arrives 160 units late: J = 0 + ( 160 - 0 ) / 16 = 10. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 3, 320, 1480 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 160, receiveStats.jitter );
+
+    /* Packet arrives 160 units early compared to the previous one:
+     * J = 10 + ( 160 - 10 ) / 16 = 19.375. */
+    result = RtpReceiveStats_Update( &( receiveStats ), 4, 480, 1480 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 310, receiveStats.jitter );
+
+    result = RtpReceiveStats_GetReport( &( receiveStats ), &( report ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 19, report.jitter );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the cumulative loss is clamped to 24 bits.
+ */
+void test_RtpReceiveStats_CumulativeLostClamp( void )
+{
+    RtpReceiveStatsResult_t result;
+    RtpReceiveStatsReport_t report;
+    uint16_t sequenceNumber = 0;
+    uint32_t i;
+
+    result = RtpReceiveStats_Init( &( receiveStats ), sequenceNumber );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+
+    ( void ) RtpReceiveStats_Update( &( receiveStats ), sequenceNumber, 0, 0 );
+    sequenceNumber++;
+    ( void ) RtpReceiveStats_Update( &( receiveStats ), sequenceNumber, 0, 0 );
+
+    /* Lose RTP_RECEIVE_STATS_MAX_DROPOUT - 2 packets at a time. */
+    for( i = 0; i < ( ( 0x800000 / ( RTP_RECEIVE_STATS_MAX_DROPOUT - 2 ) ) + 1 ); i++ )
+    {
+        sequenceNumber += RTP_RECEIVE_STATS_MAX_DROPOUT - 1;
+        result = RtpReceiveStats_Update( &( receiveStats ), sequenceNumber, 0, 0 );
+
+        TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    }
+
+    result = RtpReceiveStats_GetReport( &( receiveStats ), &( report ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0x7FFFFF, report.cumulativeLost );
+
+    /* Duplicates. */
+    for( i = 0; i < 0x1800000; i++ )
+    {
+        ( void ) RtpReceiveStats_Update( &( receiveStats ), sequenceNumber, 0, 0 );
+    }
+
+    result = RtpReceiveStats_GetReport( &( receiveStats ), &( report ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( -0x800000, report.cumulativeLost );
+    TEST_ASSERT_EQUAL( 0, report.fractionLost );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpReceiveStats functions in case of bad parameters.
+ */
+void test_RtpReceiveStats_BadParams( void )
+{
+    RtpReceiveStatsResult_t result;
+    RtpReceiveStatsReport_t report;
+    uint32_t extendedSequenceNumber;
+
+    result = RtpReceiveStats_Init( NULL, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_BAD_PARAM, result );
+
+    result = RtpReceiveStats_Update( NULL, 0, 0, 0 );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_BAD_PARAM, result );
+
+    result = RtpReceiveStats_GetExtendedSequenceNumber( NULL,
+                                                        0,
+                                                        &( extendedSequenceNumber ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_BAD_PARAM, result );
+
+    result = RtpReceiveStats_GetExtendedSequenceNumber( &( receiveStats ),
+                                                        0,
+                                                        NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_BAD_PARAM, result );
+
+    result = RtpReceiveStats_GetReport( NULL, &( report ) );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_BAD_PARAM, result );
+
+    result = RtpReceiveStats_GetReport( &( receiveStats ), NULL );
+
+    TEST_ASSERT_EQUAL( RTP_RECEIVE_STATS_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
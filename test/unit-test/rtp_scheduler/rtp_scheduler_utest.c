@@ -0,0 +1,246 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_scheduler.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define CLASS_QUEUE_LENGTH     8
+#define PACKET_LENGTH          1000
+
+#define AUDIO_PRIORITY         0
+#define VIDEO_PRIORITY         2
+
+RtpScheduler_t scheduler;
+RtpSchedulerClass_t audioClass;
+RtpSchedulerClass_t videoClassA;
+RtpSchedulerClass_t videoClassB;
+RtpPacketInfo_t audioInfos[ CLASS_QUEUE_LENGTH ];
+RtpPacketInfo_t videoInfosA[ CLASS_QUEUE_LENGTH ];
+RtpPacketInfo_t videoInfosB[ CLASS_QUEUE_LENGTH ];
+
+void setUp( void )
+{
+    memset( &( scheduler ),
+            0,
+            sizeof( scheduler ) );
+    memset( &( audioClass ),
+            0,
+            sizeof( audioClass ) );
+    memset( &( videoClassA ),
+            0,
+            sizeof( videoClassA ) );
+    memset( &( videoClassB ),
+            0,
+            sizeof( videoClassB ) );
+}
+
+void tearDown( void )
+{
+}
+
+/*-----------------------------------------------------------*/
+
+static RtpSchedulerResult_t EnqueuePacket( RtpSchedulerClass_t * pClass,
+                                           uint16_t seqNum )
+{
+    RtpPacketInfo_t rtpPacketInfo;
+
+    rtpPacketInfo.seqNum = seqNum;
+    rtpPacketInfo.pSerializedRtpPacket = NULL;
+    rtpPacketInfo.serializedPacketLength = PACKET_LENGTH;
+    rtpPacketInfo.insertionTime = 0;
+
+    return RtpScheduler_Enqueue( &( scheduler ), pClass, &( rtpPacketInfo ) );
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate the scheduler APIs in case of bad parameters.
+ */
+void test_RtpScheduler_BadParams( void )
+{
+    RtpSchedulerResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+
+    result = RtpScheduler_Init( NULL, 0 );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_Init( &( scheduler ), 0 );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+
+    result = RtpScheduler_InitClass( NULL, &( audioInfos[ 0 ] ), CLASS_QUEUE_LENGTH, AUDIO_PRIORITY, PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_InitClass( &( audioClass ), &( audioInfos[ 0 ] ), CLASS_QUEUE_LENGTH, RTP_SCHEDULER_PRIORITY_LEVELS, PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_InitClass( &( audioClass ), &( audioInfos[ 0 ] ), CLASS_QUEUE_LENGTH, AUDIO_PRIORITY, 0 );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_InitClass( &( audioClass ), NULL, CLASS_QUEUE_LENGTH, AUDIO_PRIORITY, PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_InitClass( &( audioClass ), &( audioInfos[ 0 ] ), CLASS_QUEUE_LENGTH, AUDIO_PRIORITY, PACKET_LENGTH );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+
+    result = RtpScheduler_Enqueue( NULL, &( audioClass ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_Enqueue( &( scheduler ), NULL, &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_Enqueue( &( scheduler ), &( audioClass ), NULL );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_Dequeue( NULL, &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_Dequeue( &( scheduler ), NULL );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_BAD_PARAM, result );
+
+    result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_EMPTY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a higher priority class is always served first.
+ */
+void test_RtpScheduler_StrictPriority( void )
+{
+    RtpSchedulerResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_Init( &( scheduler ), 0 ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_InitClass( &( audioClass ), &( audioInfos[ 0 ] ), CLASS_QUEUE_LENGTH, AUDIO_PRIORITY, PACKET_LENGTH ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_InitClass( &( videoClassA ), &( videoInfosA[ 0 ] ), CLASS_QUEUE_LENGTH, VIDEO_PRIORITY, PACKET_LENGTH ) );
+
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( videoClassA ), 100 ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( videoClassA ), 101 ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( videoClassA ), 102 ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( audioClass ), 1 ) );
+
+    result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, rtpPacketInfo.seqNum );
+
+    result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 100, rtpPacketInfo.seqNum );
+
+    /* Audio arriving in the middle of the video frame. */
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( audioClass ), 2 ) );
+
+    result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, rtpPacketInfo.seqNum );
+
+    result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 101, rtpPacketInfo.seqNum );
+
+    result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 102, rtpPacketInfo.seqNum );
+
+    result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_EMPTY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that classes of the same priority share the bandwidth in
+ * proportion to their quantum.
+ */
+void test_RtpScheduler_WeightedFairSharing( void )
+{
+    RtpSchedulerResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+    uint16_t i;
+    /* Class A gets twice the bandwidth of class B until it is empty. */
+    uint16_t expectedSeqNums[] = { 0, 1, 100, 2, 3, 101, 102, 103 };
+
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_Init( &( scheduler ), 0 ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_InitClass( &( videoClassA ), &( videoInfosA[ 0 ] ), CLASS_QUEUE_LENGTH, VIDEO_PRIORITY, 2 * PACKET_LENGTH ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_InitClass( &( videoClassB ), &( videoInfosB[ 0 ] ), CLASS_QUEUE_LENGTH, VIDEO_PRIORITY, PACKET_LENGTH ) );
+
+    for( i = 0; i < 4; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( videoClassA ), i ) );
+        TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( videoClassB ), 100 + i ) );
+    }
+
+    for( i = 0; i < sizeof( expectedSeqNums ) / sizeof( expectedSeqNums[ 0 ] ); i++ )
+    {
+        result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( expectedSeqNums[ i ], rtpPacketInfo.seqNum );
+    }
+
+    result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_EMPTY, result );
+
+    /* The deficit is not kept across idle periods. */
+    TEST_ASSERT_EQUAL( 0, videoClassA.deficit );
+    TEST_ASSERT_EQUAL( 0, videoClassB.deficit );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the classes share the byte budget of the scheduler.
+ */
+void test_RtpScheduler_SharedBudget( void )
+{
+    RtpSchedulerResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+    uint16_t i;
+
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_Init( &( scheduler ), 3 * PACKET_LENGTH + PACKET_LENGTH / 2 ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_InitClass( &( audioClass ), &( audioInfos[ 0 ] ), 2, AUDIO_PRIORITY, PACKET_LENGTH ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, RtpScheduler_InitClass( &( videoClassA ), &( videoInfosA[ 0 ] ), CLASS_QUEUE_LENGTH, VIDEO_PRIORITY, PACKET_LENGTH ) );
+
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( audioClass ), 1 ) );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( audioClass ), 2 ) );
+
+    /* The queue of the class is full. */
+    result = EnqueuePacket( &( audioClass ), 3 );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_FULL, result );
+
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( videoClassA ), 100 ) );
+
+    /* The budget is used up by the two classes. */
+    result = EnqueuePacket( &( videoClassA ), 101 );
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_FULL, result );
+    TEST_ASSERT_EQUAL( 3 * PACKET_LENGTH, scheduler.totalBytes );
+
+    for( i = 1; i < 3; i++ )
+    {
+        result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( i, rtpPacketInfo.seqNum );
+    }
+
+    TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, EnqueuePacket( &( videoClassA ), 101 ) );
+
+    for( i = 100; i < 102; i++ )
+    {
+        result = RtpScheduler_Dequeue( &( scheduler ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_SCHEDULER_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( i, rtpPacketInfo.seqNum );
+    }
+
+    TEST_ASSERT_EQUAL( 0, scheduler.totalBytes );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,224 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_spsc_pkt_queue.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_IN_FLIGHT_PKTS 8
+
+RtpPacketInfo_t rtpPacketInfoArray[ MAX_IN_FLIGHT_PKTS ];
+RtpSpscPacketQueue_t rtpSpscPacketQueue;
+uint8_t serializedPacket[] = { 0x80, 0x66, 0xAB, 0x12,
+                               0x12, 0x34, 0x43, 0x21,
+                               0xAB, 0xCD, 0xDB, 0xCA };
+
+void setUp( void )
+{
+    memset( &( rtpSpscPacketQueue ),
+            0,
+            sizeof( rtpSpscPacketQueue ) );
+    memset( &( rtpPacketInfoArray[ 0 ] ),
+            0,
+            sizeof( RtpPacketInfo_t ) * MAX_IN_FLIGHT_PKTS );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RtpSpscPacketQueue_Init functionality.
+ */
+void test_RtpSpscPacketQueue_Init( void )
+{
+    RtpPacketQueueResult_t result;
+
+    result = RtpSpscPacketQueue_Init( &( rtpSpscPacketQueue ),
+                                      &( rtpPacketInfoArray[ 0 ] ),
+                                      MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( &( rtpPacketInfoArray[ 0 ] ), rtpSpscPacketQueue.pRtpPacketInfoArray );
+    TEST_ASSERT_EQUAL( MAX_IN_FLIGHT_PKTS - 1, rtpSpscPacketQueue.indexMask );
+    TEST_ASSERT_EQUAL( 0, rtpSpscPacketQueue.readIndex );
+    TEST_ASSERT_EQUAL( 0, rtpSpscPacketQueue.writeIndex );
+
+    /* The producer and the consumer indices must not share a cache line. */
+    TEST_ASSERT_GREATER_OR_EQUAL( RTP_SPSC_PACKET_QUEUE_CACHE_LINE_SIZE,
+                                  ( size_t ) ( ( uint8_t * ) &( rtpSpscPacketQueue.readIndex ) -
+                                               ( uint8_t * ) &( rtpSpscPacketQueue.writeIndex ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RtpSpscPacketQueue_Init functionality in case of bad parameters.
+ */
+void test_RtpSpscPacketQueue_Init_BadParams( void )
+{
+    RtpPacketQueueResult_t result;
+
+    result = RtpSpscPacketQueue_Init( NULL,
+                                      &( rtpPacketInfoArray[ 0 ] ),
+                                      MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpSpscPacketQueue_Init( &( rtpSpscPacketQueue ),
+                                      NULL,
+                                      MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpSpscPacketQueue_Init( &( rtpSpscPacketQueue ),
+                                      &( rtpPacketInfoArray[ 0 ] ),
+                                      1 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    /* Not a power of two. */
+    result = RtpSpscPacketQueue_Init( &( rtpSpscPacketQueue ),
+                                      &( rtpPacketInfoArray[ 0 ] ),
+                                      MAX_IN_FLIGHT_PKTS - 1 );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Enqueue, Dequeue and Peek functionality in case of bad parameters.
+ */
+void test_RtpSpscPacketQueue_BadParams( void )
+{
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo = { 0 };
+
+    result = RtpSpscPacketQueue_Enqueue( NULL, &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpSpscPacketQueue_Enqueue( &( rtpSpscPacketQueue ), NULL );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpSpscPacketQueue_Dequeue( NULL, &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+
+    result = RtpSpscPacketQueue_Peek( &( rtpSpscPacketQueue ), NULL );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the queue reports full and empty correctly and
+ * preserves the order of the RTP packet infos.
+ */
+void test_RtpSpscPacketQueue_FullAndEmpty( void )
+{
+    uint16_t i;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+
+    result = RtpSpscPacketQueue_Init( &( rtpSpscPacketQueue ),
+                                      &( rtpPacketInfoArray[ 0 ] ),
+                                      MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    result = RtpSpscPacketQueue_Peek( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_EMPTY, result );
+
+    for( i = 0; i < MAX_IN_FLIGHT_PKTS; i++ )
+    {
+        rtpPacketInfo.seqNum = i;
+        rtpPacketInfo.pSerializedRtpPacket = &( serializedPacket[ i ] );
+        rtpPacketInfo.serializedPacketLength = i;
+
+        result = RtpSpscPacketQueue_Enqueue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    }
+
+    result = RtpSpscPacketQueue_Enqueue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_FULL, result );
+
+    result = RtpSpscPacketQueue_Peek( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, rtpPacketInfo.seqNum );
+
+    result = RtpSpscPacketQueue_Dequeue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    /* The slot freed by the consumer is visible to the producer. */
+    rtpPacketInfo.seqNum = MAX_IN_FLIGHT_PKTS;
+    result = RtpSpscPacketQueue_Enqueue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    for( i = 1; i <= MAX_IN_FLIGHT_PKTS; i++ )
+    {
+        result = RtpSpscPacketQueue_Dequeue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( i, rtpPacketInfo.seqNum );
+    }
+
+    result = RtpSpscPacketQueue_Dequeue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_EMPTY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the free running indices wrap around correctly.
+ */
+void test_RtpSpscPacketQueue_IndexWrapAround( void )
+{
+    uint16_t i;
+    RtpPacketQueueResult_t result;
+    RtpPacketInfo_t rtpPacketInfo;
+
+    result = RtpSpscPacketQueue_Init( &( rtpSpscPacketQueue ),
+                                      &( rtpPacketInfoArray[ 0 ] ),
+                                      MAX_IN_FLIGHT_PKTS );
+
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+
+    rtpSpscPacketQueue.writeIndex = SIZE_MAX - 2;
+    rtpSpscPacketQueue.cachedReadIndex = SIZE_MAX - 2;
+    rtpSpscPacketQueue.readIndex = SIZE_MAX - 2;
+    rtpSpscPacketQueue.cachedWriteIndex = SIZE_MAX - 2;
+
+    for( i = 0; i < MAX_IN_FLIGHT_PKTS; i++ )
+    {
+        rtpPacketInfo.seqNum = i;
+        rtpPacketInfo.pSerializedRtpPacket = &( serializedPacket[ 0 ] );
+        rtpPacketInfo.serializedPacketLength = sizeof( serializedPacket );
+
+        result = RtpSpscPacketQueue_Enqueue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+    }
+
+    result = RtpSpscPacketQueue_Enqueue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_FULL, result );
+
+    for( i = 0; i < MAX_IN_FLIGHT_PKTS; i++ )
+    {
+        result = RtpSpscPacketQueue_Dequeue( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+        TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( i, rtpPacketInfo.seqNum );
+        TEST_ASSERT_EQUAL( &( serializedPacket[ 0 ] ), rtpPacketInfo.pSerializedRtpPacket );
+        TEST_ASSERT_EQUAL( sizeof( serializedPacket ), rtpPacketInfo.serializedPacketLength );
+    }
+
+    result = RtpSpscPacketQueue_Peek( &( rtpSpscPacketQueue ), &( rtpPacketInfo ) );
+    TEST_ASSERT_EQUAL( RTP_PACKET_QUEUE_RESULT_EMPTY, result );
+}
+
+/*-----------------------------------------------------------*/